@@ -0,0 +1,162 @@
+//! Shared Styles vs Per-Element Setters
+//!
+//! Styles 3,000 buttons twice, first with four per-control setters each and
+//! then with one shared `XamlStyle`, and prints the time and private memory
+//! each approach takes:
+//! - Per-element: 12,000 bridge calls and 12,000 local values
+//! - Shared style: one `xaml_apply_style` call and 4 setters in total
+
+use std::time::{Duration, Instant};
+use winrt_xaml::error::Result;
+use winrt_xaml::xaml_native::*;
+use windows::core::w;
+use windows::Win32::Foundation::{HWND, LPARAM, LRESULT, WPARAM};
+use windows::Win32::System::Com::{CoInitializeEx, CoUninitialize, COINIT_APARTMENTTHREADED};
+use windows::Win32::System::LibraryLoader::GetModuleHandleW;
+use windows::Win32::System::ProcessStatus::{K32GetProcessMemoryInfo, PROCESS_MEMORY_COUNTERS};
+use windows::Win32::System::Threading::GetCurrentProcess;
+use windows::Win32::UI::WindowsAndMessaging::*;
+
+const BUTTONS: usize = 3000;
+
+unsafe extern "system" fn window_proc(hwnd: HWND, msg: u32, wparam: WPARAM, lparam: LPARAM) -> LRESULT {
+    DefWindowProcW(hwnd, msg, wparam, lparam)
+}
+
+fn create_host_window() -> Result<HWND> {
+    unsafe {
+        let class_name = w!("WinRT_SharedStyles");
+        let wc = WNDCLASSW {
+            lpfnWndProc: Some(window_proc),
+            hInstance: GetModuleHandleW(None)?.into(),
+            lpszClassName: class_name,
+            ..Default::default()
+        };
+        let _ = RegisterClassW(&wc);
+        let hwnd = CreateWindowExW(
+            WINDOW_EX_STYLE(0),
+            class_name,
+            w!("Shared Styles"),
+            WS_OVERLAPPEDWINDOW | WS_VISIBLE,
+            CW_USEDEFAULT,
+            CW_USEDEFAULT,
+            800,
+            600,
+            None,
+            None,
+            GetModuleHandleW(None)?,
+            None,
+        )?;
+        Ok(hwnd)
+    }
+}
+
+/// Private committed bytes of this process.
+fn private_bytes() -> usize {
+    let mut counters = PROCESS_MEMORY_COUNTERS::default();
+    let size = std::mem::size_of::<PROCESS_MEMORY_COUNTERS>() as u32;
+    unsafe {
+        let _ = K32GetProcessMemoryInfo(GetCurrentProcess(), &mut counters, size);
+    }
+    counters.PagefileUsage
+}
+
+/// Let XAML run layout and apply templates for the new content.
+fn pump_messages(duration: Duration) {
+    let deadline = Instant::now() + duration;
+    unsafe {
+        let mut msg = MSG::default();
+        while Instant::now() < deadline {
+            while PeekMessageW(&mut msg, None, 0, 0, PM_REMOVE).as_bool() {
+                let _ = TranslateMessage(&msg);
+                DispatchMessageW(&msg);
+            }
+            std::thread::sleep(Duration::from_millis(5));
+        }
+    }
+}
+
+fn create_buttons() -> Result<Vec<XamlButton>> {
+    (0..BUTTONS)
+        .map(|i| {
+            let button = XamlButton::new()?;
+            button.set_content(&format!("Button {}", i))?;
+            Ok(button)
+        })
+        .collect()
+}
+
+fn report(label: &str, styling: Duration, before: usize, after: usize) {
+    println!(
+        "{:<16} styling {:>8.2} ms   memory {:>+8.1} KB ({:.0} bytes per button)",
+        label,
+        styling.as_secs_f64() * 1000.0,
+        (after as f64 - before as f64) / 1024.0,
+        (after as f64 - before as f64) / BUTTONS as f64,
+    );
+}
+
+fn run(source: &XamlSource, label: &str, shared: bool) -> Result<()> {
+    // Release the previous run's buttons before taking the baseline.
+    let panel = XamlStackPanel::new()?;
+    source.set_content_element(&panel.as_uielement())?;
+    pump_messages(Duration::from_millis(200));
+    let before = private_bytes();
+    let buttons = create_buttons()?;
+
+    let start = Instant::now();
+    if shared {
+        let style = XamlStyle::new(StyleTarget::Button)?
+            .with(StyleSetter::Background(0xFF0078D4))?
+            .with(StyleSetter::Foreground(0xFFFFFFFF))?
+            .with(StyleSetter::CornerRadius(6.0))?
+            .with(StyleSetter::Padding(12.0, 6.0, 12.0, 6.0))?;
+        let elements: Vec<XamlUIElement> = buttons.iter().map(|button| button.as_uielement()).collect();
+        style.apply(&elements.iter().collect::<Vec<_>>())?;
+    } else {
+        for button in &buttons {
+            button.set_background(0xFF0078D4)?;
+            button.set_foreground(0xFFFFFFFF)?;
+            button.set_corner_radius(6.0)?;
+            button.set_padding(12.0, 6.0, 12.0, 6.0)?;
+        }
+    }
+    let styling = start.elapsed();
+
+    for button in &buttons {
+        panel.add_child(&button.as_uielement())?;
+    }
+    pump_messages(Duration::from_millis(500));
+    report(label, styling, before, private_bytes());
+    Ok(())
+}
+
+fn main() -> Result<()> {
+    unsafe {
+        let hr = CoInitializeEx(None, COINIT_APARTMENTTHREADED);
+        if hr.is_err() {
+            return Err(winrt_xaml::error::Error::initialization(format!("COM init failed: {:?}", hr)));
+        }
+    }
+
+    let _manager = XamlManager::new()?;
+    let host_hwnd = create_host_window()?;
+    let mut source = XamlSource::new()?;
+    let island_hwnd = source.attach_to_window(host_hwnd)?;
+    unsafe {
+        let _ = ShowWindow(island_hwnd, SW_SHOW);
+        let _ = SetWindowPos(island_hwnd, None, 0, 0, 800, 600, SWP_NOZORDER | SWP_NOACTIVATE);
+    }
+
+    println!("Styling {} buttons\n", BUTTONS);
+    // The first run warms up XAML's type and template caches.
+    run(&source, "Warm-up", false)?;
+    run(&source, "Per-element", false)?;
+    run(&source, "Shared style", true)?;
+
+    unsafe {
+        let _ = DestroyWindow(host_hwnd);
+        CoUninitialize();
+    }
+    Ok(())
+}
@@ -96,10 +96,14 @@ pub mod prelude {
     // Re-export WinRT XAML types
     #[cfg(feature = "xaml-islands")]
     pub use crate::xaml_native::{
-        ImageStretch, ListViewSelectionMode, ScrollBarVisibility, ScrollMode, XamlButton,
-        XamlCheckBox, XamlComboBox, XamlGrid, XamlImage, XamlListView, XamlManager,
-        XamlProgressBar, XamlRadioButton, XamlScrollViewer, XamlSlider, XamlSource,
-        XamlStackPanel, XamlTextBlock, XamlTextBox, XamlUIElement,
+        ElementProperty, ImageStretch, ImplicitAnimations, ListChange, ListChangeBuffer,
+        ListFilter, ListSortKey, ListSortKind, ListViewSelectionMode, NumberFormat,
+        PropertyBindings, PropertyChange, PropertyValue, ScrollBarVisibility, ScrollMode,
+        SlotBatch, SlotKind, StringTable, StyleSetter, StyleTarget, VisualAnimation,
+        VisualProperty, XamlButton, XamlCheckBox, XamlComboBox, XamlGrid, XamlImage,
+        XamlListView, XamlLogView, XamlManager, XamlProgressBar, XamlRadioButton,
+        XamlScrollViewer, XamlSlider, XamlSource, XamlStackPanel, XamlStyle,
+        XamlTextBlock, XamlTextBox, XamlUIElement, XamlViewModel,
     };
 
     // Re-export reactive types
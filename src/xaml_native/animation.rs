@@ -1,6 +1,7 @@
 //! WinRT Animation System - Storyboard and Animation types
 
-use super::ffi::{self, XamlStoryboardHandle, XamlDoubleAnimationHandle, XamlColorAnimationHandle, XamlUIElementHandle};
+use super::ffi::{self, XamlStoryboardHandle, XamlDoubleAnimationHandle, XamlColorAnimationHandle, XamlKeyFrameAnimationHandle, XamlStoryboardTemplateHandle, XamlUIElementHandle};
+use super::XamlUIElement;
 use crate::error::{Error, Result};
 use std::ffi::OsStr;
 use std::os::windows::ffi::OsStrExt;
@@ -46,6 +47,19 @@ impl XamlStoryboard {
         Ok(())
     }
 
+    /// Add a keyframe animation to the storyboard
+    pub fn add_keyframe_animation(&self, animation: &XamlKeyFrameAnimation) -> Result<()> {
+        let result = unsafe {
+            ffi::xaml_storyboard_add_keyframe_animation(self.handle, animation.handle())
+        };
+
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to add keyframe animation"));
+        }
+
+        Ok(())
+    }
+
     /// Set the target UI element for all animations in this storyboard
     pub(crate) fn set_target(&self, target: XamlUIElementHandle) -> Result<()> {
         let result = unsafe {
@@ -111,6 +125,39 @@ impl XamlStoryboard {
         Ok(())
     }
 
+    /// Register a callback for each time the storyboard runs to completion.
+    ///
+    /// Stopping the storyboard does not call it. The callback runs on the UI
+    /// thread after the storyboard has left the running counts in
+    /// [`animation_stats`](super::animation_stats), so it can begin the next
+    /// animation in a chain or recycle this one. Like button click handlers,
+    /// the callback is leaked so it stays valid for the storyboard's lifetime.
+    pub fn on_completed<F>(&self, callback: F) -> Result<()>
+    where
+        F: Fn() + Send + 'static,
+    {
+        let user_data = Box::into_raw(Box::new(callback)) as *mut std::ffi::c_void;
+
+        extern "C" fn trampoline<F>(user_data: *mut std::ffi::c_void)
+        where
+            F: Fn(),
+        {
+            unsafe {
+                let callback = &*(user_data as *const F);
+                callback();
+            }
+        }
+
+        let result = unsafe { ffi::xaml_storyboard_on_completed(self.handle, trampoline::<F>, user_data) };
+        if result != 0 {
+            unsafe {
+                let _ = Box::from_raw(user_data as *mut F);
+            }
+            return Err(Error::invalid_operation("Failed to register completion handler"));
+        }
+        Ok(())
+    }
+
     /// Get the raw handle
     pub(crate) fn handle(&self) -> XamlStoryboardHandle {
         self.handle
@@ -461,3 +508,455 @@ impl ColorAnimationBuilder {
         Ok(animation)
     }
 }
+
+/// Which part of an easing curve a keyframe uses
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum EasingMode {
+    /// Starts slowly
+    In,
+    /// Ends slowly
+    Out,
+    /// Starts and ends slowly
+    InOut,
+}
+
+/// How a keyframe moves from the previous key's value to its own
+///
+/// Sine through Circ are sent to XAML as spline keyframes. Back, Elastic and
+/// Bounce overshoot, so they use an easing function instead.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum KeyFrameEasing {
+    Linear,
+    /// Jump to the value at the key time
+    Discrete,
+    Sine(EasingMode),
+    Quad(EasingMode),
+    Cubic(EasingMode),
+    Quart(EasingMode),
+    Quint(EasingMode),
+    Expo(EasingMode),
+    Circ(EasingMode),
+    Back(EasingMode),
+    Elastic(EasingMode),
+    Bounce(EasingMode),
+}
+
+impl KeyFrameEasing {
+    /// The matching `XamlKeyFrameKind` value
+    fn to_ffi(self) -> u8 {
+        let (family, mode) = match self {
+            KeyFrameEasing::Linear => return 0,
+            KeyFrameEasing::Discrete => return 1,
+            KeyFrameEasing::Sine(mode) => (0, mode),
+            KeyFrameEasing::Quad(mode) => (1, mode),
+            KeyFrameEasing::Cubic(mode) => (2, mode),
+            KeyFrameEasing::Quart(mode) => (3, mode),
+            KeyFrameEasing::Quint(mode) => (4, mode),
+            KeyFrameEasing::Expo(mode) => (5, mode),
+            KeyFrameEasing::Circ(mode) => (6, mode),
+            KeyFrameEasing::Back(mode) => (7, mode),
+            KeyFrameEasing::Elastic(mode) => (8, mode),
+            KeyFrameEasing::Bounce(mode) => (9, mode),
+        };
+        let mode = match mode {
+            EasingMode::In => 0,
+            EasingMode::Out => 1,
+            EasingMode::InOut => 2,
+        };
+        2 + 3 * family + mode
+    }
+}
+
+/// A keyframe of a double keyframe animation
+#[derive(Debug, Clone, Copy, PartialEq)]
+pub struct DoubleKeyFrame {
+    /// Milliseconds from the start of the animation
+    pub time_ms: f32,
+    pub value: f32,
+    pub easing: KeyFrameEasing,
+}
+
+/// A keyframe of a color keyframe animation
+#[derive(Debug, Clone, Copy, PartialEq)]
+pub struct ColorKeyFrame {
+    /// Milliseconds from the start of the animation
+    pub time_ms: f32,
+    /// ARGB color, e.g. 0xFFFF0000 for red
+    pub color: u32,
+    pub easing: KeyFrameEasing,
+}
+
+/// A WinRT DoubleAnimationUsingKeyFrames or ColorAnimationUsingKeyFrames
+///
+/// # Example
+/// ```no_run
+/// use winrt_xaml::xaml_native::{DoubleKeyFrame, EasingMode, KeyFrameEasing, XamlKeyFrameAnimation};
+///
+/// let fade = XamlKeyFrameAnimation::new_double()?;
+/// fade.set_double_keyframes(&[
+///     DoubleKeyFrame { time_ms: 0.0, value: 0.0, easing: KeyFrameEasing::Linear },
+///     DoubleKeyFrame { time_ms: 200.0, value: 1.0, easing: KeyFrameEasing::Cubic(EasingMode::Out) },
+///     DoubleKeyFrame { time_ms: 1200.0, value: 0.0, easing: KeyFrameEasing::Quad(EasingMode::InOut) },
+/// ])?;
+/// # Ok::<(), winrt_xaml::Error>(())
+/// ```
+pub struct XamlKeyFrameAnimation {
+    handle: XamlKeyFrameAnimationHandle,
+    is_color: bool,
+}
+
+impl XamlKeyFrameAnimation {
+    /// Create a keyframe animation for numeric properties
+    pub fn new_double() -> Result<Self> {
+        let handle = unsafe { ffi::xaml_double_keyframe_animation_create() };
+        if handle.0.is_null() {
+            return Err(Error::control_creation("Failed to create DoubleAnimationUsingKeyFrames"));
+        }
+        Ok(Self { handle, is_color: false })
+    }
+
+    /// Create a keyframe animation for color properties
+    pub fn new_color() -> Result<Self> {
+        let handle = unsafe { ffi::xaml_color_keyframe_animation_create() };
+        if handle.0.is_null() {
+            return Err(Error::control_creation("Failed to create ColorAnimationUsingKeyFrames"));
+        }
+        Ok(Self { handle, is_color: true })
+    }
+
+    /// Replace all keyframes of a double animation in one call
+    pub fn set_double_keyframes(&self, keys: &[DoubleKeyFrame]) -> Result<()> {
+        if self.is_color {
+            return Err(Error::invalid_operation("Double keyframes need a double keyframe animation"));
+        }
+        let times: Vec<f32> = keys.iter().map(|key| key.time_ms).collect();
+        let values: Vec<f32> = keys.iter().map(|key| key.value).collect();
+        let kinds: Vec<u8> = keys.iter().map(|key| key.easing.to_ffi()).collect();
+        self.set_keyframes(&times, &values, &kinds)
+    }
+
+    /// Replace all keyframes of a color animation in one call
+    pub fn set_color_keyframes(&self, keys: &[ColorKeyFrame]) -> Result<()> {
+        if !self.is_color {
+            return Err(Error::invalid_operation("Color keyframes need a color keyframe animation"));
+        }
+        let times: Vec<f32> = keys.iter().map(|key| key.time_ms).collect();
+        let values: Vec<f32> = keys
+            .iter()
+            .flat_map(|key| key.color.to_be_bytes())
+            .map(f32::from)
+            .collect();
+        let kinds: Vec<u8> = keys.iter().map(|key| key.easing.to_ffi()).collect();
+        self.set_keyframes(&times, &values, &kinds)
+    }
+
+    fn set_keyframes(&self, times: &[f32], values: &[f32], kinds: &[u8]) -> Result<()> {
+        let result = unsafe {
+            ffi::xaml_keyframes_set(
+                self.handle,
+                times.as_ptr(),
+                values.as_ptr(),
+                kinds.as_ptr(),
+                times.len() as i32,
+            )
+        };
+
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to set keyframes"));
+        }
+
+        Ok(())
+    }
+
+    /// Set the target property path
+    pub(crate) fn set_target_property(&self, target: XamlUIElementHandle, property_path: impl AsRef<str>) -> Result<()> {
+        let path_wide: Vec<u16> = OsStr::new(property_path.as_ref())
+            .encode_wide()
+            .chain(Some(0))
+            .collect();
+
+        let result = unsafe {
+            ffi::xaml_keyframe_animation_set_target_property(
+                self.handle,
+                target,
+                path_wide.as_ptr(),
+            )
+        };
+
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to set target property"));
+        }
+
+        Ok(())
+    }
+
+    /// Get the raw handle
+    pub(crate) fn handle(&self) -> XamlKeyFrameAnimationHandle {
+        self.handle
+    }
+}
+
+impl Drop for XamlKeyFrameAnimation {
+    fn drop(&mut self) {
+        if !self.handle.0.is_null() {
+            unsafe {
+                ffi::xaml_keyframe_animation_destroy(self.handle);
+            }
+        }
+    }
+}
+
+unsafe impl Send for XamlKeyFrameAnimation {}
+unsafe impl Sync for XamlKeyFrameAnimation {}
+
+/// Start and end values of an [`AnimSpec`]
+#[derive(Debug, Clone, Copy, PartialEq)]
+pub enum AnimValues {
+    /// Numeric property; `from: None` starts at the current value
+    Double { from: Option<f64>, to: f64 },
+    /// ARGB color property; `from: None` starts at the current value
+    Color { from: Option<u32>, to: u32 },
+}
+
+/// One animation of a [`XamlStoryboardTemplate`]
+#[derive(Debug, Clone, PartialEq)]
+pub struct AnimSpec {
+    /// Property path, e.g. "Opacity" or "(UIElement.RenderTransform).(TranslateTransform.Y)"
+    pub property_path: String,
+    pub values: AnimValues,
+    pub duration_ms: u32,
+    /// Start offset within the storyboard
+    pub begin_ms: u32,
+    /// Any easing except [`KeyFrameEasing::Discrete`]
+    pub easing: KeyFrameEasing,
+}
+
+impl AnimSpec {
+    /// Animate a numeric property
+    pub fn double(property_path: impl Into<String>, from: Option<f64>, to: f64, duration_ms: u32) -> Self {
+        Self {
+            property_path: property_path.into(),
+            values: AnimValues::Double { from, to },
+            duration_ms,
+            begin_ms: 0,
+            easing: KeyFrameEasing::Linear,
+        }
+    }
+
+    /// Animate a color property
+    pub fn color(property_path: impl Into<String>, from: Option<u32>, to: u32, duration_ms: u32) -> Self {
+        Self {
+            property_path: property_path.into(),
+            values: AnimValues::Color { from, to },
+            duration_ms,
+            begin_ms: 0,
+            easing: KeyFrameEasing::Linear,
+        }
+    }
+
+    /// Set the start offset
+    pub fn begin_ms(mut self, milliseconds: u32) -> Self {
+        self.begin_ms = milliseconds;
+        self
+    }
+
+    /// Set the easing curve
+    pub fn easing(mut self, easing: KeyFrameEasing) -> Self {
+        self.easing = easing;
+        self
+    }
+}
+
+/// FFI records for a set of specs, plus the paths they point into.
+pub(super) struct EncodedAnimSpecs {
+    pub records: Vec<ffi::XamlAnimSpec>,
+    _paths: Vec<Vec<u16>>,
+}
+
+pub(super) fn encode_anim_specs(specs: &[AnimSpec]) -> EncodedAnimSpecs {
+    let paths: Vec<Vec<u16>> = specs
+        .iter()
+        .map(|spec| OsStr::new(&spec.property_path).encode_wide().chain(Some(0)).collect())
+        .collect();
+    let records = specs
+        .iter()
+        .zip(&paths)
+        .map(|(spec, path)| {
+            let mut record = ffi::XamlAnimSpec {
+                kind: ffi::XAML_ANIM_DOUBLE,
+                flags: 0,
+                property_path: path.as_ptr(),
+                from: 0.0,
+                to: 0.0,
+                from_color: 0,
+                to_color: 0,
+                duration_ms: spec.duration_ms.min(i32::MAX as u32) as i32,
+                begin_ms: spec.begin_ms.min(i32::MAX as u32) as i32,
+                easing: i32::from(spec.easing.to_ffi()),
+            };
+            match spec.values {
+                AnimValues::Double { from, to } => {
+                    record.from = from.unwrap_or(0.0);
+                    record.to = to;
+                    if from.is_some() {
+                        record.flags |= ffi::XAML_ANIM_HAS_FROM;
+                    }
+                }
+                AnimValues::Color { from, to } => {
+                    record.kind = ffi::XAML_ANIM_COLOR;
+                    record.from_color = from.unwrap_or(0);
+                    record.to_color = to;
+                    if from.is_some() {
+                        record.flags |= ffi::XAML_ANIM_HAS_FROM;
+                    }
+                }
+            }
+            record
+        })
+        .collect();
+    EncodedAnimSpecs { records, _paths: paths }
+}
+
+/// A reusable storyboard description
+///
+/// Each [`instantiate`](Self::instantiate) builds a storyboard for one target in
+/// a single bridge call. Storyboards handed back with
+/// [`recycle`](Self::recycle) are reused by later instantiations.
+///
+/// # Example
+/// ```no_run
+/// use winrt_xaml::xaml_native::{AnimSpec, EasingMode, KeyFrameEasing, XamlButton, XamlStoryboardTemplate};
+///
+/// let hover = XamlStoryboardTemplate::new(&[
+///     AnimSpec::double("Opacity", None, 0.7, 150).easing(KeyFrameEasing::Quad(EasingMode::Out)),
+/// ])?;
+/// let button = XamlButton::new()?;
+/// let storyboard = hover.instantiate(&button.as_uielement())?;
+/// storyboard.begin()?;
+/// // Later, once it has finished:
+/// hover.recycle(storyboard)?;
+/// # Ok::<(), winrt_xaml::Error>(())
+/// ```
+pub struct XamlStoryboardTemplate {
+    handle: XamlStoryboardTemplateHandle,
+}
+
+impl XamlStoryboardTemplate {
+    /// Create a template from animation specs
+    pub fn new(animations: &[AnimSpec]) -> Result<Self> {
+        let encoded = encode_anim_specs(animations);
+        let handle = unsafe {
+            ffi::xaml_storyboard_template_create(encoded.records.as_ptr(), encoded.records.len() as i32)
+        };
+        if handle.0.is_null() {
+            return Err(Error::control_creation("Failed to create storyboard template"));
+        }
+        Ok(Self { handle })
+    }
+
+    /// Build (or reuse) a storyboard animating `target`
+    pub fn instantiate(&self, target: &XamlUIElement) -> Result<XamlStoryboard> {
+        let handle = unsafe { ffi::xaml_storyboard_instantiate(self.handle, target.handle()) };
+        if handle.0.is_null() {
+            return Err(Error::invalid_operation("Failed to instantiate storyboard template"));
+        }
+        Ok(XamlStoryboard { handle })
+    }
+
+    /// Stop a storyboard from [`instantiate`](Self::instantiate) and keep it for reuse
+    pub fn recycle(&self, storyboard: XamlStoryboard) -> Result<()> {
+        let result = unsafe { ffi::xaml_storyboard_template_recycle(self.handle, storyboard.handle()) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to recycle storyboard"));
+        }
+        // The bridge now owns the storyboard.
+        std::mem::forget(storyboard);
+        Ok(())
+    }
+
+    /// Number of recycled storyboards waiting for reuse
+    pub fn pooled_count(&self) -> usize {
+        let count = unsafe { ffi::xaml_storyboard_template_pooled_count(self.handle) };
+        count.max(0) as usize
+    }
+}
+
+impl Drop for XamlStoryboardTemplate {
+    fn drop(&mut self) {
+        if !self.handle.0.is_null() {
+            unsafe {
+                ffi::xaml_storyboard_template_destroy(self.handle);
+            }
+        }
+    }
+}
+
+unsafe impl Send for XamlStoryboardTemplate {}
+unsafe impl Sync for XamlStoryboardTemplate {}
+
+/// Build one storyboard that plays `animations` on every target, starting
+/// target `i` after `i * stagger_ms` milliseconds.
+///
+/// The whole cascade is created in a single bridge call, and one
+/// [`begin`](XamlStoryboard::begin) starts it.
+///
+/// # Example
+/// ```no_run
+/// use winrt_xaml::xaml_native::{animate_staggered, AnimSpec, XamlButton};
+///
+/// let buttons = [XamlButton::new()?, XamlButton::new()?, XamlButton::new()?];
+/// let elements: Vec<_> = buttons.iter().map(|button| button.as_uielement()).collect();
+/// let targets: Vec<_> = elements.iter().collect();
+/// let cascade = animate_staggered(&targets, &[AnimSpec::double("Opacity", Some(0.0), 1.0, 200)], 40)?;
+/// cascade.begin()?;
+/// # Ok::<(), winrt_xaml::Error>(())
+/// ```
+pub fn animate_staggered(targets: &[&XamlUIElement], animations: &[AnimSpec], stagger_ms: u32) -> Result<XamlStoryboard> {
+    let handles: Vec<XamlUIElementHandle> = targets.iter().map(|target| target.handle()).collect();
+    let encoded = encode_anim_specs(animations);
+    let handle = unsafe {
+        ffi::xaml_animate_staggered(
+            handles.as_ptr(),
+            handles.len() as i32,
+            encoded.records.as_ptr(),
+            encoded.records.len() as i32,
+            stagger_ms.min(i32::MAX as u32) as i32,
+        )
+    };
+    if handle.0.is_null() {
+        return Err(Error::control_creation("Failed to create staggered storyboard"));
+    }
+    Ok(XamlStoryboard { handle })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_easing_matches_keyframe_kinds() {
+        assert_eq!(KeyFrameEasing::Linear.to_ffi(), 0);
+        assert_eq!(KeyFrameEasing::Discrete.to_ffi(), 1);
+        assert_eq!(KeyFrameEasing::Sine(EasingMode::In).to_ffi(), 2);
+        assert_eq!(KeyFrameEasing::Expo(EasingMode::Out).to_ffi(), 18);
+        assert_eq!(KeyFrameEasing::Bounce(EasingMode::InOut).to_ffi(), 31);
+    }
+
+    #[test]
+    fn test_encode_anim_specs() {
+        let specs = [
+            AnimSpec::double("Opacity", Some(0.0), 1.0, 200),
+            AnimSpec::color("(Border.Background).(SolidColorBrush.Color)", None, 0xFF00FF00, 300)
+                .begin_ms(50)
+                .easing(KeyFrameEasing::Back(EasingMode::Out)),
+        ];
+        let encoded = encode_anim_specs(&specs);
+
+        let fade = &encoded.records[0];
+        assert_eq!((fade.kind, fade.flags, fade.from, fade.to), (ffi::XAML_ANIM_DOUBLE, ffi::XAML_ANIM_HAS_FROM, 0.0, 1.0));
+        let tint = &encoded.records[1];
+        assert_eq!((tint.kind, tint.flags, tint.to_color), (ffi::XAML_ANIM_COLOR, 0, 0xFF00FF00));
+        assert_eq!((tint.begin_ms, tint.easing), (50, 24));
+        assert_eq!(unsafe { *tint.property_path }, u16::from(b'('));
+    }
+}
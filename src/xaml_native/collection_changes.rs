@@ -0,0 +1,335 @@
+//! Batched collection changes for ListView and ComboBox.
+//!
+//! `ObservableCollection` reports every push, remove and replace on its own.
+//! [`ListChangeBuffer`] collects those notifications between frames, merges
+//! adjacent edits, and applies the result with a single bridge call per flush.
+
+use super::{ffi, to_wide_string, XamlComboBox, XamlListView};
+use crate::error::Result;
+use crate::reactive::{CollectionChange, ObservableCollection, SubscriptionId};
+use std::sync::{Arc, Mutex};
+
+/// One edit to a list control's items, already converted to display text.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub enum ListChange {
+    /// Insert `items` before `index`.
+    Insert { index: usize, items: Vec<String> },
+    /// Remove `count` items starting at `index`.
+    Remove { index: usize, count: usize },
+    /// Replace the items starting at `index`.
+    Replace { index: usize, items: Vec<String> },
+    /// Move the item at `from` to `to`.
+    Move { from: usize, to: usize },
+    /// Replace all items.
+    Reset { items: Vec<String> },
+}
+
+/// Buffers list changes between frames and applies them in one call.
+///
+/// Clones share the same buffer, so one clone can be attached to a collection
+/// while another is flushed from the frame loop.
+///
+/// # Example
+///
+/// ```rust,no_run
+/// use winrt_xaml::prelude::*;
+///
+/// # fn main() -> Result<()> {
+/// let todos = ObservableCollection::new();
+/// let list = XamlListView::new()?;
+/// let buffer = ListChangeBuffer::new();
+/// buffer.attach(&todos, |item: &String| item.clone());
+///
+/// todos.push("Buy milk".to_string());
+/// todos.push("Write code".to_string());
+///
+/// // Once per frame: both pushes reach the ListView as one insert.
+/// buffer.flush_to_listview(&list)?;
+/// # Ok(())
+/// # }
+/// ```
+#[derive(Clone, Default)]
+pub struct ListChangeBuffer {
+    pending: Arc<Mutex<Vec<ListChange>>>,
+}
+
+impl ListChangeBuffer {
+    /// Create an empty buffer.
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Record a change, merging it into the previous one where possible.
+    pub fn push(&self, change: ListChange) {
+        coalesce(&mut self.pending.lock().unwrap(), change);
+    }
+
+    /// Record every change of `collection`, converting items with `to_text`.
+    pub fn attach<T, F>(&self, collection: &ObservableCollection<T>, to_text: F) -> SubscriptionId
+    where
+        T: Clone + 'static,
+        F: Fn(&T) -> String + Send + 'static,
+    {
+        let buffer = self.clone();
+        collection.subscribe(move |change| {
+            let change = match change {
+                CollectionChange::Added { index, item } => ListChange::Insert {
+                    index: *index,
+                    items: vec![to_text(item)],
+                },
+                CollectionChange::Removed { index, .. } => ListChange::Remove { index: *index, count: 1 },
+                CollectionChange::Replaced { index, new_item, .. } => ListChange::Replace {
+                    index: *index,
+                    items: vec![to_text(new_item)],
+                },
+                CollectionChange::Cleared => ListChange::Reset { items: Vec::new() },
+                CollectionChange::Reset { items } => ListChange::Reset {
+                    items: items.iter().map(&to_text).collect(),
+                },
+            };
+            buffer.push(change);
+        })
+    }
+
+    /// Number of buffered records after merging.
+    pub fn len(&self) -> usize {
+        self.pending.lock().unwrap().len()
+    }
+
+    /// Check whether there is anything to flush.
+    pub fn is_empty(&self) -> bool {
+        self.pending.lock().unwrap().is_empty()
+    }
+
+    /// Apply and clear the buffered changes. Returns the number of records applied.
+    ///
+    /// If the bridge rejects the batch the changes are dropped; push a
+    /// [`ListChange::Reset`] to resynchronize.
+    pub fn flush_to_listview(&self, listview: &XamlListView) -> Result<usize> {
+        let changes = self.take();
+        if !changes.is_empty() {
+            listview.apply_changes(&changes)?;
+        }
+        Ok(changes.len())
+    }
+
+    /// Apply and clear the buffered changes. Returns the number of records applied.
+    pub fn flush_to_combobox(&self, combobox: &XamlComboBox) -> Result<usize> {
+        let changes = self.take();
+        if !changes.is_empty() {
+            combobox.apply_changes(&changes)?;
+        }
+        Ok(changes.len())
+    }
+
+    fn take(&self) -> Vec<ListChange> {
+        std::mem::take(&mut *self.pending.lock().unwrap())
+    }
+}
+
+fn coalesce(pending: &mut Vec<ListChange>, change: ListChange) {
+    // A reset makes every earlier record irrelevant.
+    if let ListChange::Reset { .. } = change {
+        pending.clear();
+        pending.push(change);
+        return;
+    }
+    let change = match pending.last_mut() {
+        Some(last) => match merge(last, change) {
+            Some(change) => change,
+            None => return,
+        },
+        None => change,
+    };
+    pending.push(change);
+}
+
+/// Fold `change` into `last` when the pair collapses into one record;
+/// otherwise hand it back.
+fn merge(last: &mut ListChange, change: ListChange) -> Option<ListChange> {
+    match (last, change) {
+        (ListChange::Reset { items }, change) => {
+            apply(items, change);
+            None
+        }
+        (ListChange::Insert { index, items }, ListChange::Insert { index: next, items: more })
+            if next == *index + items.len() =>
+        {
+            items.extend(more);
+            None
+        }
+        (ListChange::Remove { index, count }, ListChange::Remove { index: next, count: more }) if next == *index => {
+            *count += more;
+            None
+        }
+        (ListChange::Remove { index, count }, ListChange::Remove { index: next, count: more })
+            if next + more == *index =>
+        {
+            *index = next;
+            *count += more;
+            None
+        }
+        (ListChange::Replace { index, items }, ListChange::Replace { index: next, items: more })
+            if next >= *index && next + more.len() <= *index + items.len() =>
+        {
+            let start = next - *index;
+            for (slot, item) in items[start..].iter_mut().zip(more) {
+                *slot = item;
+            }
+            None
+        }
+        (_, change) => Some(change),
+    }
+}
+
+fn apply(items: &mut Vec<String>, change: ListChange) {
+    match change {
+        ListChange::Insert { index, items: added } => {
+            let index = index.min(items.len());
+            items.splice(index..index, added);
+        }
+        ListChange::Remove { index, count } => {
+            let start = index.min(items.len());
+            let end = index.saturating_add(count).min(items.len());
+            items.drain(start..end);
+        }
+        ListChange::Replace { index, items: replaced } => {
+            for (slot, item) in items.iter_mut().skip(index).zip(replaced) {
+                *slot = item;
+            }
+        }
+        ListChange::Move { from, to } => {
+            if from < items.len() && to < items.len() {
+                let item = items.remove(from);
+                items.insert(to, item);
+            }
+        }
+        ListChange::Reset { items: all } => *items = all,
+    }
+}
+
+/// FFI records for a batch, plus the strings they point into.
+pub(super) struct EncodedChanges {
+    pub records: Vec<ffi::XamlCollectionChange>,
+    _strings: Vec<Vec<u16>>,
+    _pointers: Vec<Vec<*const u16>>,
+}
+
+pub(super) fn encode_changes(changes: &[ListChange]) -> EncodedChanges {
+    let mut encoded = EncodedChanges {
+        records: Vec::with_capacity(changes.len()),
+        _strings: Vec::new(),
+        _pointers: Vec::new(),
+    };
+
+    for change in changes {
+        let mut record = ffi::XamlCollectionChange {
+            kind: 0,
+            index: 0,
+            count: 0,
+            new_index: 0,
+            items: std::ptr::null(),
+        };
+        let texts = match change {
+            ListChange::Insert { index, items } => {
+                record.kind = ffi::XAML_CHANGE_INSERT;
+                record.index = *index as i32;
+                Some(items)
+            }
+            ListChange::Remove { index, count } => {
+                record.kind = ffi::XAML_CHANGE_REMOVE;
+                record.index = *index as i32;
+                record.count = *count as i32;
+                None
+            }
+            ListChange::Replace { index, items } => {
+                record.kind = ffi::XAML_CHANGE_REPLACE;
+                record.index = *index as i32;
+                Some(items)
+            }
+            ListChange::Move { from, to } => {
+                record.kind = ffi::XAML_CHANGE_MOVE;
+                record.index = *from as i32;
+                record.new_index = *to as i32;
+                None
+            }
+            ListChange::Reset { items } => {
+                record.kind = ffi::XAML_CHANGE_RESET;
+                Some(items)
+            }
+        };
+
+        if let Some(texts) = texts {
+            // The inner buffers stay put when the outer vectors grow.
+            let pointers: Vec<*const u16> = texts
+                .iter()
+                .map(|text| {
+                    let wide = to_wide_string(text);
+                    let ptr = wide.as_ptr();
+                    encoded._strings.push(wide);
+                    ptr
+                })
+                .collect();
+            record.count = pointers.len() as i32;
+            record.items = pointers.as_ptr();
+            encoded._pointers.push(pointers);
+        }
+        encoded.records.push(record);
+    }
+    encoded
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn strings(items: &[&str]) -> Vec<String> {
+        items.iter().map(|item| item.to_string()).collect()
+    }
+
+    #[test]
+    fn test_consecutive_pushes_merge() {
+        let buffer = ListChangeBuffer::new();
+        buffer.push(ListChange::Insert { index: 3, items: strings(&["a"]) });
+        buffer.push(ListChange::Insert { index: 4, items: strings(&["b"]) });
+        buffer.push(ListChange::Remove { index: 1, count: 1 });
+        buffer.push(ListChange::Remove { index: 1, count: 1 });
+        buffer.push(ListChange::Remove { index: 0, count: 1 });
+
+        assert_eq!(
+            buffer.take(),
+            vec![
+                ListChange::Insert { index: 3, items: strings(&["a", "b"]) },
+                ListChange::Remove { index: 0, count: 3 },
+            ]
+        );
+    }
+
+    #[test]
+    fn test_reset_absorbs_later_changes() {
+        let buffer = ListChangeBuffer::new();
+        buffer.push(ListChange::Insert { index: 0, items: strings(&["old"]) });
+        buffer.push(ListChange::Reset { items: strings(&["a", "b"]) });
+        buffer.push(ListChange::Insert { index: 2, items: strings(&["c"]) });
+        buffer.push(ListChange::Replace { index: 0, items: strings(&["A"]) });
+        buffer.push(ListChange::Move { from: 0, to: 2 });
+
+        assert_eq!(buffer.take(), vec![ListChange::Reset { items: strings(&["b", "c", "A"]) }]);
+    }
+
+    #[test]
+    fn test_collection_changes_are_buffered() {
+        let collection = ObservableCollection::new();
+        let buffer = ListChangeBuffer::new();
+        buffer.attach(&collection, |item: &i32| item.to_string());
+
+        collection.push(1);
+        collection.push(2);
+        collection.replace(0, 5);
+        assert_eq!(buffer.len(), 2);
+
+        collection.clear();
+        collection.push(7);
+        assert_eq!(buffer.take(), vec![ListChange::Reset { items: strings(&["7"]) }]);
+    }
+}
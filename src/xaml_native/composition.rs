@@ -0,0 +1,366 @@
+//! Composition animations on an element's visual.
+//!
+//! Storyboard animations of layout properties such as Width run on the UI
+//! thread and stutter whenever it is busy. [`VisualAnimation`] animates the
+//! element's composition visual instead, which the compositor thread drives
+//! on its own.
+
+use super::{ffi, to_wide_string, XamlScrollViewer, XamlStoryboard, XamlUIElement};
+use crate::error::{Error, Result};
+
+/// A property of an element's composition visual.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum VisualProperty {
+    /// Translation in pixels (x, y, z). The layout position is unchanged.
+    Offset,
+    /// Scale factors (x, y, z) around the element's center.
+    Scale,
+    /// Opacity from 0.0 to 1.0.
+    Opacity,
+    /// Clockwise rotation in degrees around the element's center.
+    Rotation,
+    /// Clip insets in pixels (left, top, right, bottom).
+    Clip,
+}
+
+impl VisualProperty {
+    fn to_ffi(self) -> i32 {
+        match self {
+            VisualProperty::Offset => ffi::XAML_VISUAL_OFFSET,
+            VisualProperty::Scale => ffi::XAML_VISUAL_SCALE,
+            VisualProperty::Opacity => ffi::XAML_VISUAL_OPACITY,
+            VisualProperty::Rotation => ffi::XAML_VISUAL_ROTATION,
+            VisualProperty::Clip => ffi::XAML_VISUAL_CLIP,
+        }
+    }
+}
+
+/// A keyframe animation of one visual property.
+///
+/// # Example
+///
+/// ```rust,no_run
+/// use winrt_xaml::xaml_native::{VisualAnimation, VisualProperty, XamlButton};
+///
+/// let button = XamlButton::new()?;
+/// VisualAnimation::new(VisualProperty::Offset, 300)
+///     .vector(0.0, -40.0, 0.0, 0.0)
+///     .vector(1.0, 0.0, 0.0, 0.0)
+///     .start(&button.as_uielement())?;
+/// # Ok::<(), winrt_xaml::Error>(())
+/// ```
+#[derive(Debug, Clone, PartialEq)]
+pub struct VisualAnimation {
+    property: VisualProperty,
+    duration_ms: u32,
+    delay_ms: u32,
+    iterations: u32,
+    keyframes: Vec<ffi::XamlVisualKeyFrame>,
+}
+
+impl VisualAnimation {
+    /// Create an animation that plays once over `duration_ms`.
+    pub fn new(property: VisualProperty, duration_ms: u32) -> Self {
+        Self {
+            property,
+            duration_ms,
+            delay_ms: 0,
+            iterations: 1,
+            keyframes: Vec::new(),
+        }
+    }
+
+    /// Add a keyframe for Opacity or Rotation. `progress` runs from 0.0 to 1.0.
+    pub fn scalar(self, progress: f32, value: f32) -> Self {
+        self.keyframe(progress, [value, 0.0, 0.0, 0.0])
+    }
+
+    /// Add a keyframe for Offset or Scale.
+    pub fn vector(self, progress: f32, x: f32, y: f32, z: f32) -> Self {
+        self.keyframe(progress, [x, y, z, 0.0])
+    }
+
+    /// Add a keyframe for Clip.
+    pub fn insets(self, progress: f32, left: f32, top: f32, right: f32, bottom: f32) -> Self {
+        self.keyframe(progress, [left, top, right, bottom])
+    }
+
+    fn keyframe(mut self, progress: f32, value: [f32; 4]) -> Self {
+        self.keyframes.push(ffi::XamlVisualKeyFrame { progress, value });
+        self
+    }
+
+    /// Wait before starting.
+    pub fn delay_ms(mut self, milliseconds: u32) -> Self {
+        self.delay_ms = milliseconds;
+        self
+    }
+
+    /// Play `count` times.
+    pub fn iterations(mut self, count: u32) -> Self {
+        self.iterations = count.max(1);
+        self
+    }
+
+    /// Repeat until stopped.
+    pub fn repeat_forever(mut self) -> Self {
+        self.iterations = 0;
+        self
+    }
+
+    /// The animated property.
+    pub fn property(&self) -> VisualProperty {
+        self.property
+    }
+
+    /// Start on `element`, replacing any running animation of the same property.
+    pub fn start(&self, element: &XamlUIElement) -> Result<()> {
+        let result = unsafe { ffi::xaml_element_start_animation(element.handle(), &self.to_ffi()) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to start composition animation"));
+        }
+        Ok(())
+    }
+
+    /// Start on every element in one bridge call, delaying element `i` by a
+    /// further `i * stagger_ms` milliseconds.
+    pub fn start_staggered(&self, elements: &[&XamlUIElement], stagger_ms: u32) -> Result<()> {
+        let handles: Vec<ffi::XamlUIElementHandle> = elements.iter().map(|element| element.handle()).collect();
+        let result = unsafe {
+            ffi::xaml_element_animate_staggered(
+                handles.as_ptr(),
+                handles.len() as i32,
+                &self.to_ffi(),
+                clamp_ms(stagger_ms),
+            )
+        };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to start staggered composition animation"));
+        }
+        Ok(())
+    }
+
+    fn to_ffi(&self) -> ffi::XamlVisualAnimation {
+        ffi::XamlVisualAnimation {
+            property: self.property.to_ffi(),
+            duration_ms: clamp_ms(self.duration_ms),
+            delay_ms: clamp_ms(self.delay_ms),
+            iterations: clamp_ms(self.iterations),
+            keyframes: self.keyframes.as_ptr(),
+            keyframe_count: self.keyframes.len() as i32,
+        }
+    }
+}
+
+fn clamp_ms(value: u32) -> i32 {
+    value.min(i32::MAX as u32) as i32
+}
+
+impl XamlUIElement {
+    /// Stop the composition animation of `property`, leaving its current value.
+    pub fn stop_animation(&self, property: VisualProperty) -> Result<()> {
+        let result = unsafe { ffi::xaml_element_stop_animation(self.handle(), property.to_ffi()) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to stop composition animation"));
+        }
+        Ok(())
+    }
+
+    /// Animate layout and visibility changes on the compositor thread.
+    ///
+    /// Once set, inserting siblings, resizing or toggling visibility animates
+    /// over `duration_ms` without further calls. `ImplicitAnimations::default()`
+    /// removes them.
+    ///
+    /// # Example
+    ///
+    /// ```rust,no_run
+    /// use winrt_xaml::xaml_native::{ImplicitAnimations, XamlButton};
+    ///
+    /// let button = XamlButton::new()?;
+    /// button.as_uielement().set_implicit_animations(ImplicitAnimations::all(), 200)?;
+    /// # Ok::<(), winrt_xaml::Error>(())
+    /// ```
+    pub fn set_implicit_animations(&self, animations: ImplicitAnimations, duration_ms: u32) -> Result<()> {
+        let result = unsafe {
+            ffi::xaml_element_set_implicit_animations(self.handle(), animations.to_ffi(), clamp_ms(duration_ms))
+        };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to set implicit animations"));
+        }
+        Ok(())
+    }
+}
+
+impl XamlScrollViewer {
+    /// Drive `property` of `target` from this viewer's scroll position.
+    ///
+    /// `expression` is a composition expression in which `scroll` is the
+    /// viewer's manipulation property set; `scroll.Translation` is the negated
+    /// scroll offset. Offset and Scale expressions produce a `Vector3`,
+    /// Opacity and Rotation a scalar. The binding runs on the compositor
+    /// thread, so parallax and sticky headers track scrolling without any
+    /// per-frame calls. [`XamlUIElement::stop_animation`] removes it.
+    ///
+    /// # Example
+    ///
+    /// ```rust,no_run
+    /// use winrt_xaml::xaml_native::{VisualProperty, XamlScrollViewer, XamlTextBlock};
+    ///
+    /// let viewer = XamlScrollViewer::new()?;
+    /// let header = XamlTextBlock::new()?;
+    /// // Move the header at half the scroll speed.
+    /// viewer.bind_expression(
+    ///     &header.as_uielement(),
+    ///     VisualProperty::Offset,
+    ///     "Vector3(0, -scroll.Translation.Y * 0.5, 0)",
+    /// )?;
+    /// # Ok::<(), winrt_xaml::Error>(())
+    /// ```
+    pub fn bind_expression(&self, target: &XamlUIElement, property: VisualProperty, expression: &str) -> Result<()> {
+        if property == VisualProperty::Clip {
+            return Err(Error::invalid_operation("Scroll expressions cannot drive Clip"));
+        }
+        let expression = to_wide_string(expression);
+        let result = unsafe {
+            ffi::xaml_bind_scroll_expression(self.handle, target.handle(), property.to_ffi(), expression.as_ptr())
+        };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to bind scroll expression"));
+        }
+        Ok(())
+    }
+}
+
+/// Which layout and visibility changes animate on their own.
+///
+/// See [`XamlUIElement::set_implicit_animations`].
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct ImplicitAnimations {
+    /// Ease to the position layout assigns, e.g. when a sibling is inserted.
+    pub offset: bool,
+    /// Ease to the size layout assigns.
+    pub size: bool,
+    /// Fade in when shown or added to the tree.
+    pub show: bool,
+    /// Fade out when hidden or removed from the tree.
+    pub hide: bool,
+}
+
+impl ImplicitAnimations {
+    /// Every implicit animation.
+    pub fn all() -> Self {
+        Self {
+            offset: true,
+            size: true,
+            show: true,
+            hide: true,
+        }
+    }
+
+    fn to_ffi(self) -> i32 {
+        let mut flags = 0;
+        if self.offset {
+            flags |= ffi::XAML_IMPLICIT_OFFSET;
+        }
+        if self.size {
+            flags |= ffi::XAML_IMPLICIT_SIZE;
+        }
+        if self.show {
+            flags |= ffi::XAML_IMPLICIT_SHOW;
+        }
+        if self.hide {
+            flags |= ffi::XAML_IMPLICIT_HIDE;
+        }
+        flags
+    }
+}
+
+/// Animation counters since the bridge was loaded.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct AnimationStats {
+    /// Composition animations started with [`VisualAnimation::start`].
+    pub composition_started: u64,
+    /// Storyboard animations that ran on the compositor thread.
+    pub storyboard_independent: u64,
+    /// Storyboard animations that fell back to the UI thread.
+    pub storyboard_dependent: u64,
+    /// Storyboards that ran to completion.
+    pub storyboards_completed: u64,
+    /// Storyboards currently running.
+    pub running_storyboards: u64,
+    /// Animations in running storyboards.
+    pub active_animations: u64,
+    /// Animations in running storyboards that run on the UI thread.
+    pub active_dependent: u64,
+}
+
+/// Read the bridge's animation counters.
+pub fn animation_stats() -> Result<AnimationStats> {
+    let mut stats = ffi::XamlAnimationStats::default();
+    let result = unsafe { ffi::xaml_animation_get_stats(&mut stats) };
+    if result != 0 {
+        return Err(Error::invalid_operation("Failed to read animation stats"));
+    }
+    Ok(AnimationStats {
+        composition_started: stats.composition_started,
+        storyboard_independent: stats.storyboard_independent,
+        storyboard_dependent: stats.storyboard_dependent,
+        storyboards_completed: stats.storyboards_completed,
+        running_storyboards: stats.running_storyboards,
+        active_animations: stats.active_animations,
+        active_dependent: stats.active_dependent,
+    })
+}
+
+/// Cap the number of animations running in storyboards at once.
+///
+/// While the cap is reached, [`XamlStoryboard::begin`] fails instead of
+/// starting more. `None` removes the cap.
+pub fn set_active_animation_limit(limit: Option<u32>) -> Result<()> {
+    let limit = limit.map_or(0, |limit| limit.clamp(1, i32::MAX as u32) as i32);
+    let result = unsafe { ffi::xaml_animation_set_active_limit(limit) };
+    if result != 0 {
+        return Err(Error::invalid_operation("Failed to set active animation limit"));
+    }
+    Ok(())
+}
+
+impl XamlStoryboard {
+    /// Indices of the animations in this storyboard that run on the UI thread.
+    ///
+    /// Width, Height, Margin and other layout properties are dependent;
+    /// Opacity, render transforms and brush colors run on the compositor.
+    pub fn dependent_animations(&self) -> Result<Vec<usize>> {
+        let count = unsafe { ffi::xaml_storyboard_get_dependent_animations(self.handle(), std::ptr::null_mut(), 0) };
+        if count < 0 {
+            return Err(Error::invalid_operation("Failed to classify storyboard animations"));
+        }
+        let mut indices = vec![0i32; count as usize];
+        let written = unsafe {
+            ffi::xaml_storyboard_get_dependent_animations(self.handle(), indices.as_mut_ptr(), count)
+        };
+        if written < 0 {
+            return Err(Error::invalid_operation("Failed to classify storyboard animations"));
+        }
+        indices.truncate(written.min(count) as usize);
+        Ok(indices.into_iter().map(|index| index as usize).collect())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_implicit_animation_flags() {
+        assert_eq!(ImplicitAnimations::default().to_ffi(), 0);
+        assert_eq!(ImplicitAnimations::all().to_ffi(), 0xF);
+        let layout = ImplicitAnimations {
+            offset: true,
+            size: true,
+            ..Default::default()
+        };
+        assert_eq!(layout.to_ffi(), ffi::XAML_IMPLICIT_OFFSET | ffi::XAML_IMPLICIT_SIZE);
+    }
+}
@@ -0,0 +1,100 @@
+//! Control templates parsed from XAML markup.
+//!
+//! A template's visual tree can only be described in markup. The bridge
+//! parses each distinct markup string once per UI thread and hands out the
+//! cached template afterwards, so a custom button look costs one parse no
+//! matter how many buttons use it.
+
+use super::{ffi, to_wide_string, XamlButton};
+use crate::error::{Error, Result};
+
+/// A `ControlTemplate` shared by every control it is set on.
+///
+/// # Example
+/// ```no_run
+/// use winrt_xaml::xaml_native::{XamlButton, XamlControlTemplate};
+///
+/// const PILL: &str = r#"<ControlTemplate TargetType="Button">
+///     <Border Background="{TemplateBinding Background}" CornerRadius="16" Padding="12,6">
+///         <ContentPresenter HorizontalAlignment="Center" />
+///     </Border>
+/// </ControlTemplate>"#;
+///
+/// for _ in 0..100 {
+///     let button = XamlButton::new()?;
+///     // Parsed on the first call, served from the cache afterwards.
+///     button.set_template(&XamlControlTemplate::from_markup(PILL)?)?;
+/// }
+/// assert_eq!(XamlControlTemplate::cache_stats()?.misses, 1);
+/// # Ok::<(), winrt_xaml::Error>(())
+/// ```
+pub struct XamlControlTemplate {
+    handle: ffi::XamlControlTemplateHandle,
+}
+
+/// Template cache counters, see [`XamlControlTemplate::cache_stats`].
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct TemplateCacheStats {
+    /// `from_markup` calls answered from the cache.
+    pub hits: u64,
+    /// `from_markup` calls that parsed markup.
+    pub misses: u64,
+    /// Templates cached for the calling thread.
+    pub cached_templates: u32,
+}
+
+impl XamlControlTemplate {
+    /// Parse a `<ControlTemplate>` or reuse the one already parsed from the
+    /// same markup. The default XAML namespaces are added when the markup
+    /// declares none.
+    pub fn from_markup(markup: &str) -> Result<Self> {
+        let markup = to_wide_string(markup);
+        let handle = unsafe { ffi::xaml_control_template_from_markup(markup.as_ptr()) };
+        if handle.0.is_null() {
+            return Err(Error::control_creation("Failed to parse control template markup"));
+        }
+        Ok(Self { handle })
+    }
+
+    /// Cache hits and misses on the calling thread since the bridge was loaded.
+    pub fn cache_stats() -> Result<TemplateCacheStats> {
+        let mut stats = ffi::XamlTemplateCacheStats::default();
+        let result = unsafe { ffi::xaml_control_template_get_cache_stats(&mut stats) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to read template cache stats"));
+        }
+        Ok(TemplateCacheStats {
+            hits: stats.hits,
+            misses: stats.misses,
+            cached_templates: stats.cached_templates,
+        })
+    }
+
+    /// Drop the calling thread's cached templates. Controls keep theirs.
+    pub fn clear_cache() -> Result<()> {
+        let result = unsafe { ffi::xaml_control_template_clear_cache() };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to clear template cache"));
+        }
+        Ok(())
+    }
+}
+
+impl Drop for XamlControlTemplate {
+    fn drop(&mut self) {
+        unsafe {
+            ffi::xaml_control_template_destroy(self.handle);
+        }
+    }
+}
+
+impl XamlButton {
+    /// Replace the button's control template.
+    pub fn set_template(&self, template: &XamlControlTemplate) -> Result<()> {
+        let result = unsafe { ffi::xaml_button_set_template(self.handle, template.handle) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to set button template"));
+        }
+        Ok(())
+    }
+}
@@ -130,6 +130,334 @@ pub struct XamlColorAnimationHandle(pub *mut c_void);
 unsafe impl Send for XamlColorAnimationHandle {}
 unsafe impl Sync for XamlColorAnimationHandle {}
 
+#[repr(C)]
+#[derive(Clone, Copy)]
+pub struct XamlKeyFrameAnimationHandle(pub *mut c_void);
+unsafe impl Send for XamlKeyFrameAnimationHandle {}
+unsafe impl Sync for XamlKeyFrameAnimationHandle {}
+
+#[repr(C)]
+#[derive(Clone, Copy)]
+pub struct XamlStoryboardTemplateHandle(pub *mut c_void);
+unsafe impl Send for XamlStoryboardTemplateHandle {}
+unsafe impl Sync for XamlStoryboardTemplateHandle {}
+
+#[repr(C)]
+#[derive(Clone, Copy)]
+pub struct XamlStyleHandle(pub *mut c_void);
+unsafe impl Send for XamlStyleHandle {}
+unsafe impl Sync for XamlStyleHandle {}
+
+#[repr(C)]
+#[derive(Clone, Copy)]
+pub struct XamlLogViewHandle(pub *mut c_void);
+unsafe impl Send for XamlLogViewHandle {}
+unsafe impl Sync for XamlLogViewHandle {}
+
+#[repr(C)]
+#[derive(Clone, Copy)]
+pub struct XamlViewModelHandle(pub *mut c_void);
+unsafe impl Send for XamlViewModelHandle {}
+unsafe impl Sync for XamlViewModelHandle {}
+
+/// Sort key for `xaml_listview_set_sort` (mirrors `XamlSortKey`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct XamlSortKey {
+    pub kind: i32,
+    pub column: i32,
+    pub descending: i32,
+}
+
+/// Filter for `xaml_listview_set_filter` (mirrors `XamlFilterSpec`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct XamlFilterSpec {
+    pub kind: i32,
+    pub flags: i32,
+    pub text: *const u16,
+    pub min: f64,
+    pub max: f64,
+    pub column: i32,
+}
+
+pub const XAML_FILTER_IGNORE_CASE: i32 = 0x1;
+
+/// Collection-change record for `xaml_*_apply_changes` (mirrors `XamlCollectionChange`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct XamlCollectionChange {
+    pub kind: i32,
+    pub index: i32,
+    pub count: i32,
+    pub new_index: i32,
+    pub items: *const *const u16,
+}
+
+pub const XAML_CHANGE_INSERT: i32 = 0;
+pub const XAML_CHANGE_REMOVE: i32 = 1;
+pub const XAML_CHANGE_REPLACE: i32 = 2;
+pub const XAML_CHANGE_MOVE: i32 = 3;
+pub const XAML_CHANGE_RESET: i32 = 4;
+
+/// Animation description for storyboard templates (mirrors `XamlAnimSpec`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct XamlAnimSpec {
+    pub kind: i32,
+    pub flags: i32,
+    pub property_path: *const u16,
+    pub from: f64,
+    pub to: f64,
+    pub from_color: u32,
+    pub to_color: u32,
+    pub duration_ms: i32,
+    pub begin_ms: i32,
+    pub easing: i32,
+}
+
+pub const XAML_ANIM_DOUBLE: i32 = 0;
+pub const XAML_ANIM_COLOR: i32 = 1;
+pub const XAML_ANIM_HAS_FROM: i32 = 0x1;
+
+/// Keyframe for `xaml_element_start_animation` (mirrors `XamlVisualKeyFrame`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq)]
+pub struct XamlVisualKeyFrame {
+    pub progress: f32,
+    pub value: [f32; 4],
+}
+
+/// Composition animation spec (mirrors `XamlVisualAnimation`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct XamlVisualAnimation {
+    pub property: i32,
+    pub duration_ms: i32,
+    pub delay_ms: i32,
+    pub iterations: i32,
+    pub keyframes: *const XamlVisualKeyFrame,
+    pub keyframe_count: i32,
+}
+
+pub const XAML_VISUAL_OFFSET: i32 = 0;
+pub const XAML_VISUAL_SCALE: i32 = 1;
+pub const XAML_VISUAL_OPACITY: i32 = 2;
+pub const XAML_VISUAL_ROTATION: i32 = 3;
+pub const XAML_VISUAL_CLIP: i32 = 4;
+
+/// Hidden-island bookkeeping (mirrors `XamlSourceActivity`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct XamlSourceActivity {
+    pub visible: i32,
+    pub suspended: i32,
+    pub paused_storyboards: u32,
+    pub paused_progress_bars: u32,
+    pub suspensions: u64,
+    pub hidden_ms: u64,
+    pub suspended_animation_ms: u64,
+}
+
+pub const XAML_FRAME_INTERVAL_BUCKETS: usize = 11;
+pub const XAML_FRAME_WORK_BUCKETS: usize = 12;
+
+/// Frame pacing counters (mirrors `XamlFrameStats`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq)]
+pub struct XamlFrameStats {
+    pub frames: u64,
+    pub missed_frames: u64,
+    pub bridge_calls: u64,
+    pub refresh_ms: f64,
+    pub mean_interval_ms: f64,
+    pub max_interval_ms: f64,
+    pub interval_buckets: [u64; XAML_FRAME_INTERVAL_BUCKETS],
+    pub work_buckets: [u64; XAML_FRAME_WORK_BUCKETS],
+}
+
+/// Styled span of a TextBlock (mirrors `XamlRunSpec`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct XamlRunSpec {
+    pub start: i32,
+    pub length: i32,
+    pub foreground: u32,
+    pub weight: i32,
+    pub italic: i32,
+}
+
+pub const XAML_NUMBER_GROUPING: i32 = 0x1;
+pub const XAML_NUMBER_PLUS_SIGN: i32 = 0x2;
+
+/// Numeric TextBlock format (mirrors `XamlNumberFormat`). Null `prefix` and
+/// `suffix` pointers mean none; zero separators mean '.' and ','.
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct XamlNumberFormat {
+    pub precision: i32,
+    pub flags: i32,
+    pub decimal_point: u16,
+    pub group_separator: u16,
+    pub prefix: *const u16,
+    pub suffix: *const u16,
+}
+
+/// Log view counters (mirrors `XamlLogViewStats`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct XamlLogViewStats {
+    pub first_line: u64,
+    pub end_line: u64,
+    pub dropped_lines: u64,
+    pub top_line: u64,
+    pub visible_rows: u32,
+    pub follow_tail: i32,
+    pub appends: u64,
+    pub redraws: u64,
+}
+
+/// String table state (mirrors `XamlStringTableInfo`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct XamlStringTableInfo {
+    pub count: u32,
+    pub bound_elements: u32,
+    pub generation: u64,
+    pub cache_hits: u64,
+    pub cache_misses: u64,
+    pub locale: [u16; 32],
+}
+
+/// Control template cache counters (mirrors `XamlTemplateCacheStats`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct XamlTemplateCacheStats {
+    pub hits: u64,
+    pub misses: u64,
+    pub cached_templates: u32,
+}
+
+/// One slot write for `xaml_viewmodel_write` (mirrors `XamlSlotWrite`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct XamlSlotWrite {
+    pub slot: u32,
+    pub text_length: i32,
+    pub number: f64,
+    pub text: *const u16,
+}
+
+/// View model counters (mirrors `XamlViewModelStats`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct XamlViewModelStats {
+    pub slots: u32,
+    pub writes: u64,
+    pub changes: u64,
+    pub notifications: u64,
+    pub flushes: u64,
+}
+
+// View model slot kinds (mirrors `XamlSlotKind`)
+pub const XAML_SLOT_NUMBER: i32 = 0;
+pub const XAML_SLOT_INTEGER: i32 = 1;
+pub const XAML_SLOT_BOOLEAN: i32 = 2;
+pub const XAML_SLOT_TEXT: i32 = 3;
+
+// Bindable element properties (mirrors `XamlElementProperty`)
+pub const XAML_PROP_TEXT: i32 = 0;
+pub const XAML_PROP_CONTENT: i32 = 1;
+pub const XAML_PROP_VALUE: i32 = 2;
+pub const XAML_PROP_IS_CHECKED: i32 = 3;
+pub const XAML_PROP_SELECTED_INDEX: i32 = 4;
+pub const XAML_PROP_IS_ENABLED: i32 = 5;
+pub const XAML_PROP_OPACITY: i32 = 6;
+pub const XAML_PROP_WIDTH: i32 = 7;
+pub const XAML_PROP_HEIGHT: i32 = 8;
+pub const XAML_PROP_IS_ON: i32 = 9;
+pub const XAML_PROP_HORIZONTAL_OFFSET: i32 = 10;
+pub const XAML_PROP_VERTICAL_OFFSET: i32 = 11;
+
+/// One coalesced property change (mirrors `XamlPropertyChange`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct XamlPropertyChange {
+    pub tag: u64,
+    pub property: i32,
+    pub kind: i32,
+    pub old_number: f64,
+    pub new_number: f64,
+    pub old_text: *const u16,
+    pub new_text: *const u16,
+}
+
+pub type XamlPropertyChangeCallback = extern "C" fn(changes: *const XamlPropertyChange, count: i32, user_data: *mut c_void);
+
+// Style target types (mirrors `XamlStyleTarget`)
+pub const XAML_STYLE_BUTTON: i32 = 0;
+pub const XAML_STYLE_TEXTBLOCK: i32 = 1;
+pub const XAML_STYLE_TEXTBOX: i32 = 2;
+pub const XAML_STYLE_STACKPANEL: i32 = 3;
+pub const XAML_STYLE_GRID: i32 = 4;
+pub const XAML_STYLE_CHECKBOX: i32 = 5;
+pub const XAML_STYLE_COMBOBOX: i32 = 6;
+pub const XAML_STYLE_SLIDER: i32 = 7;
+pub const XAML_STYLE_PROGRESSBAR: i32 = 8;
+pub const XAML_STYLE_RADIOBUTTON: i32 = 9;
+pub const XAML_STYLE_LISTVIEW: i32 = 10;
+pub const XAML_STYLE_SCROLLVIEWER: i32 = 11;
+pub const XAML_STYLE_IMAGE: i32 = 12;
+
+// Style properties (mirrors `XamlStyleProperty`)
+pub const XAML_STYLE_BACKGROUND: i32 = 0;
+pub const XAML_STYLE_FOREGROUND: i32 = 1;
+pub const XAML_STYLE_BORDER_BRUSH: i32 = 2;
+pub const XAML_STYLE_BORDER_THICKNESS: i32 = 3;
+pub const XAML_STYLE_CORNER_RADIUS: i32 = 4;
+pub const XAML_STYLE_PADDING: i32 = 5;
+pub const XAML_STYLE_MARGIN: i32 = 6;
+pub const XAML_STYLE_WIDTH: i32 = 7;
+pub const XAML_STYLE_HEIGHT: i32 = 8;
+pub const XAML_STYLE_OPACITY: i32 = 9;
+pub const XAML_STYLE_FONT_SIZE: i32 = 10;
+pub const XAML_STYLE_FONT_WEIGHT: i32 = 11;
+pub const XAML_STYLE_HORIZONTAL_ALIGNMENT: i32 = 12;
+pub const XAML_STYLE_VERTICAL_ALIGNMENT: i32 = 13;
+
+/// Value of one style setter (mirrors `XamlStyleValue`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq)]
+pub struct XamlStyleValue {
+    pub color: u32,
+    pub number: f64,
+    pub left: f64,
+    pub top: f64,
+    pub right: f64,
+    pub bottom: f64,
+}
+
+pub const XAML_IMPLICIT_OFFSET: i32 = 0x1;
+pub const XAML_IMPLICIT_SIZE: i32 = 0x2;
+pub const XAML_IMPLICIT_SHOW: i32 = 0x4;
+pub const XAML_IMPLICIT_HIDE: i32 = 0x8;
+
+/// Animation counters (mirrors `XamlAnimationStats`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct XamlAnimationStats {
+    pub composition_started: u64,
+    pub storyboard_independent: u64,
+    pub storyboard_dependent: u64,
+    pub storyboards_completed: u64,
+    pub running_storyboards: u64,
+    pub active_animations: u64,
+    pub active_dependent: u64,
+}
+
+pub const XAML_SEARCH_IGNORE_CASE: i32 = 0x1;
+pub const XAML_SEARCH_APPLY_FILTER: i32 = 0x2;
+
 // Raw FFI functions
 #[link(name = "xaml_islands_helper", kind = "dylib")]
 extern "C" {
@@ -140,6 +468,10 @@ extern "C" {
     pub fn xaml_source_destroy(source: XamlSourceHandle);
     pub fn xaml_source_attach_to_window(source: XamlSourceHandle, parent_hwnd: HWND) -> HWND;
     pub fn xaml_source_set_size(source: XamlSourceHandle, width: i32, height: i32) -> i32;
+    pub fn xaml_source_set_visible(source: XamlSourceHandle, visible: i32) -> i32;
+    pub fn xaml_source_get_activity(source: XamlSourceHandle, activity: *mut XamlSourceActivity) -> i32;
+    pub fn xaml_source_enable_frame_stats(source: XamlSourceHandle, enabled: i32) -> i32;
+    pub fn xaml_source_get_frame_stats(source: XamlSourceHandle, stats: *mut XamlFrameStats) -> i32;
     pub fn xaml_source_set_content(source: XamlSourceHandle, button: XamlButtonHandle) -> i32;
     pub fn xaml_source_set_content_generic(source: XamlSourceHandle, element: XamlUIElementHandle) -> i32;
 
@@ -153,11 +485,16 @@ extern "C" {
     pub fn xaml_textblock_destroy(textblock: XamlTextBlockHandle);
     pub fn xaml_textblock_set_text(textblock: XamlTextBlockHandle, text: *const u16) -> i32;
     pub fn xaml_textblock_set_font_size(textblock: XamlTextBlockHandle, size: f64) -> i32;
+    pub fn xaml_textblock_set_runs(textblock: XamlTextBlockHandle, text: *const u16, runs: *const XamlRunSpec, count: i32) -> i32;
+    pub fn xaml_textblock_set_number(textblock: XamlTextBlockHandle, value: f64, format: *const XamlNumberFormat) -> i32;
 
     pub fn xaml_textbox_create() -> XamlTextBoxHandle;
     pub fn xaml_textbox_destroy(textbox: XamlTextBoxHandle);
     pub fn xaml_textbox_set_text(textbox: XamlTextBoxHandle, text: *const u16) -> i32;
     pub fn xaml_textbox_get_text(textbox: XamlTextBoxHandle, buffer: *mut u16, buffer_size: i32) -> i32;
+    pub fn xaml_textbox_get_text_length(textbox: XamlTextBoxHandle) -> i32;
+    pub fn xaml_textbox_append(textbox: XamlTextBoxHandle, text: *const u16, text_length: i32) -> i32;
+    pub fn xaml_textbox_replace_range(textbox: XamlTextBoxHandle, start: i32, length: i32, text: *const u16, text_length: i32) -> i32;
     pub fn xaml_textbox_set_placeholder(textbox: XamlTextBoxHandle, placeholder: *const u16) -> i32;
     pub fn xaml_textbox_set_size(textbox: XamlTextBoxHandle, width: f64, height: f64) -> i32;
 
@@ -213,6 +550,7 @@ extern "C" {
     pub fn xaml_combobox_add_item(combobox: XamlComboBoxHandle, item: *const u16) -> i32;
     pub fn xaml_combobox_set_selected_index(combobox: XamlComboBoxHandle, index: i32) -> i32;
     pub fn xaml_combobox_get_selected_index(combobox: XamlComboBoxHandle) -> i32;
+    pub fn xaml_combobox_apply_changes(combobox: XamlComboBoxHandle, changes: *const XamlCollectionChange, change_count: i32) -> i32;
 
     // Slider APIs
     pub fn xaml_slider_create() -> XamlSliderHandle;
@@ -283,6 +621,49 @@ extern "C" {
     pub fn xaml_listview_on_selection_changed(listview: XamlListViewHandle, callback_ptr: *mut c_void);
     pub fn xaml_listview_set_selection_mode(listview: XamlListViewHandle, mode: i32) -> i32;
     pub fn xaml_listview_as_uielement(listview: XamlListViewHandle) -> XamlUIElementHandle;
+    pub fn xaml_listview_set_sort(listview: XamlListViewHandle, keys: *const XamlSortKey, key_count: i32) -> i32;
+    pub fn xaml_listview_set_filter(listview: XamlListViewHandle, filter: *const XamlFilterSpec) -> i32;
+    pub fn xaml_listview_set_column_values(listview: XamlListViewHandle, column: i32, values: *const f64, count: i32) -> i32;
+    pub fn xaml_listview_search(listview: XamlListViewHandle, query: *const u16, flags: i32, out_indices: *mut i32, capacity: i32) -> i32;
+    pub fn xaml_listview_set_grouped_items(listview: XamlListViewHandle, items: *const *const u16, group_keys: *const *const u16, count: i32) -> i32;
+    pub fn xaml_listview_add_grouped_item(listview: XamlListViewHandle, item: *const u16, group_key: *const u16) -> i32;
+    pub fn xaml_listview_set_item_group(listview: XamlListViewHandle, index: i32, group_key: *const u16) -> i32;
+    pub fn xaml_listview_apply_changes(listview: XamlListViewHandle, changes: *const XamlCollectionChange, change_count: i32) -> i32;
+    pub fn xaml_listview_export_items(listview: XamlListViewHandle, start: i32, count: i32, buffer: *mut u16, capacity: usize, offsets: *mut u32) -> i32;
+    pub fn xaml_listview_get_selected_indices(listview: XamlListViewHandle, out_indices: *mut i32, capacity: i32) -> i32;
+
+    // Log view
+    pub fn xaml_logview_create(capacity: i32) -> XamlLogViewHandle;
+    pub fn xaml_logview_destroy(log: XamlLogViewHandle);
+    pub fn xaml_logview_append(log: XamlLogViewHandle, text: *const u16, length: i32) -> i32;
+    pub fn xaml_logview_clear(log: XamlLogViewHandle) -> i32;
+    pub fn xaml_logview_set_follow_tail(log: XamlLogViewHandle, follow: i32) -> i32;
+    pub fn xaml_logview_scroll_to(log: XamlLogViewHandle, line: u64) -> i32;
+    pub fn xaml_logview_get_stats(log: XamlLogViewHandle, stats: *mut XamlLogViewStats) -> i32;
+    pub fn xaml_logview_as_uielement(log: XamlLogViewHandle) -> XamlUIElementHandle;
+
+    // String tables
+    pub fn xaml_string_table_load(path: *const u16) -> i32;
+    pub fn xaml_string_table_unload() -> i32;
+    pub fn xaml_string_table_get_info(info: *mut XamlStringTableInfo) -> i32;
+    pub fn xaml_button_set_content_id(button: XamlButtonHandle, id: u32) -> i32;
+    pub fn xaml_textblock_set_text_id(textblock: XamlTextBlockHandle, id: u32) -> i32;
+
+    // View models
+    pub fn xaml_viewmodel_create() -> XamlViewModelHandle;
+    pub fn xaml_viewmodel_destroy(vm: XamlViewModelHandle);
+    pub fn xaml_viewmodel_add_slot(vm: XamlViewModelHandle, name: *const u16, kind: i32) -> i32;
+    pub fn xaml_viewmodel_write(vm: XamlViewModelHandle, writes: *const XamlSlotWrite, count: i32) -> i32;
+    pub fn xaml_viewmodel_bind(vm: XamlViewModelHandle, slot: u32, element: XamlUIElementHandle, property: i32) -> i32;
+    pub fn xaml_viewmodel_set_data_context(vm: XamlViewModelHandle, element: XamlUIElementHandle) -> i32;
+    pub fn xaml_viewmodel_get_stats(vm: XamlViewModelHandle, stats: *mut XamlViewModelStats) -> i32;
+    pub fn xaml_viewmodel_set_frame_callback(vm: XamlViewModelHandle, callback: Option<extern "C" fn(*mut c_void)>, user_data: *mut c_void) -> i32;
+    pub fn xaml_viewmodel_request_frame(vm: XamlViewModelHandle) -> i32;
+
+    // Property observation
+    pub fn xaml_set_property_observer(callback: Option<XamlPropertyChangeCallback>, user_data: *mut c_void) -> i32;
+    pub fn xaml_observe_property(element: XamlUIElementHandle, property: i32, tag: u64) -> i32;
+    pub fn xaml_unobserve_property(element: XamlUIElementHandle, property: i32, tag: u64) -> i32;
 
     // Resource Dictionary APIs
     pub fn xaml_resource_dictionary_create() -> XamlResourceDictionaryHandle;
@@ -301,6 +682,9 @@ extern "C" {
     pub fn xaml_control_template_create() -> XamlControlTemplateHandle;
     pub fn xaml_control_template_destroy(template_handle: XamlControlTemplateHandle);
     pub fn xaml_control_template_set_content(template_handle: XamlControlTemplateHandle, content: XamlUIElementHandle) -> i32;
+    pub fn xaml_control_template_from_markup(markup: *const u16) -> XamlControlTemplateHandle;
+    pub fn xaml_control_template_get_cache_stats(stats: *mut XamlTemplateCacheStats) -> i32;
+    pub fn xaml_control_template_clear_cache() -> i32;
     pub fn xaml_button_set_template(button: XamlButtonHandle, template_handle: XamlControlTemplateHandle) -> i32;
 
     // Animation APIs - Storyboard
@@ -313,6 +697,8 @@ extern "C" {
     pub fn xaml_storyboard_pause(storyboard: XamlStoryboardHandle) -> i32;
     pub fn xaml_storyboard_resume(storyboard: XamlStoryboardHandle) -> i32;
     pub fn xaml_storyboard_set_target(storyboard: XamlStoryboardHandle, target: XamlUIElementHandle) -> i32;
+    pub fn xaml_storyboard_on_completed(storyboard: XamlStoryboardHandle, callback: extern "C" fn(*mut c_void), user_data: *mut c_void) -> i32;
+    pub fn xaml_storyboard_get_dependent_animations(storyboard: XamlStoryboardHandle, out_indices: *mut i32, capacity: i32) -> i32;
 
     // Animation APIs - DoubleAnimation
     pub fn xaml_double_animation_create() -> XamlDoubleAnimationHandle;
@@ -330,5 +716,37 @@ extern "C" {
     pub fn xaml_color_animation_set_duration(animation: XamlColorAnimationHandle, milliseconds: i32) -> i32;
     pub fn xaml_color_animation_set_target_property(animation: XamlColorAnimationHandle, target: XamlUIElementHandle, property_path: *const u16) -> i32;
 
+    // Animation APIs - Keyframe animations
+    pub fn xaml_double_keyframe_animation_create() -> XamlKeyFrameAnimationHandle;
+    pub fn xaml_color_keyframe_animation_create() -> XamlKeyFrameAnimationHandle;
+    pub fn xaml_keyframe_animation_destroy(animation: XamlKeyFrameAnimationHandle);
+    pub fn xaml_keyframes_set(animation: XamlKeyFrameAnimationHandle, times: *const f32, values: *const f32, kinds: *const u8, count: i32) -> i32;
+    pub fn xaml_keyframe_animation_set_target_property(animation: XamlKeyFrameAnimationHandle, target: XamlUIElementHandle, property_path: *const u16) -> i32;
+    pub fn xaml_storyboard_add_keyframe_animation(storyboard: XamlStoryboardHandle, animation: XamlKeyFrameAnimationHandle) -> i32;
+
+    // Style APIs
+    pub fn xaml_style_create(target_type: i32) -> XamlStyleHandle;
+    pub fn xaml_style_destroy(style: XamlStyleHandle);
+    pub fn xaml_style_add_setter(style: XamlStyleHandle, property: i32, value: *const XamlStyleValue) -> i32;
+    pub fn xaml_element_set_style(element: XamlUIElementHandle, style: XamlStyleHandle) -> i32;
+    pub fn xaml_apply_style(style: XamlStyleHandle, elements: *const XamlUIElementHandle, count: i32) -> i32;
+
+    // Animation APIs - Storyboard templates
+    pub fn xaml_storyboard_template_create(animations: *const XamlAnimSpec, count: i32) -> XamlStoryboardTemplateHandle;
+    pub fn xaml_storyboard_template_destroy(template_handle: XamlStoryboardTemplateHandle);
+    pub fn xaml_storyboard_instantiate(template_handle: XamlStoryboardTemplateHandle, target: XamlUIElementHandle) -> XamlStoryboardHandle;
+    pub fn xaml_storyboard_template_recycle(template_handle: XamlStoryboardTemplateHandle, storyboard: XamlStoryboardHandle) -> i32;
+    pub fn xaml_storyboard_template_pooled_count(template_handle: XamlStoryboardTemplateHandle) -> i32;
+    pub fn xaml_animate_staggered(targets: *const XamlUIElementHandle, target_count: i32, animations: *const XamlAnimSpec, animation_count: i32, stagger_ms: i32) -> XamlStoryboardHandle;
+
+    // Composition animation APIs
+    pub fn xaml_element_start_animation(element: XamlUIElementHandle, animation: *const XamlVisualAnimation) -> i32;
+    pub fn xaml_element_stop_animation(element: XamlUIElementHandle, property: i32) -> i32;
+    pub fn xaml_element_animate_staggered(elements: *const XamlUIElementHandle, element_count: i32, animation: *const XamlVisualAnimation, stagger_ms: i32) -> i32;
+    pub fn xaml_bind_scroll_expression(scrollviewer: XamlScrollViewerHandle, target: XamlUIElementHandle, property: i32, expression: *const u16) -> i32;
+    pub fn xaml_element_set_implicit_animations(element: XamlUIElementHandle, flags: i32, duration_ms: i32) -> i32;
+    pub fn xaml_animation_get_stats(stats: *mut XamlAnimationStats) -> i32;
+    pub fn xaml_animation_set_active_limit(max_active_animations: i32) -> i32;
+
     pub fn xaml_get_last_error() -> *const u16;
 }
@@ -0,0 +1,177 @@
+//! Append-only log pane.
+//!
+//! Appending to a TextBox with `get_text` plus `set_text` copies the whole
+//! log for every line, and one ListView item per line grows without bound.
+//! [`XamlLogView`] keeps the newest lines in a fixed-size ring in the bridge
+//! and shows only the rows that fit. Appends take many lines per call from
+//! any thread, and the pane redraws at most once per frame.
+
+use super::{ffi, XamlUIElement};
+use crate::error::{Error, Result};
+
+/// Counters of a [`XamlLogView`]. Line numbers count every line ever
+/// appended, so they stay valid as old lines drop out of the ring.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct LogViewStats {
+    /// Oldest stored line.
+    pub first_line: u64,
+    /// One past the newest line, which is also the number of lines appended.
+    pub end_line: u64,
+    /// Lines pushed out of the ring by newer ones.
+    pub dropped_lines: u64,
+    /// First visible line.
+    pub top_line: u64,
+    pub visible_rows: u32,
+    pub follow_tail: bool,
+    /// Append calls.
+    pub appends: u64,
+    /// Frames that updated the visible rows.
+    pub redraws: u64,
+}
+
+/// A log pane backed by a ring buffer of the newest `capacity` lines.
+///
+/// The pane follows the tail until the user scrolls up. Scrolling back to the
+/// last line resumes following. Lines longer than 4,096 UTF-16 units are cut.
+///
+/// # Example
+/// ```no_run
+/// use winrt_xaml::xaml_native::XamlLogView;
+///
+/// let log = XamlLogView::new(10_000)?;
+/// let batch: Vec<String> = (0..500).map(|i| format!("worker {} done", i)).collect();
+/// log.append_lines(&batch)?;
+/// # Ok::<(), winrt_xaml::Error>(())
+/// ```
+pub struct XamlLogView {
+    handle: ffi::XamlLogViewHandle,
+}
+
+impl XamlLogView {
+    /// Create a log view on the UI thread.
+    pub fn new(capacity: usize) -> Result<Self> {
+        let capacity = i32::try_from(capacity).unwrap_or(i32::MAX);
+        let handle = unsafe { ffi::xaml_logview_create(capacity) };
+        if handle.0.is_null() {
+            return Err(Error::control_creation("Failed to create log view"));
+        }
+        Ok(Self { handle })
+    }
+
+    /// Append one or more `\n`-separated lines. Safe to call from any thread.
+    pub fn append(&self, text: &str) -> Result<()> {
+        self.append_wide(&text.encode_utf16().collect::<Vec<u16>>())
+    }
+
+    /// Append every line in one bridge call.
+    pub fn append_lines<I, S>(&self, lines: I) -> Result<()>
+    where
+        I: IntoIterator<Item = S>,
+        S: AsRef<str>,
+    {
+        self.append_wide(&encode_lines(lines))
+    }
+
+    fn append_wide(&self, wide: &[u16]) -> Result<()> {
+        if wide.is_empty() {
+            return Ok(());
+        }
+        let length = i32::try_from(wide.len()).map_err(|_| Error::invalid_operation("Log batch is too large"))?;
+        let result = unsafe { ffi::xaml_logview_append(self.handle, wide.as_ptr(), length) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to append to log view"));
+        }
+        Ok(())
+    }
+
+    /// Drop every stored line. Line numbers keep counting.
+    pub fn clear(&self) -> Result<()> {
+        let result = unsafe { ffi::xaml_logview_clear(self.handle) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to clear log view"));
+        }
+        Ok(())
+    }
+
+    /// Keep the newest line in view, or hold the current position.
+    pub fn set_follow_tail(&self, follow: bool) -> Result<()> {
+        let result = unsafe { ffi::xaml_logview_set_follow_tail(self.handle, follow as i32) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to set log view follow mode"));
+        }
+        Ok(())
+    }
+
+    /// Scroll so `line` is the first visible line.
+    pub fn scroll_to(&self, line: u64) -> Result<()> {
+        let result = unsafe { ffi::xaml_logview_scroll_to(self.handle, line) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to scroll log view"));
+        }
+        Ok(())
+    }
+
+    pub fn stats(&self) -> Result<LogViewStats> {
+        let mut raw = ffi::XamlLogViewStats::default();
+        let result = unsafe { ffi::xaml_logview_get_stats(self.handle, &mut raw) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to read log view stats"));
+        }
+        Ok(LogViewStats {
+            first_line: raw.first_line,
+            end_line: raw.end_line,
+            dropped_lines: raw.dropped_lines,
+            top_line: raw.top_line,
+            visible_rows: raw.visible_rows,
+            follow_tail: raw.follow_tail != 0,
+            appends: raw.appends,
+            redraws: raw.redraws,
+        })
+    }
+
+    /// Get as UIElement for adding to panels.
+    pub fn as_uielement(&self) -> XamlUIElement {
+        let handle = unsafe { ffi::xaml_logview_as_uielement(self.handle) };
+        XamlUIElement::from_handle(handle)
+    }
+}
+
+impl Drop for XamlLogView {
+    fn drop(&mut self) {
+        unsafe {
+            ffi::xaml_logview_destroy(self.handle);
+        }
+    }
+}
+
+unsafe impl Send for XamlLogView {}
+unsafe impl Sync for XamlLogView {}
+
+/// Join `lines` with `\n` as UTF-16.
+fn encode_lines<I, S>(lines: I) -> Vec<u16>
+where
+    I: IntoIterator<Item = S>,
+    S: AsRef<str>,
+{
+    let mut wide = Vec::new();
+    for (i, line) in lines.into_iter().enumerate() {
+        if i > 0 {
+            wide.push(u16::from(b'\n'));
+        }
+        wide.extend(line.as_ref().encode_utf16());
+    }
+    wide
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_encode_lines() {
+        let wide = encode_lines(["a", "", "ß"]);
+        assert_eq!(String::from_utf16(&wide).unwrap(), "a\n\nß");
+        assert!(encode_lines(Vec::<String>::new()).is_empty());
+        assert_eq!(encode_lines(vec![String::from("x")]), [u16::from(b'x')]);
+    }
+}
@@ -6,9 +6,31 @@
 pub mod ffi;
 mod resource_dictionary;
 mod animation;
+mod collection_changes;
+mod composition;
+mod control_template;
+mod log_view;
+mod number_text;
+mod property_binding;
+mod property_observer;
+mod rich_text;
+mod string_table;
+mod style;
+mod view_model;
 
 pub use resource_dictionary::*;
 pub use animation::*;
+pub use collection_changes::*;
+pub use composition::*;
+pub use control_template::*;
+pub use log_view::*;
+pub use number_text::*;
+pub use property_binding::*;
+pub use property_observer::*;
+pub use rich_text::*;
+pub use string_table::*;
+pub use style::*;
+pub use view_model::*;
 
 use crate::error::{Error, Result};
 use windows::Win32::Foundation::HWND;
@@ -100,6 +122,135 @@ impl XamlSource {
     pub fn island_hwnd(&self) -> Option<HWND> {
         self.island_hwnd
     }
+
+    /// Tell the bridge whether the island can be seen.
+    ///
+    /// Minimizing or hiding the host window is detected automatically. Call
+    /// this for cases the bridge cannot see, such as background tabs or
+    /// occluded windows. While hidden, the island's storyboards are paused
+    /// and its indeterminate progress bars stop animating.
+    pub fn set_visible(&self, visible: bool) -> Result<()> {
+        let result = unsafe { ffi::xaml_source_set_visible(self.handle, visible as i32) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to set source visibility"));
+        }
+        Ok(())
+    }
+
+    /// Report how much animation work was suspended while the island was hidden.
+    pub fn activity(&self) -> Result<SourceActivity> {
+        let mut activity = ffi::XamlSourceActivity::default();
+        let result = unsafe { ffi::xaml_source_get_activity(self.handle, &mut activity) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to read source activity"));
+        }
+        Ok(SourceActivity {
+            visible: activity.visible != 0,
+            suspended: activity.suspended != 0,
+            paused_storyboards: activity.paused_storyboards,
+            paused_progress_bars: activity.paused_progress_bars,
+            suspensions: activity.suspensions,
+            hidden_ms: activity.hidden_ms,
+            suspended_animation_ms: activity.suspended_animation_ms,
+        })
+    }
+
+    /// Start or stop recording frame pacing for this island.
+    ///
+    /// Recording hooks `CompositionTarget.Rendering`, which keeps XAML
+    /// rendering every frame, so leave it off outside of diagnostics.
+    /// Enabling again starts from empty stats. Frames and bridge calls are
+    /// those of the island's UI thread, so islands on one thread record the
+    /// same ticks and calls.
+    pub fn enable_frame_stats(&self, enabled: bool) -> Result<()> {
+        let result = unsafe { ffi::xaml_source_enable_frame_stats(self.handle, enabled as i32) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to enable frame stats"));
+        }
+        Ok(())
+    }
+
+    /// Read the frame pacing recorded so far. Can be called from any thread.
+    pub fn frame_stats(&self) -> Result<FrameStats> {
+        let mut stats = ffi::XamlFrameStats::default();
+        let result = unsafe { ffi::xaml_source_get_frame_stats(self.handle, &mut stats) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to read frame stats"));
+        }
+        Ok(FrameStats {
+            frames: stats.frames,
+            missed_frames: stats.missed_frames,
+            bridge_calls: stats.bridge_calls,
+            refresh_ms: stats.refresh_ms,
+            mean_interval_ms: stats.mean_interval_ms,
+            max_interval_ms: stats.max_interval_ms,
+            interval_buckets: stats.interval_buckets,
+            work_buckets: stats.work_buckets,
+        })
+    }
+}
+
+/// Frame pacing of the UI thread of one [`XamlSource`], recorded while that
+/// island is enabled and visible; see [`XamlSource::enable_frame_stats`].
+#[derive(Debug, Clone, Copy, Default, PartialEq)]
+pub struct FrameStats {
+    /// Frame intervals recorded.
+    pub frames: u64,
+    /// Intervals longer than 1.5 times the refresh interval.
+    pub missed_frames: u64,
+    /// Bridge calls made on the UI thread across the recorded frames.
+    pub bridge_calls: u64,
+    /// Estimated display refresh interval.
+    pub refresh_ms: f64,
+    pub mean_interval_ms: f64,
+    pub max_interval_ms: f64,
+    /// Interval histogram; the bucket upper bounds are [`FrameStats::INTERVAL_BOUNDS_MS`].
+    pub interval_buckets: [u64; ffi::XAML_FRAME_INTERVAL_BUCKETS],
+    /// Bridge calls per frame: 0, 1, 2-3, 4-7, ... 512-1023, then 1024 and more.
+    pub work_buckets: [u64; ffi::XAML_FRAME_WORK_BUCKETS],
+}
+
+impl FrameStats {
+    /// Upper bounds of every interval bucket but the last, which is open-ended.
+    pub const INTERVAL_BOUNDS_MS: [f64; ffi::XAML_FRAME_INTERVAL_BUCKETS - 1] =
+        [6.0, 9.0, 12.5, 18.0, 25.0, 34.5, 51.0, 67.5, 100.0, 250.0];
+
+    /// Share of recorded frames that were missed.
+    pub fn missed_ratio(&self) -> f64 {
+        if self.frames == 0 {
+            0.0
+        } else {
+            self.missed_frames as f64 / self.frames as f64
+        }
+    }
+
+    /// Mean bridge calls per frame.
+    pub fn calls_per_frame(&self) -> f64 {
+        if self.frames == 0 {
+            0.0
+        } else {
+            self.bridge_calls as f64 / self.frames as f64
+        }
+    }
+}
+
+/// Hidden-island bookkeeping for one [`XamlSource`].
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct SourceActivity {
+    /// Whether the island is currently visible.
+    pub visible: bool,
+    /// Whether its animations are currently paused.
+    pub suspended: bool,
+    /// Storyboards paused until the island is shown.
+    pub paused_storyboards: u32,
+    /// Indeterminate progress bars stopped until the island is shown.
+    pub paused_progress_bars: u32,
+    /// Times the island was hidden.
+    pub suspensions: u64,
+    /// Total time spent hidden.
+    pub hidden_ms: u64,
+    /// Animation time not ticked: hidden time multiplied by paused animations.
+    pub suspended_animation_ms: u64,
 }
 
 impl Drop for XamlSource {
@@ -413,23 +564,62 @@ impl XamlTextBox {
         Ok(())
     }
 
-    /// Get the current text content.
+    /// Get the current text content. Line breaks read back as `\r`.
     pub fn get_text(&self) -> Result<String> {
-        const BUFFER_SIZE: i32 = 1024;
-        let mut buffer: Vec<u16> = vec![0; BUFFER_SIZE as usize];
+        let mut buffer: Vec<u16> = vec![0; self.text_len()? + 1];
 
-        let result = unsafe {
-            ffi::xaml_textbox_get_text(self.handle, buffer.as_mut_ptr(), BUFFER_SIZE)
-        };
+        loop {
+            let result = unsafe {
+                ffi::xaml_textbox_get_text(self.handle, buffer.as_mut_ptr(), buffer.len() as i32)
+            };
+
+            if result < 0 {
+                return Err(Error::control_creation("Failed to get text".to_string()));
+            }
 
+            // The result is the full length; the text may have grown since it was measured.
+            let len = result as usize;
+            if len < buffer.len() {
+                return Ok(String::from_utf16_lossy(&buffer[..len]));
+            }
+            buffer.resize(len + 1, 0);
+        }
+    }
+
+    /// Length of the text in UTF-16 units. Each line break counts as one.
+    pub fn text_len(&self) -> Result<usize> {
+        let result = unsafe { ffi::xaml_textbox_get_text_length(self.handle) };
         if result < 0 {
-            return Err(Error::control_creation("Failed to get text".to_string()));
+            return Err(Error::control_creation("Failed to get text length".to_string()));
         }
+        Ok(result as usize)
+    }
 
-        // Convert the wide string to Rust String
-        let len = result as usize;
-        let text = String::from_utf16_lossy(&buffer[..len]);
-        Ok(text)
+    /// Append `text` without sending the existing text back and forth. The
+    /// selection is kept, and a caret at the end stays at the end.
+    pub fn append(&self, text: &str) -> Result<()> {
+        let wide: Vec<u16> = text.encode_utf16().collect();
+        let length = i32::try_from(wide.len()).map_err(|_| Error::invalid_operation("Text is too large"))?;
+        let result = unsafe { ffi::xaml_textbox_append(self.handle, wide.as_ptr(), length) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to append text"));
+        }
+        Ok(())
+    }
+
+    /// Replace `range` of the text with `text`. The range is in UTF-16 units
+    /// of the text as [`get_text`](Self::get_text) returns it.
+    pub fn replace_range(&self, range: std::ops::Range<usize>, text: &str) -> Result<()> {
+        let invalid = || Error::invalid_operation("Invalid text range");
+        let start = i32::try_from(range.start).map_err(|_| invalid())?;
+        let length = range.end.checked_sub(range.start).and_then(|len| i32::try_from(len).ok()).ok_or_else(invalid)?;
+        let wide: Vec<u16> = text.encode_utf16().collect();
+        let text_length = i32::try_from(wide.len()).map_err(|_| Error::invalid_operation("Text is too large"))?;
+        let result = unsafe { ffi::xaml_textbox_replace_range(self.handle, start, length, wide.as_ptr(), text_length) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to replace text range"));
+        }
+        Ok(())
     }
 
     /// Set the placeholder text.
@@ -941,6 +1131,20 @@ impl XamlComboBox {
         unsafe { ffi::xaml_combobox_get_selected_index(self.handle) }
     }
 
+    /// Apply a batch of item changes in one call.
+    ///
+    /// See [`ListChangeBuffer`] for collecting changes from an `ObservableCollection`.
+    pub fn apply_changes(&self, changes: &[ListChange]) -> Result<()> {
+        let encoded = collection_changes::encode_changes(changes);
+        let result = unsafe {
+            ffi::xaml_combobox_apply_changes(self.handle, encoded.records.as_ptr(), encoded.records.len() as i32)
+        };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to apply combobox changes".to_string()));
+        }
+        Ok(())
+    }
+
     /// Convert to a UIElement for use as content in other containers.
     pub fn as_uielement(&self) -> XamlUIElement {
         let handle = unsafe { ffi::xaml_combobox_as_uielement(self.handle) };
@@ -1305,6 +1509,63 @@ pub enum ListViewSelectionMode {
     Extended = 3,
 }
 
+/// How a [`ListSortKey`] orders ListView items.
+#[repr(i32)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum ListSortKind {
+    /// Ordinal text comparison.
+    Text = 0,
+    /// Case-insensitive text comparison.
+    TextIgnoreCase = 1,
+    /// First number found in the item text; items without one sort last.
+    Numeric = 2,
+    /// Host-provided column set with [`XamlListView::set_column_values`].
+    Column = 3,
+}
+
+/// One key of a native ListView sort.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct ListSortKey {
+    /// What to compare.
+    pub kind: ListSortKind,
+    /// Column index for [`ListSortKind::Column`].
+    pub column: i32,
+    /// Sort in descending order.
+    pub descending: bool,
+}
+
+impl ListSortKey {
+    /// Ascending key of the given kind.
+    pub fn ascending(kind: ListSortKind) -> Self {
+        ListSortKey { kind, column: 0, descending: false }
+    }
+
+    /// Descending key of the given kind.
+    pub fn descending(kind: ListSortKind) -> Self {
+        ListSortKey { kind, column: 0, descending: true }
+    }
+
+    /// Key on a host-provided numeric column.
+    pub fn column(column: i32, descending: bool) -> Self {
+        ListSortKey { kind: ListSortKind::Column, column, descending }
+    }
+}
+
+/// Predicate for a native ListView filter.
+#[derive(Debug, Clone, PartialEq)]
+pub enum ListFilter {
+    /// Item text contains the given text.
+    Contains { text: String, ignore_case: bool },
+    /// Item text starts with the given text.
+    Prefix { text: String, ignore_case: bool },
+    /// Item text equals the given text.
+    Equals { text: String, ignore_case: bool },
+    /// First number in the item text lies within `[min, max]`.
+    NumericRange { min: f64, max: f64 },
+    /// Host-provided column value lies within `[min, max]`.
+    ColumnRange { column: i32, min: f64, max: f64 },
+}
+
 /// A WinRT ListView control for displaying lists of items.
 pub struct XamlListView {
     handle: ffi::XamlListViewHandle,
@@ -1369,20 +1630,144 @@ impl XamlListView {
 
     /// Get the item text at the specified index.
     pub fn get_item(&self, index: i32) -> Result<String> {
-        const BUFFER_SIZE: i32 = 1024;
-        let mut buffer: Vec<u16> = vec![0; BUFFER_SIZE as usize];
+        let mut buffer: Vec<u16> = vec![0; 1024];
 
+        loop {
+            let result = unsafe {
+                ffi::xaml_listview_get_item(self.handle, index, buffer.as_mut_ptr(), buffer.len() as i32)
+            };
+
+            if result < 0 {
+                return Err(Error::invalid_operation("Failed to get listview item".to_string()));
+            }
+
+            // The result is the full length; retry once with room for all of it.
+            let len = result as usize;
+            if len < buffer.len() {
+                return Ok(String::from_utf16_lossy(&buffer[..len]));
+            }
+            buffer.resize(len + 1, 0);
+        }
+    }
+
+    /// Apply a batch of item changes in one call.
+    ///
+    /// The list must not be sorted, filtered or grouped. Large batches replace the
+    /// items in a single collection reset. See [`ListChangeBuffer`] for collecting
+    /// changes from an `ObservableCollection`.
+    pub fn apply_changes(&self, changes: &[ListChange]) -> Result<()> {
+        let encoded = collection_changes::encode_changes(changes);
         let result = unsafe {
-            ffi::xaml_listview_get_item(self.handle, index, buffer.as_mut_ptr(), BUFFER_SIZE)
+            ffi::xaml_listview_apply_changes(self.handle, encoded.records.as_ptr(), encoded.records.len() as i32)
         };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to apply listview changes".to_string()));
+        }
+        Ok(())
+    }
+
+    /// Replace the items with `(item, group)` pairs shown under group headers.
+    ///
+    /// Groups appear in order of first use and keep insertion order inside. While
+    /// grouped, item indices are insertion positions and sorting/filtering is
+    /// unavailable; [`XamlListView::clear`] returns to a flat list.
+    /// Returns the number of groups.
+    pub fn set_grouped_items(&self, items: &[(&str, &str)]) -> Result<usize> {
+        let items_wide: Vec<Vec<u16>> = items.iter().map(|(item, _)| to_wide_string(item)).collect();
+        let keys_wide: Vec<Vec<u16>> = items.iter().map(|(_, key)| to_wide_string(key)).collect();
+        let item_ptrs: Vec<*const u16> = items_wide.iter().map(|item| item.as_ptr()).collect();
+        let key_ptrs: Vec<*const u16> = keys_wide.iter().map(|key| key.as_ptr()).collect();
+
+        let result = unsafe {
+            ffi::xaml_listview_set_grouped_items(self.handle, item_ptrs.as_ptr(), key_ptrs.as_ptr(), items.len() as i32)
+        };
+        if result < 0 {
+            return Err(Error::invalid_operation("Failed to set grouped listview items".to_string()));
+        }
+        Ok(result as usize)
+    }
 
+    /// Append an item to `group` on a grouped list. Returns the item's index.
+    pub fn add_grouped_item(&self, item: &str, group: &str) -> Result<usize> {
+        let item_wide = to_wide_string(item);
+        let group_wide = to_wide_string(group);
+        let result = unsafe {
+            ffi::xaml_listview_add_grouped_item(self.handle, item_wide.as_ptr(), group_wide.as_ptr())
+        };
         if result < 0 {
-            return Err(Error::invalid_operation("Failed to get listview item".to_string()));
+            return Err(Error::invalid_operation("Failed to add grouped listview item".to_string()));
         }
+        Ok(result as usize)
+    }
 
-        let len = result as usize;
-        let text = String::from_utf16_lossy(&buffer[..len]);
-        Ok(text)
+    /// Move the item at `index` to `group` on a grouped list.
+    pub fn set_item_group(&self, index: usize, group: &str) -> Result<()> {
+        let group_wide = to_wide_string(group);
+        let result = unsafe { ffi::xaml_listview_set_item_group(self.handle, index as i32, group_wide.as_ptr()) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to regroup listview item".to_string()));
+        }
+        Ok(())
+    }
+
+    /// Read the text of `count` visible items starting at `start` in one call.
+    pub fn export_items(&self, start: usize, count: usize) -> Result<Vec<String>> {
+        let mut offsets = vec![0u32; count + 1];
+        let required = unsafe {
+            ffi::xaml_listview_export_items(
+                self.handle,
+                start as i32,
+                count as i32,
+                std::ptr::null_mut(),
+                0,
+                offsets.as_mut_ptr(),
+            )
+        };
+        if required < 0 {
+            return Err(Error::invalid_operation("Failed to export listview items".to_string()));
+        }
+
+        let mut buffer = vec![0u16; required as usize];
+        let result = unsafe {
+            ffi::xaml_listview_export_items(
+                self.handle,
+                start as i32,
+                count as i32,
+                buffer.as_mut_ptr(),
+                buffer.len(),
+                offsets.as_mut_ptr(),
+            )
+        };
+        if result != required {
+            return Err(Error::invalid_operation("Failed to export listview items".to_string()));
+        }
+
+        Ok(offsets
+            .windows(2)
+            .map(|range| String::from_utf16_lossy(&buffer[range[0] as usize..range[1] as usize]))
+            .collect())
+    }
+
+    /// Get the indices of all selected items, in ascending order.
+    ///
+    /// Unlike [`XamlListView::selected_index`], this reports every selected item in
+    /// `Multiple` and `Extended` selection modes.
+    pub fn selected_indices(&self) -> Result<Vec<usize>> {
+        let mut indices: Vec<i32> = Vec::new();
+        loop {
+            let total = unsafe {
+                ffi::xaml_listview_get_selected_indices(self.handle, indices.as_mut_ptr(), indices.len() as i32)
+            };
+            if total < 0 {
+                return Err(Error::invalid_operation("Failed to get listview selection".to_string()));
+            }
+            // The selection can change between the sizing call and the copy.
+            if total as usize <= indices.len() {
+                indices.truncate(total as usize);
+                return Ok(indices.into_iter().map(|index| index as usize).collect());
+            }
+            indices.resize(total as usize, 0);
+        }
     }
 
     /// Register a callback for when the selection changes.
@@ -1423,6 +1808,118 @@ impl XamlListView {
         Ok(())
     }
 
+    /// Sort the items natively by the given keys (an empty slice restores insertion order).
+    ///
+    /// The bridge keeps every item's text, so only the visible order changes; nothing is
+    /// re-sent from Rust. Returns the number of visible items.
+    pub fn set_sort(&self, keys: &[ListSortKey]) -> Result<usize> {
+        let raw: Vec<ffi::XamlSortKey> = keys
+            .iter()
+            .map(|key| ffi::XamlSortKey {
+                kind: key.kind as i32,
+                column: key.column,
+                descending: key.descending as i32,
+            })
+            .collect();
+        let result = unsafe { ffi::xaml_listview_set_sort(self.handle, raw.as_ptr(), raw.len() as i32) };
+        if result < 0 {
+            return Err(Error::invalid_operation("Failed to sort listview items".to_string()));
+        }
+        Ok(result as usize)
+    }
+
+    /// Show only the items matching `filter`, or all items for `None`.
+    ///
+    /// Returns the number of visible items. Indices passed to other ListView methods
+    /// refer to positions among the visible items.
+    pub fn set_filter(&self, filter: Option<&ListFilter>) -> Result<usize> {
+        let mut text_wide = Vec::new();
+        let spec = filter.map(|filter| {
+            let mut spec = ffi::XamlFilterSpec {
+                kind: 0,
+                flags: 0,
+                text: std::ptr::null(),
+                min: 0.0,
+                max: 0.0,
+                column: 0,
+            };
+            let (kind, text, ignore_case) = match filter {
+                ListFilter::Contains { text, ignore_case } => (1, Some(text), *ignore_case),
+                ListFilter::Prefix { text, ignore_case } => (2, Some(text), *ignore_case),
+                ListFilter::Equals { text, ignore_case } => (3, Some(text), *ignore_case),
+                ListFilter::NumericRange { min, max } => {
+                    spec.min = *min;
+                    spec.max = *max;
+                    (4, None, false)
+                }
+                ListFilter::ColumnRange { column, min, max } => {
+                    spec.column = *column;
+                    spec.min = *min;
+                    spec.max = *max;
+                    (5, None, false)
+                }
+            };
+            spec.kind = kind;
+            if ignore_case {
+                spec.flags |= ffi::XAML_FILTER_IGNORE_CASE;
+            }
+            if let Some(text) = text {
+                text_wide = to_wide_string(text);
+                spec.text = text_wide.as_ptr();
+            }
+            spec
+        });
+
+        let spec_ptr = spec.as_ref().map_or(std::ptr::null(), |spec| spec as *const _);
+        let result = unsafe { ffi::xaml_listview_set_filter(self.handle, spec_ptr) };
+        if result < 0 {
+            return Err(Error::invalid_operation("Failed to filter listview items".to_string()));
+        }
+        Ok(result as usize)
+    }
+
+    /// Provide a numeric column for [`ListSortKind::Column`] and [`ListFilter::ColumnRange`].
+    ///
+    /// `values[i]` belongs to the i-th item in insertion order.
+    pub fn set_column_values(&self, column: i32, values: &[f64]) -> Result<()> {
+        let result = unsafe {
+            ffi::xaml_listview_set_column_values(self.handle, column, values.as_ptr(), values.len() as i32)
+        };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to set listview column values".to_string()));
+        }
+        Ok(())
+    }
+
+    /// Find every item containing `query`, returned as insertion-order indices.
+    ///
+    /// Searching is incremental: a query that extends the previous one only rescans
+    /// the previous matches. With `apply_filter`, the list also shows only the matches.
+    pub fn search(&self, query: &str, ignore_case: bool, apply_filter: bool) -> Result<Vec<usize>> {
+        let query_wide = to_wide_string(query);
+        let mut flags = if ignore_case { ffi::XAML_SEARCH_IGNORE_CASE } else { 0 };
+        let total = unsafe {
+            ffi::xaml_listview_search(self.handle, query_wide.as_ptr(), flags, std::ptr::null_mut(), 0)
+        };
+        if total < 0 {
+            return Err(Error::invalid_operation("Failed to search listview items".to_string()));
+        }
+
+        // Repeating the same query only rescans its own matches.
+        if apply_filter {
+            flags |= ffi::XAML_SEARCH_APPLY_FILTER;
+        }
+        let mut indices = vec![0i32; total as usize];
+        let total = unsafe {
+            ffi::xaml_listview_search(self.handle, query_wide.as_ptr(), flags, indices.as_mut_ptr(), indices.len() as i32)
+        };
+        if total < 0 {
+            return Err(Error::invalid_operation("Failed to search listview items".to_string()));
+        }
+        indices.truncate(total as usize);
+        Ok(indices.into_iter().map(|index| index as usize).collect())
+    }
+
     /// Convert to a UIElement for use as content in other containers.
     pub fn as_uielement(&self) -> XamlUIElement {
         let handle = unsafe { ffi::xaml_listview_as_uielement(self.handle) };
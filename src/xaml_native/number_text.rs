@@ -0,0 +1,163 @@
+//! Numeric TextBlock text.
+//!
+//! Telemetry panels update hundreds of numbers per second. Formatting each
+//! one into a `String`, converting it to UTF-16 and calling
+//! [`XamlTextBlock::set_text`] allocates twice per update.
+//! [`XamlTextBlock::set_number`] passes the `f64` across instead. The bridge
+//! formats it into a reused buffer and leaves the TextBlock alone when the
+//! text would not change.
+
+use super::{ffi, XamlTextBlock};
+use crate::error::{Error, Result};
+
+/// How [`XamlTextBlock::set_number`] renders a value. Build it once and
+/// reuse it for every update.
+///
+/// NaN shows as `NaN` and infinities as `∞`. Values that round to zero
+/// never show a minus sign.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct NumberFormat {
+    precision: Option<u8>,
+    flags: i32,
+    decimal_point: u16,
+    group_separator: u16,
+    // NUL-terminated UTF-16; empty when unset.
+    prefix: Vec<u16>,
+    suffix: Vec<u16>,
+}
+
+impl NumberFormat {
+    /// Largest number of fraction digits [`fixed`](Self::fixed) accepts.
+    pub const MAX_PRECISION: u8 = 17;
+
+    /// The shortest text that reads back as the same `f64`.
+    pub fn shortest() -> Self {
+        Self {
+            precision: None,
+            flags: 0,
+            decimal_point: 0,
+            group_separator: 0,
+            prefix: Vec::new(),
+            suffix: Vec::new(),
+        }
+    }
+
+    /// Exactly `digits` fraction digits, rounded. Capped at
+    /// [`MAX_PRECISION`](Self::MAX_PRECISION).
+    pub fn fixed(digits: u8) -> Self {
+        Self { precision: Some(digits.min(Self::MAX_PRECISION)), ..Self::shortest() }
+    }
+
+    /// Separate thousands in the integer part.
+    pub fn grouping(mut self) -> Self {
+        self.flags |= ffi::XAML_NUMBER_GROUPING;
+        self
+    }
+
+    /// Show `+` before positive values.
+    pub fn plus_sign(mut self) -> Self {
+        self.flags |= ffi::XAML_NUMBER_PLUS_SIGN;
+        self
+    }
+
+    /// Decimal point instead of `.`. Characters outside the Basic
+    /// Multilingual Plane are ignored.
+    pub fn decimal_point(mut self, c: char) -> Self {
+        self.decimal_point = bmp_char(c);
+        self
+    }
+
+    /// Thousands separator instead of `,`.
+    pub fn group_separator(mut self, c: char) -> Self {
+        self.group_separator = bmp_char(c);
+        self
+    }
+
+    /// Text before the number, such as a currency symbol.
+    pub fn prefix(mut self, text: &str) -> Self {
+        self.prefix = wide_or_empty(text);
+        self
+    }
+
+    /// Text after the number, such as a unit.
+    pub fn suffix(mut self, text: &str) -> Self {
+        self.suffix = wide_or_empty(text);
+        self
+    }
+
+    fn to_ffi(&self) -> ffi::XamlNumberFormat {
+        let text = |wide: &Vec<u16>| if wide.is_empty() { std::ptr::null() } else { wide.as_ptr() };
+        ffi::XamlNumberFormat {
+            precision: self.precision.map_or(-1, i32::from),
+            flags: self.flags,
+            decimal_point: self.decimal_point,
+            group_separator: self.group_separator,
+            prefix: text(&self.prefix),
+            suffix: text(&self.suffix),
+        }
+    }
+}
+
+impl Default for NumberFormat {
+    fn default() -> Self {
+        Self::shortest()
+    }
+}
+
+fn bmp_char(c: char) -> u16 {
+    u16::try_from(u32::from(c)).unwrap_or(0)
+}
+
+fn wide_or_empty(text: &str) -> Vec<u16> {
+    if text.is_empty() {
+        Vec::new()
+    } else {
+        text.encode_utf16().chain(std::iter::once(0)).collect()
+    }
+}
+
+impl XamlTextBlock {
+    /// Show `value` formatted per `format`. Does nothing, apart from the
+    /// bridge call, when the text is unchanged.
+    ///
+    /// # Example
+    /// ```no_run
+    /// use winrt_xaml::xaml_native::{NumberFormat, XamlTextBlock};
+    ///
+    /// let latency = XamlTextBlock::new()?;
+    /// let format = NumberFormat::fixed(1).grouping().suffix(" ms");
+    /// latency.set_number(1234.56, &format)?; // "1,234.6 ms"
+    /// # Ok::<(), winrt_xaml::Error>(())
+    /// ```
+    pub fn set_number(&self, value: f64, format: &NumberFormat) -> Result<()> {
+        let spec = format.to_ffi();
+        let result = unsafe { ffi::xaml_textblock_set_number(self.handle, value, &spec) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to set number"));
+        }
+        Ok(())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_number_format_encoding() {
+        let spec = NumberFormat::shortest().to_ffi();
+        assert_eq!((spec.precision, spec.flags, spec.decimal_point), (-1, 0, 0));
+        assert!(spec.prefix.is_null() && spec.suffix.is_null());
+
+        let format = NumberFormat::fixed(40).grouping().plus_sign().decimal_point(',').group_separator('.').suffix(" ms");
+        let spec = format.to_ffi();
+        assert_eq!(spec.precision, i32::from(NumberFormat::MAX_PRECISION));
+        assert_eq!(spec.flags, ffi::XAML_NUMBER_GROUPING | ffi::XAML_NUMBER_PLUS_SIGN);
+        assert_eq!((spec.decimal_point, spec.group_separator), (u16::from(b','), u16::from(b'.')));
+        assert!(spec.prefix.is_null());
+        let suffix = unsafe { std::slice::from_raw_parts(spec.suffix, 4) };
+        assert_eq!(suffix, [u16::from(b' '), u16::from(b'm'), u16::from(b's'), 0]);
+
+        assert_eq!(NumberFormat::fixed(0).decimal_point('😀').to_ffi().decimal_point, 0);
+    }
+}
@@ -0,0 +1,280 @@
+//! Reactive properties bound to elements, flushed once per frame.
+//!
+//! Subscribing to a [`Property`] with a closure that calls a control setter
+//! crosses the bridge on every `set`, so a burst of 1,000 sets costs 1,000
+//! crossings. [`PropertyBindings`] instead records the latest value of each
+//! bound property in a staging table and writes every staged value to a
+//! [`XamlViewModel`] in one call at the next frame, where XAML bindings
+//! update the elements. The bridge is crossed a fixed number of times per
+//! frame, and XAML updates once per property that changed.
+
+use std::ffi::c_void;
+use std::sync::{Arc, Mutex};
+
+use super::{ffi, ElementProperty, PropertyValue, SlotBatch, SlotKind, XamlUIElement, XamlViewModel};
+use crate::error::{Error, Result};
+use crate::reactive::{Property, SubscriptionId};
+
+/// A [`Property`] value type that can be bound to an element.
+pub trait SlotValue: Clone + PartialEq + Send + 'static {
+    /// The kind of slot the value is staged in.
+    const KIND: SlotKind;
+    fn to_value(&self) -> PropertyValue;
+}
+
+impl SlotValue for f64 {
+    const KIND: SlotKind = SlotKind::Number;
+    fn to_value(&self) -> PropertyValue {
+        PropertyValue::Number(*self)
+    }
+}
+
+impl SlotValue for f32 {
+    const KIND: SlotKind = SlotKind::Number;
+    fn to_value(&self) -> PropertyValue {
+        PropertyValue::Number(f64::from(*self))
+    }
+}
+
+impl SlotValue for i32 {
+    const KIND: SlotKind = SlotKind::Integer;
+    fn to_value(&self) -> PropertyValue {
+        PropertyValue::Integer(*self)
+    }
+}
+
+impl SlotValue for bool {
+    const KIND: SlotKind = SlotKind::Boolean;
+    fn to_value(&self) -> PropertyValue {
+        PropertyValue::Boolean(Some(*self))
+    }
+}
+
+impl SlotValue for String {
+    const KIND: SlotKind = SlotKind::Text;
+    fn to_value(&self) -> PropertyValue {
+        PropertyValue::Text(self.clone())
+    }
+}
+
+/// Counters of a [`PropertyBindings`].
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct PropertyBindingStats {
+    pub bindings: u32,
+    /// Property values recorded in the staging table.
+    pub sets: u64,
+    /// Staged values written to the view model.
+    pub writes: u64,
+    /// Frames that wrote any.
+    pub frames: u64,
+    /// Frames whose view-model write failed; their values were dropped.
+    pub write_failures: u64,
+}
+
+/// The latest value of every bound property not yet written.
+#[derive(Default)]
+struct StagingTable {
+    values: Vec<Option<PropertyValue>>,
+    dirty: Vec<u32>,
+    frame_requested: bool,
+    // Slot names are never reused, even when binding fails after adding one.
+    next_slot_name: u32,
+    stats: PropertyBindingStats,
+}
+
+impl StagingTable {
+    /// Record `value` for `slot`. Returns true when a frame must be
+    /// requested, which is once per frame.
+    fn stage(&mut self, slot: u32, value: PropertyValue) -> bool {
+        let index = slot as usize;
+        if self.values.len() <= index {
+            self.values.resize(index + 1, None);
+        }
+        if self.values[index].replace(value).is_none() {
+            self.dirty.push(slot);
+        }
+        self.stats.sets += 1;
+        !std::mem::replace(&mut self.frame_requested, true)
+    }
+
+    /// Move the staged values into `batch`, in the order they were first set.
+    fn drain(&mut self, batch: &mut SlotBatch) {
+        self.frame_requested = false;
+        if self.dirty.is_empty() {
+            return;
+        }
+        for slot in self.dirty.drain(..) {
+            match self.values[slot as usize].take() {
+                Some(PropertyValue::Number(value)) => batch.set_number(slot, value),
+                Some(PropertyValue::Integer(value)) => batch.set_number(slot, f64::from(value)),
+                Some(PropertyValue::Boolean(value)) => batch.set_bool(slot, value.unwrap_or(false)),
+                Some(PropertyValue::Text(value)) => batch.set_text(slot, &value),
+                None => continue,
+            };
+        }
+        self.stats.writes += batch.len() as u64;
+        self.stats.frames += 1;
+    }
+}
+
+struct Staging {
+    state: Mutex<StagingState>,
+}
+
+struct StagingState {
+    table: StagingTable,
+    batch: SlotBatch,
+    // None once the owning PropertyBindings is dropped.
+    model: Option<XamlViewModel>,
+}
+
+impl Staging {
+    fn stage(&self, slot: u32, value: PropertyValue) {
+        let mut state = self.state.lock().unwrap();
+        if state.table.stage(slot, value) {
+            if let Some(model) = &state.model {
+                unsafe {
+                    ffi::xaml_viewmodel_request_frame(model.handle());
+                }
+            }
+        }
+    }
+
+    fn flush(&self) {
+        let mut state = self.state.lock().unwrap();
+        let StagingState { table, batch, model } = &mut *state;
+        batch.clear();
+        table.drain(batch);
+        if let Some(model) = model {
+            if model.write(batch).is_err() {
+                table.stats.write_failures += 1;
+            }
+        }
+    }
+}
+
+extern "C" fn on_frame(user_data: *mut c_void) {
+    let staging = unsafe { &*(user_data as *const Staging) };
+    staging.flush();
+}
+
+/// Bindings from [`Property`] values to element properties.
+///
+/// It stays on the UI thread that created it, since its frame callback runs
+/// there and must not race the drop. Bound properties may be set from any
+/// thread; a set only records the value, and bound elements show the latest
+/// value of each property at the next frame. Bound properties keep their
+/// subscriptions, which do nothing after the drop.
+///
+/// # Example
+/// ```no_run
+/// use winrt_xaml::reactive::Property;
+/// use winrt_xaml::xaml_native::{ElementProperty, PropertyBindings, XamlSlider};
+///
+/// let bindings = PropertyBindings::new()?;
+/// let progress = Property::new(0.0_f64);
+/// let slider = XamlSlider::new()?;
+/// bindings.bind(&progress, &slider.as_uielement(), ElementProperty::Value)?;
+///
+/// for step in 0..1_000 {
+///     progress.set(f64::from(step) / 10.0); // one bridge write at the next frame
+/// }
+/// # Ok::<(), winrt_xaml::Error>(())
+/// ```
+pub struct PropertyBindings {
+    staging: Arc<Staging>,
+    // Also keeps the type !Send and !Sync.
+    frame_user_data: *const Staging,
+}
+
+impl PropertyBindings {
+    pub fn new() -> Result<Self> {
+        let model = XamlViewModel::new()?;
+        let staging = Arc::new(Staging {
+            state: Mutex::new(StagingState { table: StagingTable::default(), batch: SlotBatch::new(), model: None }),
+        });
+        // The bridge holds one reference for the frame callback until drop.
+        let frame_user_data = Arc::into_raw(staging.clone());
+        let result = unsafe { ffi::xaml_viewmodel_set_frame_callback(model.handle(), Some(on_frame), frame_user_data as *mut c_void) };
+        if result != 0 {
+            unsafe {
+                drop(Arc::from_raw(frame_user_data));
+            }
+            return Err(Error::invalid_operation("Failed to register property binding frame callback"));
+        }
+        staging.state.lock().unwrap().model = Some(model);
+        Ok(Self { staging, frame_user_data })
+    }
+
+    /// Show `property` in `element_property` of `element`, starting with its
+    /// current value. Unsubscribe the returned id from `property` to stop.
+    pub fn bind<T: SlotValue>(
+        &self,
+        property: &Property<T>,
+        element: &XamlUIElement,
+        element_property: ElementProperty,
+    ) -> Result<SubscriptionId> {
+        let slot = {
+            let mut state = self.staging.state.lock().unwrap();
+            let StagingState { table, model, .. } = &mut *state;
+            let model = model.as_ref().ok_or_else(|| Error::invalid_operation("Property bindings are closed"))?;
+            let name = format!("p{}", table.next_slot_name);
+            table.next_slot_name += 1;
+            let slot = model.add_slot(&name, T::KIND)?;
+            model.bind(slot, element, element_property)?;
+            table.stats.bindings += 1;
+            slot
+        };
+        // Not under the staging lock: subscribing stages the current value.
+        let staging = self.staging.clone();
+        Ok(property.subscribe(move |value: &T| staging.stage(slot, value.to_value())))
+    }
+
+    pub fn stats(&self) -> PropertyBindingStats {
+        self.staging.state.lock().unwrap().table.stats
+    }
+}
+
+impl Drop for PropertyBindings {
+    fn drop(&mut self) {
+        let model = self.staging.state.lock().unwrap().model.take();
+        if let Some(model) = model {
+            unsafe {
+                ffi::xaml_viewmodel_set_frame_callback(model.handle(), None, std::ptr::null_mut());
+            }
+            drop(model);
+        }
+        unsafe {
+            drop(Arc::from_raw(self.frame_user_data));
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_staging_keeps_latest_value_per_slot() {
+        let mut table = StagingTable::default();
+        assert!(table.stage(3, 1.0_f64.to_value()));
+        for step in 0..1000 {
+            assert!(!table.stage(3, f64::from(step).to_value()));
+        }
+        assert!(!table.stage(0, String::from("ready").to_value()));
+        assert!(!table.stage(1, true.to_value()));
+
+        let mut batch = SlotBatch::new();
+        table.drain(&mut batch);
+        assert_eq!(batch.len(), 3);
+        assert_eq!(table.stats, PropertyBindingStats { sets: 1003, writes: 3, frames: 1, ..Default::default() });
+
+        // The next set requests the next frame; an empty frame writes nothing.
+        let mut batch = SlotBatch::new();
+        assert!(table.stage(7, 5_i32.to_value()));
+        table.drain(&mut batch);
+        table.drain(&mut batch);
+        assert_eq!(batch.len(), 1);
+        assert_eq!(table.stats.frames, 2);
+    }
+}
@@ -0,0 +1,181 @@
+//! Observing element properties that have no dedicated event.
+//!
+//! [`XamlUIElement::observe_property`] watches properties such as
+//! `ComboBox.SelectedIndex`, `ToggleSwitch.IsOn` or a ScrollViewer offset.
+//! The bridge coalesces changes per frame, so a scroll that moves the offset
+//! fifty times between frames reaches the observer as one change, in one
+//! call together with every other property that changed in that frame.
+
+use std::cell::RefCell;
+use std::ffi::c_void;
+
+use super::{ffi, ElementProperty, XamlUIElement};
+use crate::error::{Error, Result};
+
+/// A property value as observed.
+#[derive(Debug, Clone, PartialEq)]
+pub enum PropertyValue {
+    Number(f64),
+    Integer(i32),
+    /// `None` for an indeterminate CheckBox.
+    Boolean(Option<bool>),
+    Text(String),
+}
+
+/// The net change of one observed property over a frame.
+#[derive(Debug, Clone, PartialEq)]
+pub struct PropertyChange {
+    /// As passed to [`XamlUIElement::observe_property`].
+    pub tag: u64,
+    pub property: ElementProperty,
+    pub old: PropertyValue,
+    pub new: PropertyValue,
+}
+
+type Observer = Box<dyn FnMut(&[PropertyChange])>;
+
+thread_local! {
+    static OBSERVER: RefCell<Option<Observer>> = RefCell::new(None);
+}
+
+/// Call `observer` once per frame with the net changes of every property
+/// observed on this UI thread. Replaces any previous observer.
+///
+/// # Example
+/// ```no_run
+/// use winrt_xaml::xaml_native::{set_property_observer, ElementProperty, XamlComboBox};
+///
+/// const REGION: u64 = 1;
+/// set_property_observer(|changes| {
+///     for change in changes {
+///         println!("{} changed from {:?} to {:?}", change.tag, change.old, change.new);
+///     }
+/// })?;
+/// let regions = XamlComboBox::new()?;
+/// regions.as_uielement().observe_property(ElementProperty::SelectedIndex, REGION)?;
+/// # Ok::<(), winrt_xaml::Error>(())
+/// ```
+pub fn set_property_observer<F>(observer: F) -> Result<()>
+where
+    F: FnMut(&[PropertyChange]) + 'static,
+{
+    OBSERVER.with(|slot| *slot.borrow_mut() = Some(Box::new(observer)));
+    let result = unsafe { ffi::xaml_set_property_observer(Some(trampoline), std::ptr::null_mut()) };
+    if result != 0 {
+        return Err(Error::invalid_operation("Failed to set property observer"));
+    }
+    Ok(())
+}
+
+/// Stop delivering changes on this UI thread. Observations stay registered.
+pub fn clear_property_observer() -> Result<()> {
+    let result = unsafe { ffi::xaml_set_property_observer(None, std::ptr::null_mut()) };
+    OBSERVER.with(|slot| slot.borrow_mut().take());
+    if result != 0 {
+        return Err(Error::invalid_operation("Failed to clear property observer"));
+    }
+    Ok(())
+}
+
+extern "C" fn trampoline(changes: *const ffi::XamlPropertyChange, count: i32, _user_data: *mut c_void) {
+    if changes.is_null() || count <= 0 {
+        return;
+    }
+    let raw = unsafe { std::slice::from_raw_parts(changes, count as usize) };
+    let changes: Vec<PropertyChange> = raw.iter().filter_map(|change| unsafe { decode_change(change) }).collect();
+    // Take the observer out while it runs so it can replace itself.
+    let Some(mut observer) = OBSERVER.with(|slot| slot.borrow_mut().take()) else {
+        return;
+    };
+    observer(&changes);
+    OBSERVER.with(|slot| {
+        let mut slot = slot.borrow_mut();
+        if slot.is_none() {
+            *slot = Some(observer);
+        }
+    });
+}
+
+/// # Safety
+/// Text pointers in `change` must be null or NUL-terminated.
+unsafe fn decode_change(change: &ffi::XamlPropertyChange) -> Option<PropertyChange> {
+    let property = ElementProperty::from_ffi(change.property)?;
+    let value = |number: f64, text: *const u16| match change.kind {
+        ffi::XAML_SLOT_INTEGER => PropertyValue::Integer(number as i32),
+        ffi::XAML_SLOT_BOOLEAN => PropertyValue::Boolean(if number.is_nan() { None } else { Some(number != 0.0) }),
+        ffi::XAML_SLOT_TEXT => PropertyValue::Text(wide_to_string(text)),
+        _ => PropertyValue::Number(number),
+    };
+    Some(PropertyChange {
+        tag: change.tag,
+        property,
+        old: value(change.old_number, change.old_text),
+        new: value(change.new_number, change.new_text),
+    })
+}
+
+unsafe fn wide_to_string(text: *const u16) -> String {
+    if text.is_null() {
+        return String::new();
+    }
+    let mut len = 0;
+    while *text.add(len) != 0 {
+        len += 1;
+    }
+    String::from_utf16_lossy(std::slice::from_raw_parts(text, len))
+}
+
+impl XamlUIElement {
+    /// Report changes of `property` to the [`set_property_observer`]
+    /// observer, labelled with `tag`. Call on the UI thread; observing the
+    /// same property under the same tag again does nothing.
+    pub fn observe_property(&self, property: ElementProperty, tag: u64) -> Result<()> {
+        let result = unsafe { ffi::xaml_observe_property(self.handle(), property.to_ffi(), tag) };
+        if result != 0 {
+            return Err(Error::invalid_operation(format!("Failed to observe {:?}", property)));
+        }
+        Ok(())
+    }
+
+    pub fn unobserve_property(&self, property: ElementProperty, tag: u64) -> Result<()> {
+        let result = unsafe { ffi::xaml_unobserve_property(self.handle(), property.to_ffi(), tag) };
+        if result != 0 {
+            return Err(Error::invalid_operation(format!("Failed to stop observing {:?}", property)));
+        }
+        Ok(())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_decode_change() {
+        let text: Vec<u16> = "héllo".encode_utf16().chain(Some(0)).collect();
+        let raw = |property: i32, kind: i32, old: f64, new: f64| ffi::XamlPropertyChange {
+            tag: 7,
+            property,
+            kind,
+            old_number: old,
+            new_number: new,
+            old_text: std::ptr::null(),
+            new_text: if kind == ffi::XAML_SLOT_TEXT { text.as_ptr() } else { std::ptr::null() },
+        };
+
+        let change = unsafe { decode_change(&raw(ffi::XAML_PROP_SELECTED_INDEX, ffi::XAML_SLOT_INTEGER, -1.0, 2.0)) }.unwrap();
+        assert_eq!(change.tag, 7);
+        assert_eq!(change.property, ElementProperty::SelectedIndex);
+        assert_eq!((change.old, change.new), (PropertyValue::Integer(-1), PropertyValue::Integer(2)));
+
+        let change = unsafe { decode_change(&raw(ffi::XAML_PROP_IS_CHECKED, ffi::XAML_SLOT_BOOLEAN, f64::NAN, 1.0)) }.unwrap();
+        assert_eq!((change.old, change.new), (PropertyValue::Boolean(None), PropertyValue::Boolean(Some(true))));
+
+        let change = unsafe { decode_change(&raw(ffi::XAML_PROP_TEXT, ffi::XAML_SLOT_TEXT, 0.0, 0.0)) }.unwrap();
+        assert_eq!((change.old, change.new), (PropertyValue::Text(String::new()), PropertyValue::Text("héllo".into())));
+
+        let change = unsafe { decode_change(&raw(ffi::XAML_PROP_VERTICAL_OFFSET, ffi::XAML_SLOT_NUMBER, 0.0, 12.5)) }.unwrap();
+        assert_eq!(change.new, PropertyValue::Number(12.5));
+        assert!(unsafe { decode_change(&raw(99, ffi::XAML_SLOT_NUMBER, 0.0, 1.0)) }.is_none());
+    }
+}
@@ -0,0 +1,126 @@
+//! Styled runs within a single TextBlock.
+//!
+//! A log line with colored spans used to need one TextBlock per span inside
+//! a horizontal StackPanel. [`XamlTextBlock::set_runs`] builds the spans as
+//! `Run` inlines of one TextBlock in a single bridge call.
+
+use super::{ffi, XamlTextBlock};
+use crate::error::{Error, Result};
+use std::ops::Range;
+
+/// A styled span of a TextBlock's text. `range` is in bytes of the `&str`
+/// passed to [`XamlTextBlock::set_runs`] and must fall on char boundaries.
+#[derive(Debug, Clone, PartialEq, Eq, Default)]
+pub struct TextRun {
+    pub range: Range<usize>,
+    /// ARGB color; `None` keeps the TextBlock's foreground.
+    pub foreground: Option<u32>,
+    /// 100-900; `None` keeps the TextBlock's weight.
+    pub weight: Option<u16>,
+    pub italic: bool,
+}
+
+impl TextRun {
+    /// A run with the TextBlock's own style.
+    pub fn new(range: Range<usize>) -> Self {
+        Self { range, ..Default::default() }
+    }
+
+    pub fn foreground(mut self, argb: u32) -> Self {
+        self.foreground = Some(argb);
+        self
+    }
+
+    pub fn weight(mut self, weight: u16) -> Self {
+        self.weight = Some(weight);
+        self
+    }
+
+    pub fn italic(mut self) -> Self {
+        self.italic = true;
+        self
+    }
+}
+
+/// Encode `text` as UTF-16 and convert the byte ranges of `runs` to UTF-16
+/// offsets in the same pass. Runs must be in order and must not overlap.
+fn encode_runs(text: &str, runs: &[TextRun]) -> Option<(Vec<u16>, Vec<ffi::XamlRunSpec>)> {
+    let mut wide = Vec::with_capacity(text.len() + 1);
+    let mut specs = Vec::with_capacity(runs.len());
+    let mut byte = 0;
+    let mut encode_to = |wide: &mut Vec<u16>, end: usize| -> Option<i32> {
+        if end < byte || end > text.len() || !text.is_char_boundary(end) {
+            return None;
+        }
+        wide.extend(text[byte..end].encode_utf16());
+        byte = end;
+        i32::try_from(wide.len()).ok()
+    };
+    for run in runs {
+        let start = encode_to(&mut wide, run.range.start)?;
+        let end = encode_to(&mut wide, run.range.end)?;
+        specs.push(ffi::XamlRunSpec {
+            start,
+            length: end - start,
+            foreground: run.foreground.unwrap_or(0),
+            weight: run.weight.map_or(0, i32::from),
+            italic: run.italic as i32,
+        });
+    }
+    encode_to(&mut wide, text.len())?;
+    wide.push(0);
+    Some((wide, specs))
+}
+
+impl XamlTextBlock {
+    /// Replace the text with `text`, styling the spans given by `runs`.
+    ///
+    /// # Example
+    /// ```no_run
+    /// use winrt_xaml::xaml_native::{TextRun, XamlTextBlock};
+    ///
+    /// let line = XamlTextBlock::new()?;
+    /// let text = "12:00:01 ERROR disk full";
+    /// line.set_runs(text, &[
+    ///     TextRun::new(0..8).foreground(0xFF808080),
+    ///     TextRun::new(9..14).foreground(0xFFE74856).weight(700),
+    /// ])?;
+    /// # Ok::<(), winrt_xaml::Error>(())
+    /// ```
+    pub fn set_runs(&self, text: &str, runs: &[TextRun]) -> Result<()> {
+        let (wide, specs) = encode_runs(text, runs).ok_or_else(|| {
+            Error::invalid_operation("Text runs must be in order, not overlap and fall on char boundaries")
+        })?;
+        let result = unsafe {
+            ffi::xaml_textblock_set_runs(self.handle, wide.as_ptr(), specs.as_ptr(), specs.len() as i32)
+        };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to set text runs"));
+        }
+        Ok(())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_run_offsets_are_utf16() {
+        // "é" is 2 bytes and 1 UTF-16 unit; "😀" is 4 bytes and 2 units.
+        let text = "é 😀 done";
+        let runs = [TextRun::new(3..7).foreground(0xFFFF0000), TextRun::new(8..12).italic()];
+        let (wide, specs) = encode_runs(text, &runs).unwrap();
+        assert_eq!(wide.len(), text.encode_utf16().count() + 1);
+        assert_eq!((specs[0].start, specs[0].length), (2, 2));
+        assert_eq!(specs[0].foreground, 0xFFFF0000);
+        assert_eq!((specs[1].start, specs[1].length, specs[1].italic), (5, 4, 1));
+    }
+
+    #[test]
+    fn test_invalid_runs_are_rejected() {
+        assert!(encode_runs("abc", &[TextRun::new(1..2), TextRun::new(0..1)]).is_none());
+        assert!(encode_runs("abc", &[TextRun::new(2..4)]).is_none());
+        assert!(encode_runs("é", &[TextRun::new(1..2)]).is_none());
+    }
+}
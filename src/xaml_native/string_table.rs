@@ -0,0 +1,161 @@
+//! Localized labels from a memory-mapped string table.
+//!
+//! Setting a translated label with [`XamlButton::set_content`] converts the
+//! `&str` to UTF-16 and copies it into a fresh `hstring` on every call. A
+//! [`StringTable`] file is already UTF-16 and indexed by id. The bridge maps
+//! it, builds each label's `hstring` once per UI thread, and relabels every
+//! element set by id when another locale's table is loaded.
+
+use std::ffi::OsStr;
+use std::os::windows::ffi::OsStrExt;
+use std::path::Path;
+
+use super::{ffi, XamlButton, XamlTextBlock};
+use crate::error::{Error, Result};
+
+const MAGIC: u32 = 0x4254_5358; // "XSTB"
+const VERSION: u32 = 1;
+
+/// State of the active string table, as seen from the calling thread.
+#[derive(Debug, Clone, Default, PartialEq, Eq)]
+pub struct StringTableInfo {
+    /// Ids in the table; 0 when none is loaded.
+    pub count: u32,
+    pub locale: String,
+    /// Elements labelled by id on this thread.
+    pub bound_elements: u32,
+    /// Incremented by every load and unload.
+    pub generation: u64,
+    pub cache_hits: u64,
+    pub cache_misses: u64,
+}
+
+/// The process-wide string table.
+///
+/// # Example
+/// ```no_run
+/// use winrt_xaml::xaml_native::{StringTable, XamlButton};
+///
+/// const SAVE: u32 = 0;
+/// std::fs::write("en.xstb", StringTable::build("en-US", &["Save"]))?;
+/// std::fs::write("fr.xstb", StringTable::build("fr-FR", &["Enregistrer"]))?;
+///
+/// StringTable::load("en.xstb")?;
+/// let save = XamlButton::new()?;
+/// save.set_content_id(SAVE)?;
+/// StringTable::load("fr.xstb")?; // the button now reads "Enregistrer"
+/// # Ok::<(), Box<dyn std::error::Error>>(())
+/// ```
+pub struct StringTable;
+
+impl StringTable {
+    /// Map the table at `path` and make it active. Elements this thread
+    /// labelled by id switch to the new strings; ids the new table lacks keep
+    /// their old text. Call on the UI thread.
+    pub fn load(path: impl AsRef<Path>) -> Result<()> {
+        let path_wide: Vec<u16> = OsStr::new(path.as_ref()).encode_wide().chain(Some(0)).collect();
+        let result = unsafe { ffi::xaml_string_table_load(path_wide.as_ptr()) };
+        if result != 0 {
+            return Err(Error::invalid_operation(format!("Failed to load string table {}", path.as_ref().display())));
+        }
+        Ok(())
+    }
+
+    /// Release the active table. Labels keep their text.
+    pub fn unload() -> Result<()> {
+        let result = unsafe { ffi::xaml_string_table_unload() };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to unload string table"));
+        }
+        Ok(())
+    }
+
+    pub fn info() -> Result<StringTableInfo> {
+        let mut raw = ffi::XamlStringTableInfo::default();
+        let result = unsafe { ffi::xaml_string_table_get_info(&mut raw) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to read string table info"));
+        }
+        let locale_len = raw.locale.iter().position(|&c| c == 0).unwrap_or(raw.locale.len());
+        Ok(StringTableInfo {
+            count: raw.count,
+            locale: String::from_utf16_lossy(&raw.locale[..locale_len]),
+            bound_elements: raw.bound_elements,
+            generation: raw.generation,
+            cache_hits: raw.cache_hits,
+            cache_misses: raw.cache_misses,
+        })
+    }
+
+    /// Serialize `strings`, indexed by position, into the file format
+    /// [`load`](Self::load) reads.
+    pub fn build<S: AsRef<str>>(locale: &str, strings: &[S]) -> Vec<u8> {
+        let count = u32::try_from(strings.len()).expect("too many strings");
+        let mut data: Vec<u16> = locale.encode_utf16().chain(Some(0)).collect();
+        let mut offsets = Vec::with_capacity(strings.len() + 1);
+        for s in strings {
+            offsets.push(data.len() as u32);
+            data.extend(s.as_ref().encode_utf16().chain(Some(0)));
+        }
+        offsets.push(data.len() as u32);
+
+        let mut out = Vec::with_capacity(16 + offsets.len() * 4 + data.len() * 2);
+        for word in [MAGIC, VERSION, count, 0].into_iter().chain(offsets) {
+            out.extend_from_slice(&word.to_le_bytes());
+        }
+        for unit in data {
+            out.extend_from_slice(&unit.to_le_bytes());
+        }
+        out
+    }
+}
+
+impl XamlButton {
+    /// Show string `id` of the active [`StringTable`] as the content, and
+    /// follow it across table loads until the content is set otherwise.
+    pub fn set_content_id(&self, id: u32) -> Result<()> {
+        let result = unsafe { ffi::xaml_button_set_content_id(self.handle, id) };
+        if result != 0 {
+            return Err(Error::invalid_operation(format!("Failed to set button content to string {}", id)));
+        }
+        Ok(())
+    }
+}
+
+impl XamlTextBlock {
+    /// Show string `id` of the active [`StringTable`], and follow it across
+    /// table loads until the text is set otherwise.
+    pub fn set_text_id(&self, id: u32) -> Result<()> {
+        let result = unsafe { ffi::xaml_textblock_set_text_id(self.handle, id) };
+        if result != 0 {
+            return Err(Error::invalid_operation(format!("Failed to set text to string {}", id)));
+        }
+        Ok(())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn words(bytes: &[u8]) -> Vec<u32> {
+        bytes.chunks_exact(4).map(|w| u32::from_le_bytes(w.try_into().unwrap())).collect()
+    }
+
+    #[test]
+    fn test_build_string_table() {
+        let bytes = StringTable::build("fr", &["Oui", "", "Non"]);
+        let header = words(&bytes[..32]);
+        // magic, version, count, locale offset, then offsets[count + 1].
+        assert_eq!(header, [MAGIC, VERSION, 3, 0, 3, 7, 8, 12]);
+
+        let data: Vec<u16> = bytes[32..].chunks_exact(2).map(|u| u16::from_le_bytes([u[0], u[1]])).collect();
+        assert_eq!(data.len(), 12);
+        assert_eq!(String::from_utf16(&data[..2]).unwrap(), "fr");
+        assert_eq!(String::from_utf16(&data[3..6]).unwrap(), "Oui");
+        assert_eq!(String::from_utf16(&data[8..11]).unwrap(), "Non");
+        assert!([2, 6, 7, 11].iter().all(|&i| data[i] == 0));
+
+        assert_eq!(words(&StringTable::build::<&str>("", &[])), [MAGIC, VERSION, 0, 0, 1]);
+    }
+}
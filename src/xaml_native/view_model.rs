@@ -0,0 +1,318 @@
+//! Bindable view models.
+//!
+//! Pushing every model change through a control setter costs one bridge call
+//! per property per change. A [`XamlViewModel`] is a native object with typed,
+//! named slots that elements bind to through XAML `Binding`. The host writes
+//! any number of slots in one call from any thread, and on the next frame XAML
+//! is told once about each slot whose value actually changed.
+
+use super::{ffi, XamlUIElement};
+use crate::error::{Error, Result};
+
+/// The value type of a view-model slot.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum SlotKind {
+    /// `f64`.
+    Number,
+    /// `i32`. Written numbers are rounded.
+    Integer,
+    Boolean,
+    Text,
+}
+
+impl SlotKind {
+    fn to_ffi(self) -> i32 {
+        match self {
+            SlotKind::Number => ffi::XAML_SLOT_NUMBER,
+            SlotKind::Integer => ffi::XAML_SLOT_INTEGER,
+            SlotKind::Boolean => ffi::XAML_SLOT_BOOLEAN,
+            SlotKind::Text => ffi::XAML_SLOT_TEXT,
+        }
+    }
+}
+
+/// An element property that slots bind to and that can be observed with
+/// [`XamlUIElement::observe_property`]. The slot kind of each is noted;
+/// `Content` takes any kind and cannot be observed.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum ElementProperty {
+    /// [`SlotKind::Text`]. TextBlock and TextBox.
+    Text,
+    /// Any kind. Button, CheckBox and RadioButton.
+    Content,
+    /// [`SlotKind::Number`]. Slider and ProgressBar.
+    Value,
+    /// [`SlotKind::Boolean`]. CheckBox and RadioButton.
+    IsChecked,
+    /// [`SlotKind::Integer`]. ComboBox and ListView.
+    SelectedIndex,
+    /// [`SlotKind::Boolean`]. Controls.
+    IsEnabled,
+    /// [`SlotKind::Number`]. Any element.
+    Opacity,
+    /// [`SlotKind::Number`]. Any element.
+    Width,
+    /// [`SlotKind::Number`]. Any element.
+    Height,
+    /// [`SlotKind::Boolean`]. ToggleSwitch.
+    IsOn,
+    /// [`SlotKind::Number`]. ScrollViewer; read-only, so observable but not
+    /// bindable.
+    HorizontalOffset,
+    /// [`SlotKind::Number`]. ScrollViewer; read-only.
+    VerticalOffset,
+}
+
+impl ElementProperty {
+    pub(crate) fn to_ffi(self) -> i32 {
+        match self {
+            ElementProperty::Text => ffi::XAML_PROP_TEXT,
+            ElementProperty::Content => ffi::XAML_PROP_CONTENT,
+            ElementProperty::Value => ffi::XAML_PROP_VALUE,
+            ElementProperty::IsChecked => ffi::XAML_PROP_IS_CHECKED,
+            ElementProperty::SelectedIndex => ffi::XAML_PROP_SELECTED_INDEX,
+            ElementProperty::IsEnabled => ffi::XAML_PROP_IS_ENABLED,
+            ElementProperty::Opacity => ffi::XAML_PROP_OPACITY,
+            ElementProperty::Width => ffi::XAML_PROP_WIDTH,
+            ElementProperty::Height => ffi::XAML_PROP_HEIGHT,
+            ElementProperty::IsOn => ffi::XAML_PROP_IS_ON,
+            ElementProperty::HorizontalOffset => ffi::XAML_PROP_HORIZONTAL_OFFSET,
+            ElementProperty::VerticalOffset => ffi::XAML_PROP_VERTICAL_OFFSET,
+        }
+    }
+
+    pub(crate) fn from_ffi(value: i32) -> Option<Self> {
+        const ALL: [ElementProperty; 12] = [
+            ElementProperty::Text,
+            ElementProperty::Content,
+            ElementProperty::Value,
+            ElementProperty::IsChecked,
+            ElementProperty::SelectedIndex,
+            ElementProperty::IsEnabled,
+            ElementProperty::Opacity,
+            ElementProperty::Width,
+            ElementProperty::Height,
+            ElementProperty::IsOn,
+            ElementProperty::HorizontalOffset,
+            ElementProperty::VerticalOffset,
+        ];
+        ALL.into_iter().find(|property| property.to_ffi() == value)
+    }
+}
+
+/// Counters of a [`XamlViewModel`].
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct ViewModelStats {
+    pub slots: u32,
+    /// Slot writes received.
+    pub writes: u64,
+    /// Writes that changed a slot's value.
+    pub changes: u64,
+    /// Change notifications raised to XAML.
+    pub notifications: u64,
+    /// Frames that raised any.
+    pub flushes: u64,
+}
+
+/// Slot writes collected for one [`XamlViewModel::write`] call. Reuse it
+/// across frames with [`clear`](Self::clear).
+#[derive(Debug, Clone, Default)]
+pub struct SlotBatch {
+    writes: Vec<SlotEntry>,
+    text: Vec<u16>,
+}
+
+#[derive(Debug, Clone, Copy)]
+struct SlotEntry {
+    slot: u32,
+    number: f64,
+    // Range in `text`, for text slots.
+    text: Option<(usize, usize)>,
+}
+
+impl SlotBatch {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Write a number, integer or boolean slot.
+    pub fn set_number(&mut self, slot: u32, value: f64) -> &mut Self {
+        self.writes.push(SlotEntry { slot, number: value, text: None });
+        self
+    }
+
+    pub fn set_bool(&mut self, slot: u32, value: bool) -> &mut Self {
+        self.set_number(slot, if value { 1.0 } else { 0.0 })
+    }
+
+    /// Write a text slot.
+    pub fn set_text(&mut self, slot: u32, value: &str) -> &mut Self {
+        let start = self.text.len();
+        self.text.extend(value.encode_utf16());
+        self.writes.push(SlotEntry { slot, number: 0.0, text: Some((start, self.text.len())) });
+        self
+    }
+
+    pub fn len(&self) -> usize {
+        self.writes.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.writes.is_empty()
+    }
+
+    pub fn clear(&mut self) {
+        self.writes.clear();
+        self.text.clear();
+    }
+
+    // Borrows `self.text`, so the batch must outlive the returned writes.
+    fn to_ffi(&self) -> Vec<ffi::XamlSlotWrite> {
+        self.writes
+            .iter()
+            .map(|entry| match entry.text {
+                Some((start, end)) => ffi::XamlSlotWrite {
+                    slot: entry.slot,
+                    text_length: (end - start) as i32,
+                    number: 0.0,
+                    text: self.text[start..end].as_ptr(),
+                },
+                None => ffi::XamlSlotWrite { slot: entry.slot, text_length: 0, number: entry.number, text: std::ptr::null() },
+            })
+            .collect()
+    }
+}
+
+/// A native object whose slots XAML elements bind to.
+///
+/// Slots are added and bound on the UI thread. [`write`](Self::write) may run
+/// on any thread; bound elements update on the next frame, once per changed
+/// slot however often it was written. It may be dropped on any thread.
+///
+/// # Example
+/// ```no_run
+/// use winrt_xaml::xaml_native::{ElementProperty, SlotBatch, SlotKind, XamlTextBlock, XamlViewModel};
+///
+/// let model = XamlViewModel::new()?;
+/// let status = model.add_slot("Status", SlotKind::Text)?;
+/// let label = XamlTextBlock::new()?;
+/// model.bind(status, &label.as_uielement(), ElementProperty::Text)?;
+///
+/// let mut batch = SlotBatch::new();
+/// batch.set_text(status, "Connected");
+/// model.write(&batch)?;
+/// # Ok::<(), winrt_xaml::Error>(())
+/// ```
+pub struct XamlViewModel {
+    handle: ffi::XamlViewModelHandle,
+}
+
+impl XamlViewModel {
+    /// Create a view model on the UI thread.
+    pub fn new() -> Result<Self> {
+        let handle = unsafe { ffi::xaml_viewmodel_create() };
+        if handle.0.is_null() {
+            return Err(Error::control_creation("Failed to create view model"));
+        }
+        Ok(Self { handle })
+    }
+
+    /// Add a slot holding 0, `false` or the empty string, and return its
+    /// index. Markup under a [`set_data_context`](Self::set_data_context)
+    /// element binds to it as `{Binding name}`.
+    pub fn add_slot(&self, name: &str, kind: SlotKind) -> Result<u32> {
+        let name_wide: Vec<u16> = name.encode_utf16().chain(std::iter::once(0)).collect();
+        let slot = unsafe { ffi::xaml_viewmodel_add_slot(self.handle, name_wide.as_ptr(), kind.to_ffi()) };
+        if slot < 0 {
+            return Err(Error::invalid_operation(format!("Failed to add view model slot {}", name)));
+        }
+        Ok(slot as u32)
+    }
+
+    /// Apply every write in `batch` in one bridge call. Fails without
+    /// writing anything if any slot index is out of range.
+    pub fn write(&self, batch: &SlotBatch) -> Result<()> {
+        if batch.is_empty() {
+            return Ok(());
+        }
+        let count = i32::try_from(batch.len()).map_err(|_| Error::invalid_operation("Slot batch is too large"))?;
+        let writes = batch.to_ffi();
+        let result = unsafe { ffi::xaml_viewmodel_write(self.handle, writes.as_ptr(), count) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to write view model slots"));
+        }
+        Ok(())
+    }
+
+    /// Bind `property` of `element` to `slot`, one way. Fails when the
+    /// element lacks the property or the slot kind does not fit it.
+    pub fn bind(&self, slot: u32, element: &XamlUIElement, property: ElementProperty) -> Result<()> {
+        let result = unsafe { ffi::xaml_viewmodel_bind(self.handle, slot, element.handle(), property.to_ffi()) };
+        if result != 0 {
+            return Err(Error::invalid_operation(format!("Failed to bind {:?} to slot {}", property, slot)));
+        }
+        Ok(())
+    }
+
+    /// Make this the DataContext of `element` and its descendants.
+    pub fn set_data_context(&self, element: &XamlUIElement) -> Result<()> {
+        let result = unsafe { ffi::xaml_viewmodel_set_data_context(self.handle, element.handle()) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to set view model as DataContext"));
+        }
+        Ok(())
+    }
+
+    pub(crate) fn handle(&self) -> ffi::XamlViewModelHandle {
+        self.handle
+    }
+
+    pub fn stats(&self) -> Result<ViewModelStats> {
+        let mut raw = ffi::XamlViewModelStats::default();
+        let result = unsafe { ffi::xaml_viewmodel_get_stats(self.handle, &mut raw) };
+        if result != 0 {
+            return Err(Error::invalid_operation("Failed to read view model stats"));
+        }
+        Ok(ViewModelStats {
+            slots: raw.slots,
+            writes: raw.writes,
+            changes: raw.changes,
+            notifications: raw.notifications,
+            flushes: raw.flushes,
+        })
+    }
+}
+
+impl Drop for XamlViewModel {
+    fn drop(&mut self) {
+        unsafe {
+            ffi::xaml_viewmodel_destroy(self.handle);
+        }
+    }
+}
+
+unsafe impl Send for XamlViewModel {}
+unsafe impl Sync for XamlViewModel {}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_slot_batch_encoding() {
+        let mut batch = SlotBatch::new();
+        batch.set_number(0, 2.5).set_text(1, "ab").set_bool(2, true).set_text(3, "");
+        let writes = batch.to_ffi();
+        assert_eq!(writes.len(), 4);
+        assert_eq!((writes[0].slot, writes[0].number), (0, 2.5));
+        assert!(writes[0].text.is_null());
+        assert_eq!(writes[1].text_length, 2);
+        let text = unsafe { std::slice::from_raw_parts(writes[1].text, 2) };
+        assert_eq!(String::from_utf16(text).unwrap(), "ab");
+        assert_eq!(writes[2].number, 1.0);
+        assert!(!writes[3].text.is_null() && writes[3].text_length == 0);
+
+        batch.clear();
+        assert!(batch.is_empty() && batch.to_ffi().is_empty());
+    }
+}
@@ -2,7 +2,11 @@
 
 #[cfg(feature = "xaml-islands")]
 mod animation_tests {
-    use winrt_xaml::xaml_native::{XamlDoubleAnimation, XamlColorAnimation, XamlStoryboard};
+    use winrt_xaml::xaml_native::{
+        animate_staggered, animation_stats, set_active_animation_limit, AnimSpec, ColorKeyFrame,
+        DoubleKeyFrame, EasingMode, KeyFrameEasing, XamlColorAnimation, XamlDoubleAnimation,
+        XamlKeyFrameAnimation, XamlStoryboard, XamlStoryboardTemplate,
+    };
 
     #[test]
     fn test_storyboard_create() {
@@ -153,4 +157,70 @@ mod animation_tests {
         assert!(storyboard.add_animation(&anim1).is_ok());
         assert!(storyboard.add_animation(&anim2).is_ok());
     }
+
+    #[test]
+    fn test_keyframe_animation_set_keyframes() {
+        let animation = XamlKeyFrameAnimation::new_double().unwrap();
+        let result = animation.set_double_keyframes(&[
+            DoubleKeyFrame { time_ms: 0.0, value: 0.0, easing: KeyFrameEasing::Linear },
+            DoubleKeyFrame { time_ms: 300.0, value: 1.0, easing: KeyFrameEasing::Cubic(EasingMode::InOut) },
+            DoubleKeyFrame { time_ms: 600.0, value: 0.5, easing: KeyFrameEasing::Bounce(EasingMode::Out) },
+        ]);
+        assert!(result.is_ok(), "Should set double keyframes");
+
+        let storyboard = XamlStoryboard::new().unwrap();
+        assert!(storyboard.add_keyframe_animation(&animation).is_ok());
+    }
+
+    #[test]
+    fn test_color_keyframe_animation() {
+        let animation = XamlKeyFrameAnimation::new_color().unwrap();
+        let result = animation.set_color_keyframes(&[
+            ColorKeyFrame { time_ms: 0.0, color: 0xFFFF0000, easing: KeyFrameEasing::Linear },
+            ColorKeyFrame { time_ms: 400.0, color: 0xFF0000FF, easing: KeyFrameEasing::Sine(EasingMode::Out) },
+        ]);
+        assert!(result.is_ok(), "Should set color keyframes");
+
+        let wrong = animation.set_double_keyframes(&[]);
+        assert!(wrong.is_err(), "Color animation should reject double keyframes");
+    }
+
+    #[test]
+    fn test_storyboard_template_create() {
+        let template = XamlStoryboardTemplate::new(&[
+            AnimSpec::double("Opacity", Some(1.0), 0.5, 150).easing(KeyFrameEasing::Quad(EasingMode::Out)),
+            AnimSpec::color("(Border.Background).(SolidColorBrush.Color)", None, 0xFF202020, 150),
+        ]);
+        assert!(template.is_ok(), "Should create storyboard template");
+        assert_eq!(template.unwrap().pooled_count(), 0);
+    }
+
+    #[test]
+    fn test_storyboard_template_rejects_discrete_easing() {
+        let template = XamlStoryboardTemplate::new(&[
+            AnimSpec::double("Opacity", None, 0.0, 100).easing(KeyFrameEasing::Discrete),
+        ]);
+        assert!(template.is_err(), "Discrete easing is not valid for From/To animations");
+    }
+
+    #[test]
+    fn test_animate_staggered_requires_targets() {
+        let cascade = animate_staggered(&[], &[AnimSpec::double("Opacity", Some(0.0), 1.0, 200)], 40);
+        assert!(cascade.is_err(), "A staggered storyboard needs at least one target");
+    }
+
+    #[test]
+    fn test_storyboard_on_completed_registers() {
+        let storyboard = XamlStoryboard::new().unwrap();
+        let result = storyboard.on_completed(|| {});
+        assert!(result.is_ok(), "Should register completion handler");
+    }
+
+    #[test]
+    fn test_active_animation_limit() {
+        assert!(set_active_animation_limit(Some(64)).is_ok());
+        let stats = animation_stats().unwrap();
+        assert!(stats.active_dependent <= stats.active_animations);
+        assert!(set_active_animation_limit(None).is_ok());
+    }
 }
@@ -405,6 +405,29 @@ mod xaml_native_comprehensive {
         listview.set_selected_index(-1).unwrap(); // Clear selection
     }
 
+    #[test]
+    fn test_grouped_listview_selection() {
+        use std::sync::{Arc, Mutex};
+
+        let listview = XamlListView::new().unwrap();
+        // Shown as a0, a1 under "A", then b0 under "B": b0 is item 1 but
+        // the third row.
+        listview.set_grouped_items(&[("a0", "A"), ("b0", "B"), ("a1", "A")]).unwrap();
+
+        let reported = Arc::new(Mutex::new(Vec::new()));
+        let reported_clone = reported.clone();
+        listview.on_selection_changed(move |index| {
+            reported_clone.lock().unwrap().push(index);
+        }).unwrap();
+
+        // Selection is reported as insertion positions, like item indices.
+        listview.set_selected_index(1).unwrap();
+        assert_eq!(listview.selected_index(), 1);
+        assert_eq!(listview.selected_indices().unwrap(), vec![1]);
+        listview.set_selected_index(-1).unwrap();
+        assert_eq!(listview.selected_index(), -1);
+    }
+
     #[test]
     fn test_listview_selection_mode() {
         let listview = XamlListView::new().unwrap();
@@ -82,9 +82,25 @@ fn test_xaml_source_api_exists() {
     // Verify XamlSource API structure
     fn _check_api() {
         let _ = XamlSource::new;
+        let _ = XamlSource::set_visible;
+        let _ = XamlSource::activity;
+        let _ = XamlSource::enable_frame_stats;
+        let _ = XamlSource::frame_stats;
     }
 }
 
+#[test]
+fn test_frame_stats_ratios() {
+    let empty = FrameStats::default();
+    assert_eq!(empty.missed_ratio(), 0.0);
+    assert_eq!(empty.calls_per_frame(), 0.0);
+
+    let stats = FrameStats { frames: 200, missed_frames: 5, bridge_calls: 600, ..FrameStats::default() };
+    assert_eq!(stats.missed_ratio(), 0.025);
+    assert_eq!(stats.calls_per_frame(), 3.0);
+    assert_eq!(FrameStats::INTERVAL_BOUNDS_MS.len() + 1, stats.interval_buckets.len());
+}
+
 #[test]
 fn test_xaml_button_api_exists() {
     // Verify XamlButton API structure
@@ -361,6 +377,176 @@ fn test_styling_api_exists() {
     }
 }
 
+// Test that rich text runs exist
+#[test]
+fn test_text_runs_api_exists() {
+    use winrt_xaml::error::Result;
+
+    fn _check_runs() {
+        fn _needs_set_runs(_: fn(&XamlTextBlock, &str, &[TextRun]) -> Result<()>) {}
+        _needs_set_runs(XamlTextBlock::set_runs);
+    }
+    let run = TextRun::new(0..5).foreground(0xFFE74856).weight(700).italic();
+    assert_eq!(run.range, 0..5);
+    assert_eq!((run.foreground, run.weight, run.italic), (Some(0xFFE74856), Some(700), true));
+}
+
+// Test that numeric text exists
+#[test]
+fn test_number_text_api_exists() {
+    use winrt_xaml::error::Result;
+
+    fn _check_number() {
+        fn _needs_set_number(_: fn(&XamlTextBlock, f64, &NumberFormat) -> Result<()>) {}
+        _needs_set_number(XamlTextBlock::set_number);
+    }
+    let format = NumberFormat::fixed(2).grouping().prefix("$");
+    assert_ne!(format, NumberFormat::default());
+    assert_eq!(NumberFormat::fixed(99), NumberFormat::fixed(NumberFormat::MAX_PRECISION));
+}
+
+// Test that the log view exists
+#[test]
+fn test_log_view_api_exists() {
+    use winrt_xaml::error::Result;
+
+    fn _check_log_view() {
+        fn _needs_new(_: fn(usize) -> Result<XamlLogView>) {}
+        fn _needs_append(_: fn(&XamlLogView, &str) -> Result<()>) {}
+        fn _needs_stats(_: fn(&XamlLogView) -> Result<LogViewStats>) {}
+        _needs_new(XamlLogView::new);
+        _needs_append(XamlLogView::append);
+        _needs_stats(XamlLogView::stats);
+        let _ = XamlLogView::append_lines::<&[String], &String>;
+    }
+    fn _is_send_sync<T: Send + Sync>() {}
+    _is_send_sync::<XamlLogView>();
+    assert!(!LogViewStats::default().follow_tail);
+}
+
+// Test that string tables exist
+#[test]
+fn test_string_table_api_exists() {
+    use winrt_xaml::error::Result;
+
+    fn _check_string_table() {
+        fn _needs_unload(_: fn() -> Result<()>) {}
+        fn _needs_info(_: fn() -> Result<StringTableInfo>) {}
+        fn _needs_content_id(_: fn(&XamlButton, u32) -> Result<()>) {}
+        fn _needs_text_id(_: fn(&XamlTextBlock, u32) -> Result<()>) {}
+        _needs_unload(StringTable::unload);
+        _needs_info(StringTable::info);
+        _needs_content_id(XamlButton::set_content_id);
+        _needs_text_id(XamlTextBlock::set_text_id);
+        let _ = StringTable::load::<&str>;
+    }
+    let table = StringTable::build("en-US", &["OK", "Cancel"]);
+    assert_eq!(&table[..4], b"XSTB");
+    assert_eq!(StringTableInfo::default().count, 0);
+}
+
+// Test that view models exist
+#[test]
+fn test_view_model_api_exists() {
+    use winrt_xaml::error::Result;
+
+    fn _check_view_model() {
+        fn _needs_new(_: fn() -> Result<XamlViewModel>) {}
+        fn _needs_add_slot(_: fn(&XamlViewModel, &str, SlotKind) -> Result<u32>) {}
+        fn _needs_write(_: fn(&XamlViewModel, &SlotBatch) -> Result<()>) {}
+        fn _needs_bind(_: fn(&XamlViewModel, u32, &XamlUIElement, ElementProperty) -> Result<()>) {}
+        fn _needs_stats(_: fn(&XamlViewModel) -> Result<ViewModelStats>) {}
+        _needs_new(XamlViewModel::new);
+        _needs_add_slot(XamlViewModel::add_slot);
+        _needs_write(XamlViewModel::write);
+        _needs_bind(XamlViewModel::bind);
+        _needs_stats(XamlViewModel::stats);
+    }
+    fn _is_send_sync<T: Send + Sync>() {}
+    _is_send_sync::<XamlViewModel>();
+
+    let mut batch = SlotBatch::new();
+    batch.set_number(0, 1.0).set_bool(1, false).set_text(2, "ok");
+    assert_eq!(batch.len(), 3);
+    batch.clear();
+    assert!(batch.is_empty());
+    assert_eq!(ViewModelStats::default().notifications, 0);
+}
+
+// Test that property observation exists
+#[test]
+fn test_property_observer_api_exists() {
+    use winrt_xaml::error::Result;
+
+    fn _check_property_observer() {
+        fn _needs_observe(_: fn(&XamlUIElement, ElementProperty, u64) -> Result<()>) {}
+        fn _needs_clear(_: fn() -> Result<()>) {}
+        _needs_observe(XamlUIElement::observe_property);
+        _needs_observe(XamlUIElement::unobserve_property);
+        _needs_clear(clear_property_observer);
+        let _ = set_property_observer::<fn(&[PropertyChange])>;
+    }
+    let change = PropertyChange {
+        tag: 1,
+        property: ElementProperty::IsOn,
+        old: PropertyValue::Boolean(Some(false)),
+        new: PropertyValue::Boolean(Some(true)),
+    };
+    assert_ne!(change.old, change.new);
+}
+
+// Test that reactive property bindings exist
+#[test]
+fn test_property_bindings_api_exists() {
+    use winrt_xaml::error::Result;
+    use winrt_xaml::reactive::{Property, SubscriptionId};
+
+    fn _check_property_bindings() {
+        fn _needs_new(_: fn() -> Result<PropertyBindings>) {}
+        fn _needs_bind<T: SlotValue>(_: fn(&PropertyBindings, &Property<T>, &XamlUIElement, ElementProperty) -> Result<SubscriptionId>) {}
+        fn _needs_stats(_: fn(&PropertyBindings) -> PropertyBindingStats) {}
+        _needs_new(PropertyBindings::new);
+        _needs_bind::<f64>(PropertyBindings::bind::<f64>);
+        _needs_bind::<String>(PropertyBindings::bind::<String>);
+        _needs_stats(PropertyBindings::stats);
+    }
+    assert_eq!(<bool as SlotValue>::KIND, SlotKind::Boolean);
+    assert_eq!(7_i32.to_value(), PropertyValue::Integer(7));
+    assert_eq!(PropertyBindingStats::default().writes, 0);
+}
+
+// Test that markup control templates exist
+#[test]
+fn test_control_template_api_exists() {
+    use winrt_xaml::error::Result;
+
+    fn _check_template() {
+        fn _needs_from_markup(_: fn(&str) -> Result<XamlControlTemplate>) {}
+        _needs_from_markup(XamlControlTemplate::from_markup);
+        fn _needs_stats(_: fn() -> Result<TemplateCacheStats>) {}
+        _needs_stats(XamlControlTemplate::cache_stats);
+        fn _needs_set_template(_: fn(&XamlButton, &XamlControlTemplate) -> Result<()>) {}
+        _needs_set_template(XamlButton::set_template);
+    }
+}
+
+// Test that shared styles exist
+#[test]
+fn test_shared_style_api_exists() {
+    use winrt_xaml::error::Result;
+
+    fn _check_style() {
+        fn _needs_new(_: fn(StyleTarget) -> Result<XamlStyle>) {}
+        _needs_new(XamlStyle::new);
+        fn _needs_setter(_: fn(&XamlStyle, StyleSetter) -> Result<()>) {}
+        _needs_setter(XamlStyle::add_setter);
+        fn _needs_apply(_: fn(&XamlStyle, &[&XamlUIElement]) -> Result<()>) {}
+        _needs_apply(XamlStyle::apply);
+        fn _needs_set_style(_: fn(&XamlUIElement, Option<&XamlStyle>) -> Result<()>) {}
+        _needs_set_style(XamlUIElement::set_style);
+    }
+}
+
 // Test that text-specific methods exist
 #[test]
 fn test_text_api_exists() {
@@ -400,6 +586,15 @@ fn test_text_api_exists() {
         fn _needs_method(_: fn(&XamlTextBox) -> Result<String>) {}
         _needs_method(XamlTextBox::get_text);
     }
+
+    fn _check_textbox_incremental_edits() {
+        fn _needs_len(_: fn(&XamlTextBox) -> Result<usize>) {}
+        fn _needs_append(_: fn(&XamlTextBox, &str) -> Result<()>) {}
+        fn _needs_replace(_: fn(&XamlTextBox, std::ops::Range<usize>, &str) -> Result<()>) {}
+        _needs_len(XamlTextBox::text_len);
+        _needs_append(XamlTextBox::append);
+        _needs_replace(XamlTextBox::replace_range);
+    }
 }
 
 // Test that layout methods exist
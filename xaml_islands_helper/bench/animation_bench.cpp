@@ -0,0 +1,128 @@
+// Animation helpers: storyboard classification and keyframe planning.
+
+#include "bench_util.h"
+#include "xaml_animation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace xaml_bridge;
+
+namespace {
+
+// Value of component 0 at `t_ms`, interpolating the planned keyframes the way
+// XAML does. The base value before the first key is `base`.
+double sample(const std::vector<PlannedKeyFrame>& frames, double base, double t_ms) {
+    double from = base;
+    double from_time = 0.0;
+    for (const auto& frame : frames) {
+        if (t_ms <= frame.time_ms) {
+            const double span = frame.time_ms - from_time;
+            const double x = span > 0.0 ? (t_ms - from_time) / span : 1.0;
+            double progress = x;
+            switch (frame.type) {
+            case KeyFrameType::Linear: break;
+            case KeyFrameType::Discrete: progress = x < 1.0 ? 0.0 : 1.0; break;
+            case KeyFrameType::Spline: progress = evaluate_key_spline(frame.spline, x); break;
+            case KeyFrameType::Eased: progress = ease(frame.kind, x); break;
+            }
+            return from + (frame.value[0] - from) * progress;
+        }
+        from = frame.value[0];
+        from_time = frame.time_ms;
+    }
+    return from;
+}
+
+double max_spline_error(uint8_t kind) {
+    KeySplinePoints spline;
+    CHECK(easing_key_spline(kind, spline));
+    double error = 0.0;
+    for (int i = 0; i <= 1000; ++i) {
+        const double x = i / 1000.0;
+        error = std::max(error, std::abs(evaluate_key_spline(spline, x) - ease(kind, x)));
+    }
+    return error;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool quick = bench::quick_mode(argc, argv);
+
+    // Independent vs dependent storyboard targets.
+    CHECK(is_independent_animation(u"Opacity", 300));
+    CHECK(is_independent_animation(u"(UIElement.RenderTransform).(TranslateTransform.X)", 300));
+    CHECK(is_independent_animation(
+        u"(UIElement.RenderTransform).(TransformGroup.Children)[0].(ScaleTransform.ScaleX)", 300));
+    CHECK(is_independent_animation(u"(Canvas.Left)", 300));
+    CHECK(is_independent_animation(u"(Border.Background).(SolidColorBrush.Color)", 300));
+    CHECK(is_independent_animation(u"Width", 0));
+    CHECK(!is_independent_animation(u"Width", 300));
+    CHECK(!is_independent_animation(u"(FrameworkElement.Margin)", 300));
+    CHECK(!is_independent_animation(u"RenderTransform", 300));
+
+    // Every spline-backed kind stays close to its curve; splitting InOut
+    // segments into In and Out halves tightens the fit further.
+    double worst_single = 0.0;
+    double worst_planned = 0.0;
+    for (uint8_t kind = 2; kind < kKeyFrameKindCount; ++kind) {
+        KeySplinePoints spline;
+        if (!easing_key_spline(kind, spline)) {
+            CHECK(easing_family(kind) >= EasingFamily::Back);
+            continue;
+        }
+        CHECK(spline.x1 >= 0 && spline.x1 <= 1 && spline.y1 >= 0 && spline.y1 <= 1);
+        CHECK(spline.x2 >= 0 && spline.x2 <= 1 && spline.y2 >= 0 && spline.y2 <= 1);
+        worst_single = std::max(worst_single, max_spline_error(kind));
+
+        const float times[] = {100.0f, 1100.0f};
+        const float values[] = {10.0f, 30.0f};
+        const uint8_t kinds[] = {kKeyFrameLinear, kind};
+        const auto planned = plan_keyframes(times, values, kinds, 2, 1);
+        CHECK(planned.size() == (easing_mode(kind) == EasingMode::InOut ? 3u : 2u));
+        for (int i = 0; i <= 1000; ++i) {
+            const double expected = 10.0 + 20.0 * ease(kind, i / 1000.0);
+            worst_planned = std::max(worst_planned, std::abs(sample(planned, 0.0, 100.0 + i) - expected) / 20.0);
+        }
+    }
+    std::printf("animation_bench: max spline error %.4f single, %.4f planned\n", worst_single, worst_planned);
+    CHECK(worst_single < 0.045);
+    CHECK(worst_planned < 0.015);
+
+    // Keys arrive in any order; the plan is in time order and keeps overshooting
+    // curves as eased keyframes.
+    {
+        const float times[] = {500.0f, 0.0f, 250.0f};
+        const float values[] = {1.0f, 0.0f, 0.5f};
+        const uint8_t kinds[] = {eased_kind(EasingFamily::Bounce, EasingMode::Out), kKeyFrameDiscrete,
+                                 eased_kind(EasingFamily::Quad, EasingMode::In)};
+        const auto planned = plan_keyframes(times, values, kinds, 3, 1);
+        CHECK(planned.size() == 3);
+        CHECK(planned[0].type == KeyFrameType::Discrete && planned[0].time_ms == 0.0f);
+        CHECK(planned[1].type == KeyFrameType::Spline && planned[1].value[0] == 0.5f);
+        CHECK(planned[2].type == KeyFrameType::Eased && planned[2].kind == kinds[0]);
+    }
+
+    // Planning cost for a large batch of color keys (4 components).
+    const size_t keys = quick ? 2000 : 200000;
+    const int iterations = quick ? 1 : 5;
+    bench::Rng rng;
+    std::vector<float> times(keys);
+    std::vector<float> values(keys * 4);
+    std::vector<uint8_t> kinds(keys);
+    for (size_t i = 0; i < keys; ++i) {
+        times[i] = static_cast<float>(i * 16);
+        for (size_t c = 0; c < 4; ++c) {
+            values[i * 4 + c] = static_cast<float>(rng.below(256));
+        }
+        kinds[i] = static_cast<uint8_t>(rng.below(kKeyFrameKindCount));
+    }
+    size_t planned_count = 0;
+    bench::measure("plan_keyframes", iterations, [&] {
+        planned_count = plan_keyframes(times.data(), values.data(), kinds.data(), keys, 4).size();
+    });
+    CHECK(planned_count >= keys);
+    return 0;
+}
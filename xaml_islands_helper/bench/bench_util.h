@@ -0,0 +1,74 @@
+#pragma once
+
+// Shared helpers for the native kernel benchmarks.
+//
+// Every benchmark accepts --quick, which shrinks the workload so ctest can
+// run it as a smoke test; CHECK failures exit non-zero in either mode.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#define CHECK(cond)                                                          \
+    do {                                                                     \
+        if (!(cond)) {                                                       \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__,      \
+                         __LINE__, #cond);                                   \
+            std::exit(1);                                                    \
+        }                                                                    \
+    } while (0)
+
+namespace bench {
+
+inline bool quick_mode(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--quick") == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Deterministic xorshift generator so runs are comparable.
+struct Rng {
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+
+    uint64_t next() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    uint32_t below(uint32_t bound) { return static_cast<uint32_t>(next() % bound); }
+};
+
+inline std::u16string make_word(Rng& rng, size_t length) {
+    std::u16string word;
+    word.reserve(length);
+    for (size_t i = 0; i < length; ++i) {
+        const uint32_t r = rng.below(36);
+        word.push_back(r < 26 ? static_cast<char16_t>((rng.below(2) ? u'a' : u'A') + r)
+                              : static_cast<char16_t>(u'0' + (r - 26)));
+    }
+    return word;
+}
+
+// Run fn `iterations` times and print the mean wall time per run.
+template <class Fn>
+double measure(const char* name, int iterations, Fn&& fn) {
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        fn();
+    }
+    const double ms =
+        std::chrono::duration<double, std::milli>(clock::now() - start).count() / iterations;
+    std::printf("  %-44s %10.3f ms\n", name, ms);
+    return ms;
+}
+
+} // namespace bench
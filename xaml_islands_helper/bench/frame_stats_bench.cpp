@@ -0,0 +1,103 @@
+// Frame pacing statistics: missed-frame detection, refresh estimation and
+// the cost of recording one frame while another thread reads snapshots.
+
+#include "bench_util.h"
+#include "xaml_frame_stats.h"
+
+#include <atomic>
+#include <cmath>
+#include <numeric>
+#include <thread>
+
+using namespace xaml_bridge;
+
+namespace {
+
+constexpr double k60Hz = 1000.0 / 60.0;
+constexpr double k120Hz = 1000.0 / 120.0;
+
+bool near(double a, double b) { return std::abs(a - b) < 1e-3; }
+
+uint64_t sum(const std::array<uint64_t, kFrameIntervalBuckets>& buckets) {
+    return std::accumulate(buckets.begin(), buckets.end(), uint64_t{0});
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool quick = bench::quick_mode(argc, argv);
+
+    // Bucketing.
+    CHECK(FrameStats::interval_bucket(k120Hz) == 1);
+    CHECK(FrameStats::interval_bucket(k60Hz) == 3);
+    CHECK(FrameStats::interval_bucket(2 * k60Hz) == 5);
+    CHECK(FrameStats::interval_bucket(1000.0) == kFrameIntervalBuckets - 1);
+    CHECK(FrameStats::work_bucket(0) == 0);
+    CHECK(FrameStats::work_bucket(1) == 1);
+    CHECK(FrameStats::work_bucket(3) == 2);
+    CHECK(FrameStats::work_bucket(4) == 3);
+    CHECK(FrameStats::work_bucket(uint64_t{1} << 40) == kFrameWorkBuckets - 1);
+
+    // A steady 60 Hz stream with a dropped frame every 30 frames.
+    {
+        FrameStats stats;
+        for (int frame = 1; frame <= 300; ++frame) {
+            stats.record(frame % 30 == 0 ? 2 * k60Hz : k60Hz, frame % 4);
+        }
+        const FrameStatsSnapshot snapshot = stats.snapshot();
+        CHECK(snapshot.frames == 300);
+        CHECK(snapshot.missed_frames == 10);
+        CHECK(near(snapshot.refresh_ms, k60Hz));
+        CHECK(near(snapshot.max_interval_ms, 2 * k60Hz));
+        CHECK(snapshot.total_work == 75 * (0 + 1 + 2 + 3));
+        CHECK(sum(snapshot.interval_buckets) == 300);
+        CHECK(snapshot.interval_buckets[3] == 290);
+        CHECK(snapshot.work_buckets[0] == 75 && snapshot.work_buckets[2] == 150);
+    }
+
+    // The refresh estimate follows a switch to 120 Hz after one window, after
+    // which 60 Hz intervals count as missed.
+    {
+        FrameStats stats;
+        for (int frame = 0; frame < 120; ++frame) {
+            stats.record(k120Hz, 0);
+        }
+        CHECK(near(stats.snapshot().refresh_ms, k120Hz));
+        CHECK(stats.snapshot().missed_frames == 0);
+        stats.record(k60Hz, 0);
+        CHECK(stats.snapshot().missed_frames == 1);
+        stats.reset();
+        CHECK(stats.snapshot().frames == 0 && sum(stats.snapshot().interval_buckets) == 0);
+    }
+
+    // Record on this thread while a reader polls snapshots.
+    const int frames = quick ? 20000 : 5000000;
+    FrameStats stats;
+    std::atomic<bool> done{false};
+    uint64_t snapshots = 0;
+    bool monotonic = true;
+    std::thread reader([&] {
+        uint64_t last = 0;
+        while (!done.load(std::memory_order_acquire)) {
+            const uint64_t seen = stats.snapshot().frames;
+            monotonic = monotonic && seen >= last;
+            last = seen;
+            ++snapshots;
+        }
+    });
+    bench::Rng rng;
+    bench::measure("record frame", frames, [&] {
+        const double jitter = rng.below(1000) / 1000.0 - 0.5;
+        stats.record(k60Hz + jitter + (rng.below(100) == 0 ? k60Hz : 0.0), rng.below(64));
+    });
+    done.store(true, std::memory_order_release);
+    reader.join();
+    std::printf("  %llu concurrent snapshots\n", static_cast<unsigned long long>(snapshots));
+
+    const FrameStatsSnapshot snapshot = stats.snapshot();
+    CHECK(monotonic);
+    CHECK(snapshot.frames == static_cast<uint64_t>(frames));
+    CHECK(sum(snapshot.interval_buckets) == snapshot.frames);
+    CHECK(snapshot.missed_frames > 0 && snapshot.missed_frames < snapshot.frames / 20);
+    return 0;
+}
@@ -0,0 +1,139 @@
+// Grouping kernel behind xaml_listview_set_grouped_items.
+
+#include "bench_util.h"
+#include "xaml_group.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <vector>
+
+using namespace xaml_bridge;
+
+namespace {
+
+std::vector<std::u16string> make_keys(bench::Rng& rng, size_t count, size_t categories) {
+    std::vector<std::u16string> names(categories);
+    for (auto& name : names) {
+        name = bench::make_word(rng, 4 + rng.below(8));
+    }
+    std::vector<std::u16string> keys(count);
+    for (auto& key : keys) {
+        // Skewed towards the first categories, like contact initials.
+        const uint32_t a = rng.below(static_cast<uint32_t>(categories));
+        key = names[std::min(a, rng.below(static_cast<uint32_t>(categories)))];
+    }
+    return keys;
+}
+
+// Every item sits in its key's group, in insertion order. Right after assign
+// the groups also follow first appearance; incremental edits keep existing
+// groups in place and add new ones at the end.
+void verify(const GroupIndex& index, const std::vector<std::u16string>& keys, bool first_appearance) {
+    CHECK(index.item_count() == keys.size());
+    std::map<std::u16string, size_t> seen;
+    size_t total = 0;
+    for (size_t g = 0; g < index.group_count(); ++g) {
+        CHECK(seen.emplace(index.key(g), g).second);
+        const auto& members = index.members(g);
+        CHECK(!members.empty());
+        CHECK(std::is_sorted(members.begin(), members.end()));
+        for (uint32_t item : members) {
+            CHECK(keys[item] == index.key(g));
+            CHECK(index.group_of(item) == g);
+        }
+        total += members.size();
+        CHECK(!first_appearance || g == 0 || index.members(g - 1).front() < members.front());
+    }
+    CHECK(total == keys.size());
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool quick = bench::quick_mode(argc, argv);
+    const size_t count = quick ? 5000 : 500000;
+    const int iterations = quick ? 1 : 5;
+    bench::Rng rng;
+    auto keys = make_keys(rng, count, 300);
+
+    std::printf("group_bench: %zu items, 300 keys\n", count);
+    std::vector<uint32_t> order(count);
+    bench::measure("std::stable_sort by key (baseline)", iterations, [&] {
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(),
+            [&](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+    });
+    std::map<std::u16string, std::vector<uint32_t>> tree;
+    bench::measure("std::map partition (baseline)", iterations, [&] {
+        tree.clear();
+        for (size_t i = 0; i < count; ++i) {
+            tree[keys[i]].push_back(static_cast<uint32_t>(i));
+        }
+    });
+
+    GroupIndex index;
+    bench::measure("GroupIndex::assign", iterations, [&] {
+        index.assign(keys);
+    });
+    verify(index, keys, true);
+    CHECK(index.group_count() == tree.size());
+
+    // Incremental regrouping against a full reassign per change.
+    const int edits = quick ? 200 : 1000;
+    bench::Rng edit_rng;
+    edit_rng.state = 7;
+    bench::measure("1 regroup via full assign", 1, [&] {
+        auto copy = keys;
+        copy[0] = u"moved";
+        GroupIndex scratch;
+        scratch.assign(copy);
+    });
+    bench::measure("set_key x edits (incremental)", 1, [&] {
+        for (int e = 0; e < edits; ++e) {
+            const size_t item = edit_rng.below(static_cast<uint32_t>(keys.size()));
+            const std::u16string& key = keys[edit_rng.below(static_cast<uint32_t>(keys.size()))];
+            const auto move = index.set_key(item, key);
+            CHECK(move.moved == (keys[item] != key));
+            keys[item] = key;
+        }
+    });
+    verify(index, keys, false);
+
+    // A brand-new key creates a group at the end; moving its only item away removes it.
+    const auto created = index.set_key(3, u"zz-new-group");
+    CHECK(created.moved && created.to.group_changed && created.to.group == index.group_count() - 1);
+    keys[3] = u"zz-new-group";
+    verify(index, keys, false);
+    const auto removed = index.set_key(3, keys[4]);
+    CHECK(removed.from.group_changed);
+    keys[3] = keys[4];
+    verify(index, keys, false);
+
+    for (int e = 0; e < 50; ++e) {
+        const size_t item = edit_rng.below(static_cast<uint32_t>(keys.size()));
+        index.remove(item);
+        keys.erase(keys.begin() + item);
+    }
+    const auto appended = index.append(keys[0]);
+    keys.push_back(keys[0]);
+    CHECK(appended.group == index.group_of(0) && appended.position == index.members(appended.group).size() - 1);
+    verify(index, keys, false);
+
+    // Flattened positions, as a grouped ListView reports its selection, map
+    // back to items and round-trip.
+    std::vector<int> positions;
+    for (size_t p = 0; p < keys.size(); p += 97) {
+        positions.push_back(static_cast<int>(p));
+    }
+    const auto items = index.items_at(positions);
+    CHECK(items.size() == positions.size() && std::is_sorted(items.begin(), items.end()));
+    for (int position : positions) {
+        const size_t item = index.item_at(static_cast<size_t>(position));
+        CHECK(index.position_of(item) == static_cast<size_t>(position));
+        CHECK(std::binary_search(items.begin(), items.end(), static_cast<int>(item)));
+    }
+    CHECK(index.item_at(keys.size()) == GroupIndex::npos);
+    CHECK(index.items_at({static_cast<int>(keys.size())}).empty());
+    return 0;
+}
@@ -0,0 +1,200 @@
+// Sort and filter kernels behind xaml_listview_set_sort / xaml_listview_set_filter.
+
+#include "bench_util.h"
+#include "xaml_list_model.h"
+#include "xaml_parallel.h"
+#include "xaml_text.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace xaml_bridge;
+
+namespace {
+
+ListModel make_model(size_t count) {
+    bench::Rng rng;
+    ListModel model;
+    std::vector<double> column(count);
+    for (size_t i = 0; i < count; ++i) {
+        std::u16string text = bench::make_word(rng, 6 + rng.below(10));
+        text += u" #";
+        for (char c : std::to_string(rng.below(100000))) {
+            text.push_back(static_cast<char16_t>(c));
+        }
+        model.append(std::move(text));
+        column[i] = static_cast<double>(rng.below(1000000));
+    }
+    model.set_column(0, column.data(), column.size());
+    return model;
+}
+
+void verify_sorted(const ListModel& model, SortKind kind) {
+    for (size_t v = 1; v < model.view_size(); ++v) {
+        const auto& a = model.item(model.store_index(v - 1));
+        const auto& b = model.item(model.store_index(v));
+        switch (kind) {
+            case SortKind::Text:
+                CHECK(a <= b);
+                break;
+            case SortKind::TextIgnoreCase:
+                CHECK(fold_case(a) <= fold_case(b));
+                break;
+            case SortKind::Numeric: {
+                const double x = parse_leading_number(a);
+                const double y = parse_leading_number(b);
+                CHECK(std::isnan(y) || x <= y);
+                break;
+            }
+            case SortKind::Column:
+                break;
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool quick = bench::quick_mode(argc, argv);
+    const size_t count = quick ? 5000 : 200000;
+    const int iterations = quick ? 1 : 5;
+
+    std::printf("list_model_bench: %zu items, %zu worker(s)\n", count, worker_count(count, 16384));
+    ListModel model = make_model(count);
+
+    for (SortKind kind : {SortKind::Text, SortKind::TextIgnoreCase, SortKind::Numeric, SortKind::Column}) {
+        static const char* names[] = {
+            "set_sort(text)", "set_sort(text, ignore case)", "set_sort(numeric)", "set_sort(column)"};
+        bench::measure(names[static_cast<int>(kind)], iterations, [&] {
+            model.set_sort({SortKey{kind, 0, false}});
+        });
+        CHECK(model.view_size() == count);
+        verify_sorted(model, kind);
+    }
+
+    // Sequential baseline for the parallel merge sort.
+    std::vector<uint32_t> perm(count);
+    bench::measure("std::sort baseline (text)", iterations, [&] {
+        for (uint32_t i = 0; i < count; ++i) {
+            perm[i] = i;
+        }
+        std::sort(perm.begin(), perm.end(), [&](uint32_t a, uint32_t b) {
+            const int order = model.item(a).compare(model.item(b));
+            return order != 0 ? order < 0 : a < b;
+        });
+    });
+    model.set_sort({SortKey{SortKind::Text, 0, false}});
+    CHECK(std::equal(perm.begin(), perm.end(), model.view().begin()));
+
+    model.set_sort({});
+    FilterSpec contains;
+    contains.kind = FilterKind::Contains;
+    contains.ignore_case = true;
+    contains.text = u"ab";
+    bench::measure("set_filter(contains, ignore case)", iterations, [&] {
+        model.set_filter(contains);
+    });
+    for (size_t v = 0; v < model.view_size(); ++v) {
+        CHECK(fold_case(model.item(model.store_index(v))).find(u"ab") != std::u16string::npos);
+    }
+
+    FilterSpec range;
+    range.kind = FilterKind::ColumnRange;
+    range.min = 0;
+    range.max = 499999;
+    bench::measure("set_filter(column range)", iterations, [&] {
+        model.set_filter(range);
+    });
+    const size_t filtered = model.view_size();
+    CHECK(filtered > 0 && filtered < count);
+
+    model.set_sort({SortKey{SortKind::Column, 0, true}});
+    CHECK(model.view_size() == filtered);
+
+    // Appends land in sorted position without a rebuild.
+    model.set_filter(FilterSpec{});
+    model.set_sort({SortKey{SortKind::Text, 0, false}});
+    bench::measure("append 1000 into sorted view", 1, [&] {
+        bench::Rng rng;
+        rng.state = 42;
+        for (int i = 0; i < 1000; ++i) {
+            model.append(bench::make_word(rng, 8));
+        }
+    });
+    verify_sorted(model, SortKind::Text);
+
+    model.remove_at_view(0);
+    CHECK(model.view_size() == model.size());
+    verify_sorted(model, SortKind::Text);
+
+    // Bulk export (xaml_listview_export_items): size query, then one copy.
+    const size_t rows = model.view_size();
+    std::vector<uint32_t> offsets(rows + 1);
+    const size_t required = model.export_view(0, rows, nullptr, 0, offsets.data());
+    CHECK(offsets[rows] == required);
+    std::vector<char16_t> buffer(required);
+    bench::measure("export_view (all items)", iterations, [&] {
+        CHECK(model.export_view(0, rows, buffer.data(), buffer.size(), offsets.data()) == required);
+    });
+    for (size_t v = 0; v < rows; ++v) {
+        const std::u16string_view text(buffer.data() + offsets[v], offsets[v + 1] - offsets[v]);
+        CHECK(text == model.item(model.store_index(v)));
+    }
+    CHECK(model.export_view(1, 2, buffer.data(), 1, nullptr) > 1);
+
+    // Store-order edits (xaml_listview_apply_changes) against a plain vector.
+    {
+        bench::Rng rng;
+        rng.state = 99;
+        std::vector<std::u16string> mirror;
+        for (int i = 0; i < 64; ++i) {
+            mirror.push_back(bench::make_word(rng, 6));
+        }
+        ListModel edits;
+        edits.assign(mirror);
+        for (int step = 0; step < 2000; ++step) {
+            const uint32_t size = static_cast<uint32_t>(mirror.size());
+            switch (rng.below(4)) {
+                case 0: {
+                    const size_t at = rng.below(size + 1);
+                    std::vector<std::u16string> words(1 + rng.below(3));
+                    for (auto& word : words) {
+                        word = bench::make_word(rng, 6);
+                    }
+                    mirror.insert(mirror.begin() + at, words.begin(), words.end());
+                    edits.insert_at(at, words);
+                    break;
+                }
+                case 1:
+                    if (size > 4) {
+                        const size_t at = rng.below(size - 3);
+                        const size_t n = 1 + rng.below(3);
+                        mirror.erase(mirror.begin() + at, mirror.begin() + at + n);
+                        edits.remove_range(at, n);
+                    }
+                    break;
+                case 2: {
+                    const size_t at = rng.below(size);
+                    mirror[at] = bench::make_word(rng, 6);
+                    edits.replace_at(at, mirror[at]);
+                    break;
+                }
+                default: {
+                    const size_t from = rng.below(size);
+                    const size_t to = rng.below(size);
+                    auto moved = mirror[from];
+                    mirror.erase(mirror.begin() + from);
+                    mirror.insert(mirror.begin() + to, moved);
+                    edits.move_item(from, to);
+                    break;
+                }
+            }
+        }
+        CHECK(edits.view_size() == mirror.size());
+        for (size_t v = 0; v < mirror.size(); ++v) {
+            CHECK(edits.store_index(v) == v && edits.item(v) == mirror[v]);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,174 @@
+// Log view storage: ring wrap and batching semantics, the viewport's
+// follow/scroll rules, and append throughput against growing one string the
+// way a TextBox log does (get_text + set_text per line).
+
+#include "bench_util.h"
+#include "xaml_log_buffer.h"
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace xaml_bridge;
+
+namespace {
+
+std::u16string number_line(uint64_t i) {
+    std::u16string line = u"line ";
+    for (char c : std::to_string(i)) {
+        line.push_back(static_cast<char16_t>(c));
+    }
+    return line;
+}
+
+std::u16string batch_text(uint64_t first, size_t count) {
+    std::u16string text;
+    for (size_t i = 0; i < count; ++i) {
+        text += number_line(first + i);
+        text.push_back(u'\n');
+    }
+    return text;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool quick = bench::quick_mode(argc, argv);
+
+    // Ring semantics.
+    {
+        LogBuffer buffer(4);
+        CHECK(buffer.append(u"a\r\nb\nc\n") == 3);
+        CHECK(buffer.size() == 3 && buffer.line(0) == u"a" && buffer.line(2) == u"c");
+        buffer.append_line(u"d");
+        buffer.append_line(u"e");
+        CHECK(buffer.first_line() == 1 && buffer.end_line() == 5 && buffer.dropped() == 1);
+        CHECK(buffer.line(1) == u"b" && buffer.line(4) == u"e");
+        CHECK(buffer.append(u"\n") == 1 && buffer.line(5).empty());
+        CHECK(buffer.append(u"") == 0);
+
+        // A batch larger than the ring keeps its last lines.
+        CHECK(buffer.append(batch_text(100, 10)) == 10);
+        CHECK(buffer.end_line() == 16 && buffer.first_line() == 12 && buffer.dropped() == 12);
+        CHECK(buffer.line(12) == u"line 106" && buffer.line(15) == u"line 109");
+
+        buffer.clear();
+        CHECK(buffer.size() == 0 && buffer.first_line() == 16);
+        buffer.append_line(std::u16string(kMaxLogLineLength + 10, u'x'));
+        CHECK(buffer.line(16).size() == kMaxLogLineLength);
+    }
+
+    // Viewport.
+    {
+        LogView view(100, 10);
+        CHECK(view.take_changes() == (kLogRowsChanged | kLogExtentChanged));
+        view.append(batch_text(0, 5));
+        CHECK(view.top() == 0 && view.visible_end() == 5 && view.take_changes() == (kLogRowsChanged | kLogExtentChanged));
+        view.append(batch_text(5, 20));
+        CHECK(view.follows_tail() && view.top() == 15 && view.visible_end() == 25);
+        view.take_changes();
+
+        // Scrolled up, appends only move the extent.
+        view.scroll_by(-5);
+        CHECK(!view.follows_tail() && view.top() == 10 && view.take_changes() == kLogRowsChanged);
+        view.append(batch_text(25, 3));
+        CHECK(view.top() == 10 && view.take_changes() == kLogExtentChanged);
+
+        // Lines dropping out of the ring drag the viewport along.
+        view.append(batch_text(28, 95));
+        CHECK(view.top() == view.buffer().first_line() && view.top() == 23);
+        CHECK(view.take_changes() == (kLogRowsChanged | kLogExtentChanged));
+
+        // Reaching the last page resumes following.
+        view.scroll_to(1000);
+        CHECK(view.follows_tail() && view.top() == view.max_top() && view.visible_end() == 123);
+        view.set_rows(20);
+        CHECK(view.top() == 103 && view.take_changes() == kLogRowsChanged);
+        view.set_follow_tail(false);
+        view.append(batch_text(123, 1));
+        CHECK(view.top() == 103 && view.take_changes() == kLogExtentChanged);
+        view.clear();
+        CHECK(view.top() == view.visible_end() && view.take_changes() == (kLogRowsChanged | kLogExtentChanged));
+    }
+
+    const size_t capacity = 10000;
+    const size_t lines = quick ? 20000 : 2000000;
+    const size_t batch = 100;
+    std::vector<std::u16string> source;
+    bench::Rng rng;
+    for (size_t i = 0; i < 1000; ++i) {
+        source.push_back(u"12:00:00.000 INFO worker " + bench::make_word(rng, 8 + rng.below(60)));
+    }
+
+    // A TextBox log copies the whole text out and back in for every line.
+    {
+        const size_t textbox_lines = quick ? 500 : 5000;
+        std::u16string textbox;
+        const double ms = bench::measure("TextBox get_text + set_text (per line)", 1, [&] {
+            for (size_t i = 0; i < textbox_lines; ++i) {
+                std::u16string text = textbox;        // get_text
+                text += source[i % source.size()];
+                text.push_back(u'\n');
+                textbox = text;                       // set_text
+            }
+        });
+        std::printf("  %.0f ns per line over %zu lines\n", ms * 1e6 / textbox_lines, textbox_lines);
+    }
+
+    // The bridge takes the log's lock once per append call.
+    std::mutex mutex;
+    LogView single(capacity, 50);
+    const double single_ms = bench::measure("LogView append, one line per call", 1, [&] {
+        for (size_t i = 0; i < lines; ++i) {
+            std::lock_guard<std::mutex> lock(mutex);
+            single.append(source[i % source.size()]);
+        }
+    });
+
+    std::vector<std::u16string> batches;
+    for (size_t i = 0; i < source.size(); i += batch) {
+        std::u16string text;
+        for (size_t j = i; j < i + batch; ++j) {
+            text += source[j];
+            text.push_back(u'\n');
+        }
+        batches.push_back(std::move(text));
+    }
+    LogView batched(capacity, 50);
+    const double batched_ms = bench::measure("LogView append, 100 lines per call", 1, [&] {
+        for (size_t i = 0; i < lines / batch; ++i) {
+            std::lock_guard<std::mutex> lock(mutex);
+            batched.append(batches[i % batches.size()]);
+        }
+    });
+    std::printf("  %.0f / %.0f ns per line over %zu lines into a %zu-line ring\n", single_ms * 1e6 / lines,
+                batched_ms * 1e6 / lines, lines, capacity);
+    CHECK(single.buffer().end_line() == lines && batched.buffer().end_line() == lines);
+    CHECK(single.buffer().size() == capacity && batched.buffer().dropped() == lines - capacity);
+    for (uint64_t i = batched.buffer().first_line(); i < lines; i += 997) {
+        CHECK(batched.buffer().line(i) == source[i % source.size()]);
+        CHECK(single.buffer().line(i) == batched.buffer().line(i));
+    }
+
+    // Frame ticks: 1000 lines arrive per 16 ms frame; each tick copies the
+    // 50 visible rows once.
+    LogView view(capacity, 50);
+    size_t copied = 0;
+    std::vector<std::u16string> rows(50);
+    const int frames = quick ? 100 : 10000;
+    bench::measure("frame: 10 batches + redraw 50 rows", frames, [&] {
+        for (int b = 0; b < 10; ++b) {
+            view.append(batches[rng.below(static_cast<uint32_t>(batches.size()))]);
+        }
+        if (view.take_changes() & kLogRowsChanged) {
+            size_t row = 0;
+            for (uint64_t i = view.top(); i < view.visible_end(); ++i) {
+                rows[row++].assign(view.buffer().line(i));
+                ++copied;
+            }
+        }
+    });
+    CHECK(copied == static_cast<size_t>(frames) * 50);
+    CHECK(view.top() == view.buffer().end_line() - 50);
+    return 0;
+}
@@ -0,0 +1,145 @@
+// Numeric TextBlock updates: formatting into a reused UTF-16 buffer against
+// the format-allocate-convert path callers used before, and how many
+// updates the unchanged-text check removes from a telemetry stream.
+
+#include "bench_util.h"
+#include "xaml_number_format.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace xaml_bridge;
+
+namespace {
+
+std::u16string formatted(double value, const NumberFormat& format) {
+    std::u16string text;
+    format_number(value, format, text);
+    return text;
+}
+
+std::string narrow(const std::u16string& text) {
+    return std::string(text.begin(), text.end());
+}
+
+// The previous path: format into a fresh string, then widen into a fresh
+// UTF-16 buffer for the bridge.
+std::u16string format_allocating(double value, int precision) {
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "%.*f", precision, value);
+    const std::string text(buffer);
+    return std::u16string(text.begin(), text.end());
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool quick = bench::quick_mode(argc, argv);
+
+    // Formatting.
+    NumberFormat fixed2;
+    fixed2.precision = 2;
+    CHECK(formatted(3.14159, fixed2) == u"3.14");
+    CHECK(formatted(-2.5, fixed2) == u"-2.50");
+    CHECK(formatted(-0.001, fixed2) == u"0.00");
+    CHECK(formatted(0.0, NumberFormat{}) == u"0");
+    CHECK(formatted(-0.0, NumberFormat{}) == u"0");
+    CHECK(formatted(0.1, NumberFormat{}) == u"0.1");
+    CHECK(formatted(1e21, NumberFormat{}) == u"1e+21");
+    CHECK(formatted(std::nan(""), fixed2) == u"NaN");
+    CHECK(formatted(-HUGE_VAL, fixed2) == u"-\u221E");
+
+    NumberFormat money;
+    money.precision = 2;
+    money.grouping = true;
+    money.prefix = u"$";
+    CHECK(formatted(1234567.891, money) == u"$1,234,567.89");
+    CHECK(formatted(-999.0, money) == u"$-999.00");
+    CHECK(formatted(1000.0, money) == u"$1,000.00");
+
+    NumberFormat european;
+    european.precision = 1;
+    european.grouping = true;
+    european.plus_sign = true;
+    european.decimal_point = u',';
+    european.group_separator = u'.';
+    european.suffix = u" ms";
+    CHECK(formatted(12345.67, european) == u"+12.345,7 ms");
+    CHECK(formatted(0.0, european) == u"0,0 ms");
+
+    // The shortest form round-trips.
+    bench::Rng rng;
+    for (int i = 0; i < 10000; ++i) {
+        const double value = static_cast<double>(rng.next()) / static_cast<double>(rng.below(1000000) + 1);
+        CHECK(std::strtod(narrow(formatted(value, NumberFormat{})).c_str(), nullptr) == value);
+    }
+    // Fixed precision matches printf.
+    for (int i = 0; i < 10000; ++i) {
+        const double value = (static_cast<double>(rng.below(2000000)) - 1000000.0) / 997.0;
+        const int precision = static_cast<int>(rng.below(6));
+        NumberFormat format;
+        format.precision = precision;
+        const std::u16string expected = format_allocating(value, precision);
+        CHECK(formatted(value, format) == expected || narrow(expected).find_first_not_of("-0.") == std::string::npos);
+    }
+
+    // Unchanged text is reported once.
+    {
+        NumberTextCache cache;
+        int a = 0, b = 0;
+        CHECK(cache.update(&a, 1.04, european));
+        CHECK(!cache.update(&a, 1.01, european));
+        CHECK(cache.update(&b, 1.01, european));
+        CHECK(cache.update(&a, 1.06, european));
+        CHECK(cache.text() == u"+1,1 ms");
+        cache.forget(&a);
+        CHECK(cache.update(&a, 1.06, european) && cache.size() == 2);
+        cache.forget_if([&](const void* key) { return key == &b; });
+        CHECK(cache.size() == 1 && cache.update(&b, 1.01, european));
+    }
+
+    // A telemetry panel: 500 gauges drifting slowly, shown with one decimal.
+    const int gauges = 500;
+    const int ticks = quick ? 20 : 2000;
+    std::vector<double> values(gauges);
+    for (int g = 0; g < gauges; ++g) {
+        values[g] = rng.below(100000) / 10.0;
+    }
+    NumberFormat gauge_format;
+    gauge_format.precision = 1;
+    gauge_format.grouping = true;
+
+    size_t chars = 0;
+    bench::measure("snprintf + u16string per update (500)", ticks, [&] {
+        for (int g = 0; g < gauges; ++g) {
+            chars += format_allocating(values[g], 1).size();
+        }
+    });
+
+    std::u16string reused;
+    bench::measure("format_number, reused buffer (500)", ticks, [&] {
+        for (int g = 0; g < gauges; ++g) {
+            format_number(values[g], gauge_format, reused);
+            chars += reused.size();
+        }
+    });
+
+    NumberTextCache cache;
+    uint64_t updates = 0, changed = 0;
+    bench::measure("NumberTextCache::update (500)", ticks, [&] {
+        for (int g = 0; g < gauges; ++g) {
+            values[g] += (static_cast<double>(rng.below(1000)) - 500.0) / 20000.0;
+            changed += cache.update(&values[g], values[g], gauge_format);
+            ++updates;
+        }
+    });
+    std::printf("  %llu of %llu updates changed the text\n", static_cast<unsigned long long>(changed),
+                static_cast<unsigned long long>(updates));
+
+    CHECK(chars > 0);
+    CHECK(cache.size() == static_cast<size_t>(gauges));
+    CHECK(changed >= static_cast<uint64_t>(gauges) && changed < updates);
+    return 0;
+}
@@ -0,0 +1,116 @@
+// Observed property changes: per-frame coalescing against delivering every
+// change to the host as it happens. A scroll or slider drag changes the
+// observed value many times per frame; the host only needs the net change.
+
+#include "bench_util.h"
+#include "xaml_property_changes.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace xaml_bridge;
+
+namespace {
+
+uint64_t g_host_calls = 0;
+double g_host_sum = 0.0;
+
+// The host callback, once per delivery. Called through a volatile pointer
+// below so it stays an opaque call, as it is across the bridge.
+void host_callback(const PropertyChange* changes, size_t count) {
+    ++g_host_calls;
+    for (size_t i = 0; i < count; ++i) {
+        g_host_sum += changes[i].new_number - changes[i].old_number;
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool quick = bench::quick_mode(argc, argv);
+
+    // Coalescing.
+    {
+        PropertyChangeQueue queue;
+        std::vector<PropertyChange> out;
+        CHECK(queue.empty() && queue.take(out) == 0);
+
+        queue.record(7, 0.0, 1.0);
+        queue.record(3, u"a", u"ab");
+        queue.record(7, 1.0, 2.0);
+        queue.record(9, 5.0, 6.0);
+        queue.record(9, 6.0, 5.0);                     // Back where it started
+        queue.record(4, std::nan(""), std::nan(""));   // NaN equals NaN
+        queue.record(3, u"ab", u"abc");
+        CHECK(!queue.empty() && queue.recorded() == 7);
+        CHECK(queue.take(out) == 2);
+        CHECK(out[0].observer == 7 && !out[0].is_text && out[0].old_number == 0.0 && out[0].new_number == 2.0);
+        CHECK(out[1].observer == 3 && out[1].is_text && out[1].old_text == u"a" && out[1].new_text == u"abc");
+        CHECK(queue.empty());
+
+        // A new frame starts from the last value.
+        queue.record(7, 2.0, 3.0);
+        CHECK(queue.take(out) == 1 && out[0].old_number == 2.0 && out[0].new_number == 3.0);
+
+        // Forgetting keeps the order of the rest.
+        queue.record(1, 0.0, 1.0);
+        queue.record(2, 0.0, 1.0);
+        queue.record(3, 0.0, 1.0);
+        queue.forget(2);
+        queue.forget(42);
+        queue.record(2, 1.0, 5.0);
+        CHECK(queue.take(out) == 3);
+        CHECK(out[0].observer == 1 && out[1].observer == 3 && out[2].observer == 2 && out[2].old_number == 1.0);
+    }
+
+    // 200 observed properties (slider drags, scroll offsets), each changing
+    // 20 times between frames.
+    const uint32_t observers = 200;
+    const int changes_per_frame = 20;
+    const int frames = quick ? 10 : 2000;
+    std::vector<double> values(observers, 0.0);
+    void (*volatile host)(const PropertyChange*, size_t) = host_callback;
+
+    g_host_calls = 0;
+    PropertyChange single;
+    bench::measure("callback per change (4000 per frame)", frames, [&] {
+        for (int step = 0; step < changes_per_frame; ++step) {
+            for (uint32_t o = 0; o < observers; ++o) {
+                single.observer = o;
+                single.old_number = values[o];
+                values[o] += 0.5;
+                single.new_number = values[o];
+                host(&single, 1);
+            }
+        }
+    });
+    const uint64_t uncoalesced_calls = g_host_calls;
+    const double uncoalesced_sum = g_host_sum;
+
+    g_host_calls = 0;
+    g_host_sum = 0.0;
+    PropertyChangeQueue queue;
+    std::vector<PropertyChange> out;
+    size_t delivered = 0;
+    bench::measure("coalesced, one callback per frame", frames, [&] {
+        for (int step = 0; step < changes_per_frame; ++step) {
+            for (uint32_t o = 0; o < observers; ++o) {
+                const double old_value = values[o];
+                values[o] += 0.5;
+                queue.record(o, old_value, values[o]);
+            }
+        }
+        const size_t count = queue.take(out);
+        delivered += count;
+        host(out.data(), count);
+    });
+    std::printf("  host calls: %llu per change, %llu coalesced (%zu changes delivered)\n",
+                static_cast<unsigned long long>(uncoalesced_calls), static_cast<unsigned long long>(g_host_calls), delivered);
+
+    CHECK(uncoalesced_calls == static_cast<uint64_t>(frames) * observers * changes_per_frame);
+    CHECK(g_host_calls == static_cast<uint64_t>(frames) && delivered == static_cast<size_t>(frames) * observers);
+    // The host sees the same net movement either way.
+    CHECK(std::abs(g_host_sum - uncoalesced_sum) < 1e-6 * uncoalesced_sum);
+    return 0;
+}
@@ -0,0 +1,152 @@
+// Substring search kernel behind xaml_listview_search and CONTAINS filters.
+
+#include "bench_util.h"
+#include "xaml_list_model.h"
+#include "xaml_search.h"
+#include "xaml_text.h"
+
+#include <vector>
+
+using namespace xaml_bridge;
+
+namespace {
+
+std::vector<std::u16string> make_log_rows(size_t count) {
+    static const char16_t* levels[] = {u"INFO", u"WARN", u"ERROR", u"DEBUG"};
+    static const char16_t* sources[] = {u"net.Connection", u"ui.Render", u"db.Query", u"Gateway"};
+    bench::Rng rng;
+    std::vector<std::u16string> rows;
+    rows.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        std::u16string row = u"2026-10-18T12:00:00.000Z ";
+        row += levels[rng.below(4)];
+        row += u" [";
+        row += sources[rng.below(4)];
+        row += u"] ";
+        const size_t words = 4 + rng.below(8);
+        for (size_t w = 0; w < words; ++w) {
+            row += bench::make_word(rng, 3 + rng.below(7));
+            row += u' ';
+        }
+        // Sprinkle a few non-ASCII rows to exercise the fold table.
+        if (rng.below(50) == 0) {
+            row += u"Запрос";
+        }
+        rows.push_back(std::move(row));
+    }
+    return rows;
+}
+
+size_t count_matches(const std::vector<std::u16string>& rows, const TextSearcher& searcher) {
+    size_t hits = 0;
+    for (const auto& row : rows) {
+        hits += searcher.matches(row) ? 1 : 0;
+    }
+    return hits;
+}
+
+size_t count_naive(const std::vector<std::u16string>& rows, std::u16string_view query, bool ignore_case) {
+    size_t hits = 0;
+    for (const auto& row : rows) {
+        hits += find_text_naive(row, query, ignore_case) != std::u16string_view::npos ? 1 : 0;
+    }
+    return hits;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool quick = bench::quick_mode(argc, argv);
+    const size_t count = quick ? 5000 : 500000;
+    const int iterations = quick ? 1 : 5;
+    const auto rows = make_log_rows(count);
+
+    // Kernel correctness against the naive search, including needles that
+    // straddle the 8-lane boundary and single characters.
+    {
+        bench::Rng rng;
+        for (int t = 0; t < 2000; ++t) {
+            const auto& row = rows[rng.below(static_cast<uint32_t>(rows.size()))];
+            const size_t start = rng.below(static_cast<uint32_t>(row.size()));
+            const size_t len = 1 + rng.below(12);
+            std::u16string query = row.substr(start, len);
+            if (rng.below(2)) {
+                for (auto& c : query) {
+                    c = upper_variant(fold_case(c));
+                }
+            }
+            for (bool ignore_case : {false, true}) {
+                TextSearcher searcher(query, ignore_case);
+                for (int k = 0; k < 8; ++k) {
+                    const auto& other = rows[rng.below(static_cast<uint32_t>(rows.size()))];
+                    CHECK(searcher.find(other) == find_text_naive(other, query, ignore_case));
+                }
+                CHECK(searcher.find(row) == find_text_naive(row, query, ignore_case));
+            }
+        }
+        TextSearcher cyrillic(u"зАпРОс", true);
+        CHECK(cyrillic.matches(u"x Запрос"));
+    }
+
+    std::printf("search_bench: %zu rows\n", count);
+    for (const char16_t* query : {u"error", u"Connection", u"xq", u"gateway] a"}) {
+        std::string name(query, query + std::char_traits<char16_t>::length(query));
+        std::printf(" query \"%s\"\n", name.c_str());
+
+        size_t simd_hits = 0;
+        size_t naive_hits = 0;
+        TextSearcher folded(query, true);
+        bench::measure("  naive fold + compare (ignore case)", iterations, [&] {
+            naive_hits = count_naive(rows, query, true);
+        });
+        bench::measure("  TextSearcher (ignore case)", iterations, [&] {
+            simd_hits = count_matches(rows, folded);
+        });
+        CHECK(simd_hits == naive_hits);
+
+        TextSearcher exact(query, false);
+        bench::measure("  std::u16string::find (case sensitive)", iterations, [&] {
+            naive_hits = count_naive(rows, query, false);
+        });
+        bench::measure("  TextSearcher (case sensitive)", iterations, [&] {
+            simd_hits = count_matches(rows, exact);
+        });
+        CHECK(simd_hits == naive_hits);
+    }
+
+    // Incremental type-to-filter: each keystroke only rescans prior matches.
+    ListModel model;
+    for (const auto& row : rows) {
+        model.append(row);
+    }
+    const std::u16string typed = u"error [db.q";
+    size_t full_total = 0;
+    bench::measure("type-to-filter, full rescan per keystroke", iterations, [&] {
+        for (size_t len = 1; len <= typed.size(); ++len) {
+            full_total += count_matches(rows, TextSearcher(typed.substr(0, len), true));
+        }
+    });
+    size_t last_incremental = 0;
+    // The first keystroke never refines the previous iteration's final query,
+    // so every iteration starts with one full scan.
+    bench::measure("type-to-filter, ListModel::search refinement", iterations, [&] {
+        for (size_t len = 1; len <= typed.size(); ++len) {
+            last_incremental = model.search(typed.substr(0, len), true).size();
+        }
+    });
+    CHECK(last_incremental == count_naive(rows, typed, true));
+
+    FilterSpec filter;
+    filter.kind = FilterKind::Contains;
+    filter.ignore_case = true;
+    bench::measure("type-to-filter, CONTAINS filter refinement", iterations, [&] {
+        filter.text.clear();
+        model.set_filter(filter);
+        for (size_t len = 1; len <= typed.size(); ++len) {
+            filter.text = typed.substr(0, len);
+            model.set_filter(filter);
+        }
+    });
+    CHECK(model.view_size() == last_incremental);
+    return 0;
+}
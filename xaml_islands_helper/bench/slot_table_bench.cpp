@@ -0,0 +1,151 @@
+// Bindable view-model slots: 10k bound properties updated through one
+// batched slot write per frame, against one setter call per property. Both
+// stand-ins do what their bridge export does before touching XAML: an opaque
+// call and the thread-local call counter, plus the view model's lock on the
+// batched path. XAML work is counted, not timed. That leaves out costs only
+// the batched path pays per changed slot: PropertyChanged, the binding engine
+// and ICustomProperty::GetValue boxing. The timings therefore compare
+// bridge-side bookkeeping, and the update counts are the result to read.
+
+#include "bench_util.h"
+#include "xaml_slot_table.h"
+
+#include <cmath>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace xaml_bridge;
+
+namespace {
+
+thread_local uint64_t g_calls = 0;   // count_bridge_call
+std::vector<double> g_element_values;
+
+// One explicit setter crossing per property; setters such as
+// xaml_slider_set_value take no lock.
+void set_element_value(uint32_t element, double value) {
+    ++g_calls;
+    g_element_values[element] = value;
+}
+
+// The batched path: one crossing, one lock, then per-slot work only.
+struct SlotWrite {
+    uint32_t slot;
+    double number;
+};
+
+std::mutex g_table_mutex;
+
+void write_slots(SlotTable& table, const SlotWrite* writes, size_t count) {
+    ++g_calls;
+    std::lock_guard<std::mutex> lock(g_table_mutex);
+    for (size_t i = 0; i < count; ++i) {
+        table.set_number(writes[i].slot, writes[i].number);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool quick = bench::quick_mode(argc, argv);
+
+    // Conversions and change tracking.
+    {
+        SlotTable table;
+        const uint32_t n = table.add(SlotKind::Number);
+        const uint32_t i = table.add(SlotKind::Integer);
+        const uint32_t b = table.add(SlotKind::Boolean);
+        const uint32_t t = table.add(SlotKind::Text);
+        CHECK(table.size() == 4 && table.kind(t) == SlotKind::Text);
+        CHECK(!table.set_number(n, 0.0) && !table.set_number(n, -0.0) && !table.has_changes());
+        CHECK(table.set_number(n, std::nan("")) && !table.set_number(n, std::nan("")));
+        CHECK(table.set_number(i, 2.6) && table.number(i) == 3.0 && !table.set_number(i, 3.2));
+        CHECK(table.set_number(i, 1e12) && table.number(i) == 2147483647.0);
+        CHECK(!table.set_number(b, std::nan("")) && table.set_number(b, -5.0) && table.number(b) == 1.0);
+        CHECK(!table.set_text(t, u"") && table.set_text(t, u"abc") && !table.set_text(t, u"abc"));
+        CHECK(table.set_number(n, 1.0));
+
+        std::vector<uint32_t> changed;
+        table.take_changes(changed);
+        CHECK((changed == std::vector<uint32_t>{n, i, b, t}));
+        CHECK(!table.has_changes() && table.text(t) == u"abc");
+        CHECK(table.set_number(n, 2.0));
+        table.take_changes(changed);
+        CHECK(changed.size() == 5 && changed.back() == n);
+    }
+
+    const uint32_t properties = quick ? 1000 : 10000;
+    const int frames = quick ? 5 : 200;
+    g_element_values.assign(properties, 0.0);
+    SlotTable table;
+    for (uint32_t p = 0; p < properties; ++p) {
+        table.add(SlotKind::Number);
+    }
+    std::vector<double> model(properties);
+    std::vector<SlotWrite> writes(properties);
+    std::vector<uint32_t> changed;
+
+    // Function pointer so the setter is not inlined into the loop.
+    void (*volatile setter)(uint32_t, double) = set_element_value;
+
+    std::printf("every property changes each frame (%u):\n", properties);
+    uint64_t setter_updates = 0;
+    bench::measure("explicit setter per property", frames, [&] {
+        for (uint32_t p = 0; p < properties; ++p) {
+            model[p] += 1.0;
+            setter(p, model[p]);
+            ++setter_updates;
+        }
+    });
+    uint64_t slot_updates = 0;
+    bench::measure("one batched slot write + take_changes", frames, [&] {
+        for (uint32_t p = 0; p < properties; ++p) {
+            model[p] += 1.0;
+            writes[p] = SlotWrite{p, model[p]};
+        }
+        write_slots(table, writes.data(), writes.size());
+        changed.clear();
+        table.take_changes(changed);
+        slot_updates += changed.size();
+    });
+    CHECK(setter_updates == slot_updates);
+
+    // Bursty model: each property is written four times per frame, and only
+    // one in ten ends the frame with a new value.
+    std::printf("4 writes per property, 10%% changed per frame:\n");
+    setter_updates = 0;
+    slot_updates = 0;
+    bench::measure("explicit setter per write", frames, [&] {
+        for (int pass = 0; pass < 4; ++pass) {
+            for (uint32_t p = 0; p < properties; ++p) {
+                const double value = (p % 10 == 0 && pass == 3) ? model[p] + 1.0 : model[p];
+                setter(p, value);
+                ++setter_updates;
+            }
+        }
+        for (uint32_t p = 0; p < properties; p += 10) {
+            model[p] += 1.0;
+        }
+    });
+    std::vector<double> shadow(model);
+    bench::measure("batched slot writes + take_changes", frames, [&] {
+        for (int pass = 0; pass < 4; ++pass) {
+            for (uint32_t p = 0; p < properties; ++p) {
+                writes[p] = SlotWrite{p, (p % 10 == 0 && pass == 3) ? shadow[p] + 1.0 : shadow[p]};
+            }
+            write_slots(table, writes.data(), writes.size());
+        }
+        for (uint32_t p = 0; p < properties; p += 10) {
+            shadow[p] += 1.0;
+        }
+        changed.clear();
+        table.take_changes(changed);
+        slot_updates += changed.size();
+    });
+    std::printf("  XAML property updates: %llu with setters, %llu with slots\n",
+                static_cast<unsigned long long>(setter_updates), static_cast<unsigned long long>(slot_updates));
+
+    CHECK(slot_updates * 40 == setter_updates);
+    return 0;
+}
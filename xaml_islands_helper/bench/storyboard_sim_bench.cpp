@@ -0,0 +1,150 @@
+// Simulated storyboards: XAML timing semantics and per-frame cost of large
+// animation workloads on a deterministic clock.
+
+#include "bench_util.h"
+#include "xaml_storyboard_sim.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace xaml_bridge;
+
+namespace {
+
+constexpr double kFrameMs = 1000.0 / 60.0;
+
+bool near(double a, double b) { return std::abs(a - b) < 1e-9; }
+
+SimAnimation fade(uint32_t target, double from, double to, double duration_ms) {
+    SimAnimation animation;
+    animation.target = target;
+    animation.property_path = u"Opacity";
+    animation.has_from = true;
+    animation.from = from;
+    animation.to = to;
+    animation.duration_ms = duration_ms;
+    return animation;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool quick = bench::quick_mode(argc, argv);
+
+    // From/To, pause/resume, fill and completion.
+    {
+        StoryboardSimulator sim;
+        const auto id = sim.create({fade(1, 0.0, 1.0, 100.0)});
+        sim.begin(id);
+        sim.advance(50.0);
+        CHECK(near(sim.value(1, u"Opacity"), 0.5));
+        sim.pause(id);
+        sim.advance(500.0);
+        CHECK(near(sim.value(1, u"Opacity"), 0.5));
+        CHECK(sim.take_completed().empty());
+        sim.resume(id);
+        sim.advance(25.0);
+        CHECK(near(sim.value(1, u"Opacity"), 0.75));
+        sim.advance(1000.0);
+        CHECK(near(sim.value(1, u"Opacity"), 1.0));
+        CHECK(sim.state(id) == SimClockState::Filling);
+        CHECK(sim.take_completed() == std::vector<StoryboardSimulator::StoryboardId>{id});
+        CHECK(sim.running_storyboards() == 0);
+    }
+
+    // Missing From starts at the current value; BeginTime delays; Stop restores.
+    {
+        StoryboardSimulator sim;
+        sim.set_value(7, u"Width", 40.0);
+        SimAnimation grow;
+        grow.target = 7;
+        grow.property_path = u"Width";
+        grow.to = 140.0;
+        grow.begin_ms = 100.0;
+        grow.duration_ms = 200.0;
+        const auto id = sim.create({grow});
+        sim.begin(id);
+        sim.advance(100.0);
+        CHECK(near(sim.value(7, u"Width"), 40.0));
+        sim.advance(100.0);
+        CHECK(near(sim.value(7, u"Width"), 90.0));
+        sim.stop(id);
+        CHECK(near(sim.value(7, u"Width"), 40.0));
+        CHECK(sim.state(id) == SimClockState::Stopped);
+        CHECK(sim.take_completed().empty());
+    }
+
+    // Colors interpolate per channel; easing shapes progress.
+    {
+        StoryboardSimulator sim;
+        SimAnimation tint;
+        tint.kind = SimAnimationKind::Color;
+        tint.target = 2;
+        tint.property_path = u"(Border.Background).(SolidColorBrush.Color)";
+        tint.has_from = true;
+        tint.from_color = 0xFF000000;
+        tint.to_color = 0xFFFF8000;
+        tint.duration_ms = 100.0;
+        tint.easing = eased_kind(EasingFamily::Quad, EasingMode::In);
+        const auto id = sim.create({tint});
+        sim.begin(id);
+        sim.advance(50.0);
+        CHECK(sim.color(2, tint.property_path) == 0xFF402000);
+    }
+
+    // The later Begin owns a shared property; stopping the earlier one leaves it.
+    {
+        StoryboardSimulator sim;
+        const auto first = sim.create({fade(3, 0.0, 1.0, 100.0)});
+        const auto second = sim.create({fade(3, 1.0, 0.0, 100.0)});
+        sim.begin(first);
+        sim.begin(second);
+        sim.advance(50.0);
+        CHECK(near(sim.value(3, u"Opacity"), 0.5));
+        sim.advance(25.0);
+        CHECK(near(sim.value(3, u"Opacity"), 0.25));
+        sim.stop(first);
+        CHECK(near(sim.value(3, u"Opacity"), 0.25));
+        sim.destroy(first);
+        CHECK(sim.create({}) == first);
+    }
+
+    // A screen of staggered list entrances: every item fades and slides in.
+    const uint32_t items = quick ? 500 : 20000;
+    const int frames = quick ? 30 : 120;
+    StoryboardSimulator sim;
+    std::vector<StoryboardSimulator::StoryboardId> storyboards;
+    storyboards.reserve(items);
+    for (uint32_t item = 0; item < items; ++item) {
+        SimAnimation slide;
+        slide.target = item;
+        slide.property_path = u"(UIElement.RenderTransform).(TranslateTransform.Y)";
+        slide.has_from = true;
+        slide.from = 24.0;
+        slide.to = 0.0;
+        slide.begin_ms = (item % 20) * 30.0;
+        slide.duration_ms = 300.0;
+        slide.easing = eased_kind(EasingFamily::Cubic, EasingMode::Out);
+        SimAnimation opacity = fade(item, 0.0, 1.0, 300.0);
+        opacity.begin_ms = slide.begin_ms;
+        storyboards.push_back(sim.create({slide, opacity}));
+    }
+    for (auto id : storyboards) {
+        sim.begin(id);
+    }
+    CHECK(sim.active_animations() == items * 2u);
+
+    size_t writes = 0;
+    bench::measure("advance one frame", frames, [&] { writes += sim.advance(kFrameMs); });
+    std::printf("  %zu writes over %d frames\n", writes, frames);
+    CHECK(writes > 0);
+
+    sim.advance(1000.0);
+    CHECK(sim.running_storyboards() == 0);
+    CHECK(sim.take_completed().size() == items);
+    for (uint32_t item = 0; item < items; item += 97) {
+        CHECK(near(sim.value(item, u"Opacity"), 1.0));
+        CHECK(near(sim.value(item, u"(UIElement.RenderTransform).(TranslateTransform.Y)"), 0.0));
+    }
+    return 0;
+}
@@ -0,0 +1,157 @@
+// Localized string tables: file validation, mapping, and label lookups by id
+// against transcoding a UTF-8 label into a fresh UTF-16 string per call.
+
+#include "bench_util.h"
+#include "xaml_string_table.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace xaml_bridge;
+
+namespace {
+
+bool write_file(const std::filesystem::path& path, const std::vector<uint8_t>& bytes) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(out);
+}
+
+// What a caller does per label without a table: decode UTF-8, encode UTF-16.
+std::u16string transcode(const std::string& utf8) {
+    std::u16string out;
+    out.reserve(utf8.size());
+    for (size_t i = 0; i < utf8.size();) {
+        const auto c = static_cast<unsigned char>(utf8[i]);
+        uint32_t cp;
+        size_t n;
+        if (c < 0x80) {
+            cp = c, n = 1;
+        } else if (c < 0xE0) {
+            cp = c & 0x1F, n = 2;
+        } else if (c < 0xF0) {
+            cp = c & 0x0F, n = 3;
+        } else {
+            cp = c & 0x07, n = 4;
+        }
+        for (size_t k = 1; k < n; ++k) {
+            cp = (cp << 6) | (static_cast<unsigned char>(utf8[i + k]) & 0x3F);
+        }
+        i += n;
+        if (cp >= 0x10000) {
+            out.push_back(static_cast<char16_t>(0xD800 + ((cp - 0x10000) >> 10)));
+            out.push_back(static_cast<char16_t>(0xDC00 + ((cp - 0x10000) & 0x3FF)));
+        } else {
+            out.push_back(static_cast<char16_t>(cp));
+        }
+    }
+    return out;
+}
+
+std::string narrow(std::u16string_view text) {
+    // The bench labels are ASCII plus 'é' (U+00E9).
+    std::string out;
+    for (char16_t c : text) {
+        if (c < 0x80) {
+            out.push_back(static_cast<char>(c));
+        } else {
+            out.push_back(static_cast<char>(0xC0 | (c >> 6)));
+            out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool quick = bench::quick_mode(argc, argv);
+    std::string error;
+
+    // Round trip through memory.
+    {
+        const std::vector<uint8_t> bytes = build_string_table(u"fr-FR", {u"Ouvrir", u"", u"Fermer"});
+        StringTable table;
+        CHECK(table.attach(bytes.data(), bytes.size(), error));
+        CHECK(table.size() == 3 && table.locale() == u"fr-FR");
+        CHECK(table.get(0) == u"Ouvrir" && table.get(2) == u"Fermer");
+        CHECK(table.contains(1) && table.get(1).empty());
+        CHECK(!table.contains(3) && table.get(3).empty());
+        CHECK(table.get(0).data()[table.get(0).size()] == u'\0');
+
+        // Corrupt copies are rejected.
+        std::vector<uint8_t> bad = bytes;
+        bad[0] ^= 1;
+        CHECK(!table.attach(bad.data(), bad.size(), error) && table.size() == 0);
+        bad = bytes;
+        bad[4] = 9;
+        CHECK(!table.attach(bad.data(), bad.size(), error));
+        bad = bytes;
+        bad[20] = 0xFF;                     // offsets[1] past the data
+        CHECK(!table.attach(bad.data(), bad.size(), error));
+        bad.assign(bytes.begin(), bytes.end() - 2);
+        CHECK(!table.attach(bad.data(), bad.size(), error));   // last NUL cut off
+        CHECK(!table.attach(bytes.data(), 8, error));
+
+        // An id without a string: offsets[1] == offsets[2].
+        bad = bytes;
+        std::memcpy(bad.data() + 24, bad.data() + 20, 4);
+        CHECK(table.attach(bad.data(), bad.size(), error));
+        CHECK(!table.contains(1) && table.get(1).empty() && table.contains(2));
+    }
+
+    // A locale file with 20,000 labels.
+    const uint32_t labels = 20000;
+    std::vector<std::u16string> english, french;
+    bench::Rng rng;
+    for (uint32_t id = 0; id < labels; ++id) {
+        english.push_back(u"Label " + bench::make_word(rng, 4 + rng.below(24)));
+        french.push_back(u"Étiquette " + bench::make_word(rng, 4 + rng.below(24)));
+    }
+    const auto dir = std::filesystem::temp_directory_path();
+    const auto en_path = dir / "xaml_string_table_bench.en.xstb";
+    const auto fr_path = dir / "xaml_string_table_bench.fr.xstb";
+    CHECK(write_file(en_path, build_string_table(u"en-US", english)));
+    CHECK(write_file(fr_path, build_string_table(u"fr-FR", french)));
+
+    StringTable table;
+    CHECK(!table.open((dir / "xaml_string_table_bench.missing").c_str(), error));
+    bench::measure("open + validate 20,000-label table", quick ? 5 : 200, [&] {
+        CHECK(table.open(en_path.c_str(), error));
+    });
+    CHECK(table.size() == labels && table.locale() == u"en-US");
+    for (uint32_t id = 0; id < labels; id += 97) {
+        CHECK(table.get(id) == english[id]);
+    }
+
+    std::vector<std::string> utf8;
+    for (const auto& s : french) {
+        utf8.push_back(narrow(s));
+    }
+    CHECK(transcode(utf8[7]) == french[7]);
+
+    const int rounds = quick ? 2 : 200;
+    size_t units = 0;
+    bench::measure("transcode UTF-8 label per call (20,000)", rounds, [&] {
+        for (uint32_t id = 0; id < labels; ++id) {
+            units += transcode(utf8[id]).size();
+        }
+    });
+    bench::measure("switch locale + lookup by id (20,000)", rounds, [&] {
+        CHECK(table.open(fr_path.c_str(), error));
+        for (uint32_t id = 0; id < labels; ++id) {
+            units += table.get(id).size();
+        }
+    });
+    CHECK(table.locale() == u"fr-FR" && table.get(labels - 1) == french.back());
+    CHECK(units > 0);
+
+    table.close();
+    std::filesystem::remove(en_path);
+    std::filesystem::remove(fr_path);
+    return 0;
+}
@@ -0,0 +1,228 @@
+#include "xaml_animation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+namespace xaml_bridge {
+
+namespace {
+
+struct PathStep {
+    std::u16string_view owner;      // Empty unless written as (Owner.Property)
+    std::u16string_view property;
+};
+
+std::u16string_view trim(std::u16string_view text) {
+    while (!text.empty() && text.front() == u' ') {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && text.back() == u' ') {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+PathStep make_step(std::u16string_view text) {
+    PathStep step;
+    text = trim(text);
+    // Indexers such as Children[0] do not change which property is animated.
+    const size_t bracket = text.find(u'[');
+    if (bracket != std::u16string_view::npos) {
+        text = trim(text.substr(0, bracket));
+    }
+    const size_t dot = text.rfind(u'.');
+    if (dot == std::u16string_view::npos) {
+        step.property = text;
+    } else {
+        step.owner = trim(text.substr(0, dot));
+        step.property = trim(text.substr(dot + 1));
+    }
+    return step;
+}
+
+std::vector<PathStep> split_path(std::u16string_view path) {
+    std::vector<PathStep> steps;
+    size_t i = 0;
+    while (i < path.size()) {
+        if (path[i] == u'.' || path[i] == u' ') {
+            ++i;
+            continue;
+        }
+        if (path[i] == u'(') {
+            const size_t close = path.find(u')', i);
+            const size_t end = close == std::u16string_view::npos ? path.size() : close;
+            steps.push_back(make_step(path.substr(i + 1, end - i - 1)));
+            i = end + 1;
+            // An indexer may follow the parenthesised step.
+            while (i < path.size() && path[i] != u'.') {
+                ++i;
+            }
+            continue;
+        }
+        const size_t end = std::min(path.find(u'.', i), path.size());
+        steps.push_back(make_step(path.substr(i, end - i)));
+        i = end;
+    }
+    return steps;
+}
+
+// Widely used cubic-bezier fits, indexed by EasingFamily then EasingMode.
+constexpr KeySplinePoints kEasingSplines[7][3] = {
+    {{0.12f, 0.0f, 0.39f, 0.0f}, {0.61f, 1.0f, 0.88f, 1.0f}, {0.37f, 0.0f, 0.63f, 1.0f}},    // Sine
+    {{0.11f, 0.0f, 0.5f, 0.0f}, {0.5f, 1.0f, 0.89f, 1.0f}, {0.45f, 0.0f, 0.55f, 1.0f}},      // Quad
+    {{0.32f, 0.0f, 0.67f, 0.0f}, {0.33f, 1.0f, 0.68f, 1.0f}, {0.65f, 0.0f, 0.35f, 1.0f}},    // Cubic
+    {{0.5f, 0.0f, 0.75f, 0.0f}, {0.25f, 1.0f, 0.5f, 1.0f}, {0.76f, 0.0f, 0.24f, 1.0f}},      // Quart
+    {{0.64f, 0.0f, 0.78f, 0.0f}, {0.22f, 1.0f, 0.36f, 1.0f}, {0.83f, 0.0f, 0.17f, 1.0f}},    // Quint
+    {{0.7f, 0.0f, 0.84f, 0.0f}, {0.16f, 1.0f, 0.3f, 1.0f}, {0.87f, 0.0f, 0.13f, 1.0f}},      // Expo
+    {{0.55f, 0.0f, 1.0f, 0.45f}, {0.0f, 0.55f, 0.45f, 1.0f}, {0.85f, 0.0f, 0.15f, 1.0f}},    // Circ
+};
+
+constexpr double kPi = 3.14159265358979323846;
+
+double ease_in(EasingFamily family, double t) {
+    switch (family) {
+    case EasingFamily::Sine: return 1.0 - std::cos(t * kPi / 2.0);
+    case EasingFamily::Quad: return t * t;
+    case EasingFamily::Cubic: return t * t * t;
+    case EasingFamily::Quart: return t * t * t * t;
+    case EasingFamily::Quint: return t * t * t * t * t;
+    case EasingFamily::Expo: return t <= 0.0 ? 0.0 : std::pow(2.0, 10.0 * t - 10.0);
+    case EasingFamily::Circ: return 1.0 - std::sqrt(std::max(0.0, 1.0 - t * t));
+    // XAML's defaults: Amplitude 1; Oscillations 3, Springiness 3; Bounces 3, Bounciness 2.
+    case EasingFamily::Back: return t * t * t - t * std::sin(kPi * t);
+    case EasingFamily::Elastic:
+        return (std::exp(3.0 * t) - 1.0) / (std::exp(3.0) - 1.0) * std::sin((6.0 * kPi + kPi / 2.0) * t);
+    case EasingFamily::Bounce: {
+        constexpr double bounces = 3.0;
+        constexpr double bounciness = 2.0;
+        const double last = std::pow(bounciness, bounces);
+        const double units = (1.0 - last) / (1.0 - bounciness) + last * 0.5;
+        const double bounce = std::floor(std::log(t * units * (bounciness - 1.0) + 1.0) / std::log(bounciness));
+        const double start = (1.0 - std::pow(bounciness, bounce)) / ((1.0 - bounciness) * units);
+        const double end = (1.0 - std::pow(bounciness, bounce + 1.0)) / ((1.0 - bounciness) * units);
+        const double peak = (start + end) / 2.0;
+        const double radius = peak - start;
+        const double amplitude = std::pow(1.0 / bounciness, bounces - bounce);
+        return -amplitude / (radius * radius) * (t - peak - radius) * (t - peak + radius);
+    }
+    default: return t;
+    }
+}
+
+double bezier(double a, double b, double s) {
+    const double r = 1.0 - s;
+    return 3.0 * r * r * s * a + 3.0 * r * s * s * b + s * s * s;
+}
+
+} // namespace
+
+bool is_independent_animation(std::u16string_view property_path, double duration_ms) {
+    if (duration_ms <= 0.0) {
+        return true;
+    }
+    const auto steps = split_path(property_path);
+    if (steps.empty()) {
+        return false;
+    }
+
+    const PathStep& first = steps.front();
+    if (first.owner == u"Canvas") {
+        return first.property == u"Left" || first.property == u"Top";
+    }
+    if (first.property == u"Opacity") {
+        return steps.size() == 1;
+    }
+    if (first.property == u"RenderTransform" || first.property == u"Transform3D" ||
+        first.property == u"Projection" || first.property == u"Clip") {
+        return steps.size() > 1;
+    }
+
+    // Brush colors: "(Border.Background).(SolidColorBrush.Color)".
+    const PathStep& last = steps.back();
+    return steps.size() > 1 && last.property == u"Color" &&
+           (last.owner.empty() || last.owner == u"SolidColorBrush");
+}
+
+bool easing_key_spline(uint8_t kind, KeySplinePoints& spline) {
+    if (kind < 2 || kind >= kKeyFrameKindCount || easing_family(kind) > EasingFamily::Circ) {
+        return false;
+    }
+    spline = kEasingSplines[static_cast<int>(easing_family(kind))][static_cast<int>(easing_mode(kind))];
+    return true;
+}
+
+double ease(uint8_t kind, double t) {
+    if (kind == kKeyFrameLinear) {
+        return t;
+    }
+    if (kind == kKeyFrameDiscrete) {
+        return t < 1.0 ? 0.0 : 1.0;
+    }
+    const EasingFamily family = easing_family(kind);
+    switch (easing_mode(kind)) {
+    case EasingMode::In: return ease_in(family, t);
+    case EasingMode::Out: return 1.0 - ease_in(family, 1.0 - t);
+    default:
+        return t < 0.5 ? ease_in(family, 2.0 * t) / 2.0 : 1.0 - ease_in(family, 2.0 - 2.0 * t) / 2.0;
+    }
+}
+
+double evaluate_key_spline(const KeySplinePoints& spline, double x) {
+    // The curve's x is monotonic in s, so bisection always converges.
+    double lo = 0.0;
+    double hi = 1.0;
+    for (int i = 0; i < 40; ++i) {
+        const double mid = (lo + hi) / 2.0;
+        (bezier(spline.x1, spline.x2, mid) < x ? lo : hi) = mid;
+    }
+    return bezier(spline.y1, spline.y2, (lo + hi) / 2.0);
+}
+
+std::vector<PlannedKeyFrame> plan_keyframes(
+    const float* times, const float* values, const uint8_t* kinds, size_t count, size_t components) {
+    std::vector<uint32_t> order(count);
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return times[a] < times[b]; });
+
+    std::vector<PlannedKeyFrame> planned;
+    planned.reserve(count + count / 2);
+    for (uint32_t i : order) {
+        PlannedKeyFrame frame;
+        frame.time_ms = times[i];
+        std::copy_n(values + i * components, components, frame.value);
+        frame.kind = kinds ? kinds[i] : kKeyFrameLinear;
+
+        if (frame.kind == kKeyFrameLinear) {
+            frame.type = KeyFrameType::Linear;
+        } else if (frame.kind == kKeyFrameDiscrete) {
+            frame.type = KeyFrameType::Discrete;
+        } else if (easing_key_spline(frame.kind, frame.spline)) {
+            frame.type = KeyFrameType::Spline;
+            // The first key eases from the property's base value, which is
+            // unknown here, so only later InOut segments can be split.
+            if (easing_mode(frame.kind) == EasingMode::InOut && !planned.empty() &&
+                planned.back().time_ms < frame.time_ms) {
+                const PlannedKeyFrame& previous = planned.back();
+                const EasingFamily family = easing_family(frame.kind);
+                PlannedKeyFrame half;
+                half.type = KeyFrameType::Spline;
+                half.time_ms = previous.time_ms + (frame.time_ms - previous.time_ms) / 2.0f;
+                for (size_t c = 0; c < components; ++c) {
+                    half.value[c] = previous.value[c] + (frame.value[c] - previous.value[c]) / 2.0f;
+                }
+                easing_key_spline(eased_kind(family, EasingMode::In), half.spline);
+                easing_key_spline(eased_kind(family, EasingMode::Out), frame.spline);
+                half.kind = frame.kind;
+                planned.push_back(half);
+            }
+        } else {
+            frame.type = KeyFrameType::Eased;
+        }
+        planned.push_back(frame);
+    }
+    return planned;
+}
+
+} // namespace xaml_bridge
@@ -0,0 +1,76 @@
+#pragma once
+
+// Animation helpers shared by the bridge's storyboard and composition paths.
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace xaml_bridge {
+
+// Whether XAML can run a storyboard animation on the compositor thread.
+//
+// XAML animates these independently of the UI thread: zero-duration animations,
+// Opacity, anything under RenderTransform, Transform3D, Projection or Clip,
+// Canvas.Left/Top, and the Color of a SolidColorBrush. Every other target
+// (Width, Margin, FontSize, ...) is a dependent animation. It runs on the UI
+// thread and only runs at all when EnableDependentAnimation is set.
+//
+// `property_path` uses Storyboard.TargetProperty syntax, for example
+// "Opacity" or "(UIElement.RenderTransform).(TranslateTransform.X)".
+bool is_independent_animation(std::u16string_view property_path, double duration_ms);
+
+// ----- Keyframes -----
+
+// Keyframe kinds, numbered like XamlKeyFrameKind: linear, discrete, then an
+// In/Out/InOut triple for each easing family.
+enum class EasingFamily : uint8_t { Sine, Quad, Cubic, Quart, Quint, Expo, Circ, Back, Elastic, Bounce };
+enum class EasingMode : uint8_t { In, Out, InOut };
+
+constexpr uint8_t kKeyFrameLinear = 0;
+constexpr uint8_t kKeyFrameDiscrete = 1;
+constexpr uint8_t kKeyFrameKindCount = 32;
+
+constexpr uint8_t eased_kind(EasingFamily family, EasingMode mode) {
+    return static_cast<uint8_t>(2 + 3 * static_cast<int>(family) + static_cast<int>(mode));
+}
+constexpr EasingFamily easing_family(uint8_t kind) { return static_cast<EasingFamily>((kind - 2) / 3); }
+constexpr EasingMode easing_mode(uint8_t kind) { return static_cast<EasingMode>((kind - 2) % 3); }
+
+// Control points of a KeySpline, all within [0, 1].
+struct KeySplinePoints {
+    float x1, y1, x2, y2;
+};
+
+// Cubic Bezier approximating an eased kind. Returns false for linear,
+// discrete, Back, Elastic and Bounce; the last three overshoot [0, 1], which
+// a KeySpline cannot express.
+bool easing_key_spline(uint8_t kind, KeySplinePoints& spline);
+
+// Reference curve of every kind. Back, Elastic and Bounce use the parameters
+// XAML's BackEase, ElasticEase and BounceEase default to.
+double ease(uint8_t kind, double t);
+
+// Progress of a KeySpline at time fraction `x`.
+double evaluate_key_spline(const KeySplinePoints& spline, double x);
+
+enum class KeyFrameType : uint8_t { Linear, Discrete, Spline, Eased };
+
+struct PlannedKeyFrame {
+    KeyFrameType type = KeyFrameType::Linear;
+    float time_ms = 0.0f;
+    float value[4] = {};
+    KeySplinePoints spline = {};   // Spline only
+    uint8_t kind = kKeyFrameLinear; // Eased only: needs an EasingFunction
+};
+
+// Turn host keyframes into the keyframes XAML should get, in time order.
+// Eased kinds become spline keyframes where a KeySpline fits. An InOut curve
+// between two known values is split into its In and Out halves, which fit
+// far more closely than a single spline. `values` holds `components` floats
+// per key and `kinds` may be null for all-linear keys.
+std::vector<PlannedKeyFrame> plan_keyframes(
+    const float* times, const float* values, const uint8_t* kinds, size_t count, size_t components);
+
+} // namespace xaml_bridge
@@ -0,0 +1,87 @@
+#include "xaml_frame_stats.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace xaml_bridge {
+
+size_t FrameStats::interval_bucket(double interval_ms) {
+    const auto* end = std::end(kFrameIntervalBounds);
+    return static_cast<size_t>(std::lower_bound(std::begin(kFrameIntervalBounds), end, interval_ms) -
+                               std::begin(kFrameIntervalBounds));
+}
+
+size_t FrameStats::work_bucket(uint64_t work) {
+    size_t bucket = 0;
+    while (work > 0 && bucket + 1 < kFrameWorkBuckets) {
+        work >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+void FrameStats::record(double interval_ms, uint64_t work) {
+    interval_ms = std::max(interval_ms, 0.0);
+    const auto interval_us = static_cast<uint64_t>(std::llround(interval_ms * 1000.0));
+    const double refresh_ms = m_refresh_us.load(std::memory_order_relaxed) / 1000.0;
+
+    bump(m_frames);
+    if (interval_ms > refresh_ms * kMissedFrameFactor) {
+        bump(m_missed);
+    }
+    bump(m_work, work);
+    bump(m_total_interval_us, interval_us);
+    if (interval_us > m_max_interval_us.load(std::memory_order_relaxed)) {
+        m_max_interval_us.store(interval_us, std::memory_order_relaxed);
+    }
+    bump(m_intervals[interval_bucket(interval_ms)]);
+    bump(m_work_buckets[work_bucket(work)]);
+
+    if (interval_ms >= kMinRefreshMs && (m_window_min_ms == 0.0 || interval_ms < m_window_min_ms)) {
+        m_window_min_ms = interval_ms;
+    }
+    if (++m_window_frames == kRefreshWindow) {
+        if (m_window_min_ms > 0.0) {
+            m_refresh_us.store(static_cast<uint64_t>(std::llround(m_window_min_ms * 1000.0)),
+                               std::memory_order_relaxed);
+        }
+        m_window_min_ms = 0.0;
+        m_window_frames = 0;
+    }
+}
+
+void FrameStats::reset() {
+    for (auto* counter : {&m_frames, &m_missed, &m_work, &m_total_interval_us, &m_max_interval_us}) {
+        counter->store(0, std::memory_order_relaxed);
+    }
+    for (auto& bucket : m_intervals) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    for (auto& bucket : m_work_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    m_window_min_ms = 0.0;
+    m_window_frames = 0;
+}
+
+FrameStatsSnapshot FrameStats::snapshot() const {
+    FrameStatsSnapshot snapshot;
+    snapshot.frames = m_frames.load(std::memory_order_relaxed);
+    snapshot.missed_frames = m_missed.load(std::memory_order_relaxed);
+    snapshot.total_work = m_work.load(std::memory_order_relaxed);
+    snapshot.refresh_ms = m_refresh_us.load(std::memory_order_relaxed) / 1000.0;
+    snapshot.max_interval_ms = m_max_interval_us.load(std::memory_order_relaxed) / 1000.0;
+    if (snapshot.frames > 0) {
+        snapshot.mean_interval_ms =
+            m_total_interval_us.load(std::memory_order_relaxed) / 1000.0 / static_cast<double>(snapshot.frames);
+    }
+    for (size_t i = 0; i < kFrameIntervalBuckets; ++i) {
+        snapshot.interval_buckets[i] = m_intervals[i].load(std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < kFrameWorkBuckets; ++i) {
+        snapshot.work_buckets[i] = m_work_buckets[i].load(std::memory_order_relaxed);
+    }
+    return snapshot;
+}
+
+} // namespace xaml_bridge
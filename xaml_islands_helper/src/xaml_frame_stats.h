@@ -0,0 +1,76 @@
+#pragma once
+
+// Frame pacing statistics for one island.
+//
+// The UI thread records one sample per rendered frame: the interval since the
+// previous frame and the number of bridge calls made in between. Readers on
+// any thread take snapshots without locking. Each counter is read atomically,
+// but a snapshot taken mid-frame may mix two consecutive frames.
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace xaml_bridge {
+
+// Upper bounds (ms) of the interval buckets; the last bucket is open-ended.
+// The edges sit between multiples of 60 Hz and 120 Hz frame times.
+constexpr double kFrameIntervalBounds[] = {6.0, 9.0, 12.5, 18.0, 25.0, 34.5, 51.0, 67.5, 100.0, 250.0};
+constexpr size_t kFrameIntervalBuckets = std::size(kFrameIntervalBounds) + 1;
+
+// Work buckets: 0, 1, 2-3, 4-7, ... 512-1023, then 1024 and more.
+constexpr size_t kFrameWorkBuckets = 12;
+
+// A frame is missed when its interval exceeds this many refresh intervals.
+constexpr double kMissedFrameFactor = 1.5;
+
+struct FrameStatsSnapshot {
+    uint64_t frames = 0;
+    uint64_t missed_frames = 0;
+    uint64_t total_work = 0;
+    double refresh_ms = 0.0;       // Estimated display refresh interval
+    double mean_interval_ms = 0.0;
+    double max_interval_ms = 0.0;
+    std::array<uint64_t, kFrameIntervalBuckets> interval_buckets{};
+    std::array<uint64_t, kFrameWorkBuckets> work_buckets{};
+};
+
+class FrameStats {
+public:
+    // Writer thread only.
+    void record(double interval_ms, uint64_t work);
+    void reset();
+
+    FrameStatsSnapshot snapshot() const;
+
+    static size_t interval_bucket(double interval_ms);
+    static size_t work_bucket(uint64_t work);
+
+private:
+    // The refresh estimate is the shortest interval seen in each window of
+    // kRefreshWindow frames, so it follows monitor and power-mode changes.
+    static constexpr uint32_t kRefreshWindow = 120;
+    static constexpr double kMinRefreshMs = 4.0;
+    static constexpr uint64_t kDefaultRefreshUs = 16667;
+
+    // Single writer: plain load/store keeps record() free of locked
+    // instructions.
+    static void bump(std::atomic<uint64_t>& counter, uint64_t amount = 1) {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    std::atomic<uint64_t> m_frames{0};
+    std::atomic<uint64_t> m_missed{0};
+    std::atomic<uint64_t> m_work{0};
+    std::atomic<uint64_t> m_total_interval_us{0};
+    std::atomic<uint64_t> m_max_interval_us{0};
+    std::atomic<uint64_t> m_refresh_us{kDefaultRefreshUs};
+    std::array<std::atomic<uint64_t>, kFrameIntervalBuckets> m_intervals{};
+    std::array<std::atomic<uint64_t>, kFrameWorkBuckets> m_work_buckets{};
+
+    double m_window_min_ms = 0.0;  // 0 until a sample lands in the window
+    uint32_t m_window_frames = 0;
+};
+
+} // namespace xaml_bridge
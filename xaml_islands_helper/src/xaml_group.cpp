@@ -0,0 +1,186 @@
+#include "xaml_group.h"
+#include "xaml_parallel.h"
+
+#include <algorithm>
+
+namespace xaml_bridge {
+
+void GroupIndex::assign(const std::vector<std::u16string>& keys) {
+    clear();
+    const size_t count = keys.size();
+    constexpr size_t min_per_worker = 32768;
+
+    // Each chunk partitions its own range; merging the chunks in order keeps
+    // both the group order and the item order stable.
+    struct Local {
+        std::unordered_map<std::u16string_view, uint32_t> lookup;
+        std::vector<std::u16string_view> keys;
+        std::vector<std::vector<uint32_t>> members;
+    };
+    std::vector<Local> locals(worker_count(count, min_per_worker));
+    parallel_chunks(count, min_per_worker, [&](size_t begin, size_t end, size_t w) {
+        Local& local = locals[w];
+        for (size_t i = begin; i < end; ++i) {
+            auto found = local.lookup.try_emplace(keys[i], static_cast<uint32_t>(local.keys.size()));
+            if (found.second) {
+                local.keys.push_back(keys[i]);
+                local.members.emplace_back();
+            }
+            local.members[found.first->second].push_back(static_cast<uint32_t>(i));
+        }
+    });
+
+    for (auto& local : locals) {
+        for (size_t g = 0; g < local.keys.size(); ++g) {
+            auto found = m_lookup.try_emplace(std::u16string(local.keys[g]), static_cast<uint32_t>(m_keys.size()));
+            if (found.second) {
+                m_keys.emplace_back(local.keys[g]);
+                m_members.emplace_back(std::move(local.members[g]));
+            } else {
+                auto& dest = m_members[found.first->second];
+                dest.insert(dest.end(), local.members[g].begin(), local.members[g].end());
+            }
+        }
+    }
+
+    m_item_group.resize(count);
+    for (size_t g = 0; g < m_members.size(); ++g) {
+        for (uint32_t item : m_members[g]) {
+            m_item_group[item] = static_cast<uint32_t>(g);
+        }
+    }
+}
+
+GroupIndex::Placement GroupIndex::append(std::u16string_view key) {
+    const uint32_t item = static_cast<uint32_t>(m_item_group.size());
+    m_item_group.push_back(0);
+    return insert(item, key);
+}
+
+GroupIndex::Placement GroupIndex::remove(size_t item) {
+    const Placement removed = erase(static_cast<uint32_t>(item));
+    m_item_group.erase(m_item_group.begin() + item);
+    for (auto& members : m_members) {
+        // Members are ascending, so only the tail needs renumbering.
+        auto first = std::upper_bound(members.begin(), members.end(), static_cast<uint32_t>(item));
+        for (; first != members.end(); ++first) {
+            --*first;
+        }
+    }
+    return removed;
+}
+
+GroupIndex::Move GroupIndex::set_key(size_t item, std::u16string_view key) {
+    Move move;
+    const uint32_t group = m_item_group[item];
+    if (m_keys[group] == key) {
+        const auto& members = m_members[group];
+        move.from.group = group;
+        move.from.position = static_cast<size_t>(
+            std::lower_bound(members.begin(), members.end(), static_cast<uint32_t>(item)) - members.begin());
+        move.to = move.from;
+        return move;
+    }
+    move.from = erase(static_cast<uint32_t>(item));
+    move.to = insert(static_cast<uint32_t>(item), key);
+    move.moved = true;
+    return move;
+}
+
+size_t GroupIndex::item_at(size_t position) const {
+    for (const auto& members : m_members) {
+        if (position < members.size()) {
+            return members[position];
+        }
+        position -= members.size();
+    }
+    return npos;
+}
+
+size_t GroupIndex::position_of(size_t item) const {
+    const uint32_t group = m_item_group[item];
+    size_t position = 0;
+    for (uint32_t g = 0; g < group; ++g) {
+        position += m_members[g].size();
+    }
+    const auto& members = m_members[group];
+    return position + static_cast<size_t>(
+        std::lower_bound(members.begin(), members.end(), static_cast<uint32_t>(item)) - members.begin());
+}
+
+std::vector<int> GroupIndex::items_at(const std::vector<int>& positions) const {
+    std::vector<int> items;
+    items.reserve(positions.size());
+    size_t group = 0;
+    size_t group_start = 0;
+    for (int position : positions) {
+        if (position < 0) {
+            continue;
+        }
+        const size_t p = static_cast<size_t>(position);
+        while (group < m_members.size() && p >= group_start + m_members[group].size()) {
+            group_start += m_members[group].size();
+            ++group;
+        }
+        if (group == m_members.size()) {
+            break;
+        }
+        items.push_back(static_cast<int>(m_members[group][p - group_start]));
+    }
+    std::sort(items.begin(), items.end());
+    return items;
+}
+
+void GroupIndex::clear() {
+    m_keys.clear();
+    m_members.clear();
+    m_item_group.clear();
+    m_lookup.clear();
+}
+
+GroupIndex::Placement GroupIndex::insert(uint32_t item, std::u16string_view key) {
+    Placement placement;
+    auto found = m_lookup.try_emplace(std::u16string(key), static_cast<uint32_t>(m_keys.size()));
+    if (found.second) {
+        m_keys.emplace_back(key);
+        m_members.emplace_back();
+        placement.group_changed = true;
+    }
+    placement.group = found.first->second;
+
+    auto& members = m_members[placement.group];
+    auto pos = members.insert(std::lower_bound(members.begin(), members.end(), item), item);
+    placement.position = static_cast<size_t>(pos - members.begin());
+    m_item_group[item] = placement.group;
+    return placement;
+}
+
+GroupIndex::Placement GroupIndex::erase(uint32_t item) {
+    Placement placement;
+    placement.group = m_item_group[item];
+    auto& members = m_members[placement.group];
+    auto pos = std::lower_bound(members.begin(), members.end(), item);
+    placement.position = static_cast<size_t>(pos - members.begin());
+    members.erase(pos);
+
+    if (members.empty()) {
+        const uint32_t group = placement.group;
+        m_lookup.erase(m_keys[group]);
+        m_keys.erase(m_keys.begin() + group);
+        m_members.erase(m_members.begin() + group);
+        for (auto& entry : m_lookup) {
+            if (entry.second > group) {
+                --entry.second;
+            }
+        }
+        for (auto& g : m_item_group) {
+            if (g > group) {
+                --g;
+            }
+        }
+        placement.group_changed = true;
+    }
+    return placement;
+}
+
+} // namespace xaml_bridge
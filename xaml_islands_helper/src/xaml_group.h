@@ -0,0 +1,76 @@
+#pragma once
+
+// Grouping of ListView items by a host-provided key.
+//
+// Groups appear in order of their key's first occurrence and each group lists
+// its items in insertion order, so the partition is stable. Item indices are
+// insertion (store) positions.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace xaml_bridge {
+
+class GroupIndex {
+public:
+    // Where an item was inserted into or removed from. `group_changed` is set
+    // when the group itself was created (always at the end) or removed.
+    struct Placement {
+        uint32_t group = 0;
+        size_t position = 0;
+        bool group_changed = false;
+    };
+
+    // Result of set_key: the removal is applied first, so `to.group` refers to
+    // the group list after `from` took effect.
+    struct Move {
+        Placement from;
+        Placement to;
+        bool moved = false;  // False when the key did not change
+    };
+
+    // Partition items by key, replacing any previous grouping. Large inputs
+    // are hashed in parallel chunks and merged in chunk order.
+    void assign(const std::vector<std::u16string>& keys);
+
+    Placement append(std::u16string_view key);
+
+    // Remove an item; later items shift down by one.
+    Placement remove(size_t item);
+
+    // Move an item to the group for `key`, keeping insertion order there.
+    Move set_key(size_t item, std::u16string_view key);
+
+    void clear();
+
+    size_t group_count() const noexcept { return m_keys.size(); }
+    size_t item_count() const noexcept { return m_item_group.size(); }
+    const std::u16string& key(size_t group) const { return m_keys[group]; }
+    const std::vector<uint32_t>& members(size_t group) const { return m_members[group]; }
+    uint32_t group_of(size_t item) const { return m_item_group[item]; }
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    // A grouped ListView shows the members of each group in turn. These map
+    // between positions in that flattened list and item indices.
+    size_t item_at(size_t position) const;  // npos when out of range
+    size_t position_of(size_t item) const;
+    // item_at for ascending `positions` in one pass over the groups, sorted
+    // by item. Out-of-range positions are dropped.
+    std::vector<int> items_at(const std::vector<int>& positions) const;
+
+private:
+    Placement insert(uint32_t item, std::u16string_view key);
+    Placement erase(uint32_t item);
+
+    std::vector<std::u16string> m_keys;              // Per group
+    std::vector<std::vector<uint32_t>> m_members;    // Per group, ascending item indices
+    std::vector<uint32_t> m_item_group;              // Per item
+    std::unordered_map<std::u16string, uint32_t> m_lookup;
+};
+
+} // namespace xaml_bridge
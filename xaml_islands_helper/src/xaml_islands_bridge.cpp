@@ -1,16 +1,48 @@
 #include "xaml_islands_bridge.h"
 #include <winrt/Windows.Foundation.h>
 #include <winrt/Windows.Foundation.Collections.h>
+#include <winrt/Windows.Foundation.Numerics.h>
+#include <winrt/Windows.System.h>
+#include <winrt/Windows.UI.Composition.h>
+#include <winrt/Windows.UI.Input.h>
 #include <winrt/Windows.UI.Xaml.h>
 #include <winrt/Windows.UI.Xaml.Controls.h>
 #include <winrt/Windows.UI.Xaml.Controls.Primitives.h>
+#include <winrt/Windows.UI.Xaml.Data.h>
+#include <winrt/Windows.UI.Xaml.Documents.h>
 #include <winrt/Windows.UI.Xaml.Hosting.h>
+#include <winrt/Windows.UI.Xaml.Input.h>
+#include <winrt/Windows.UI.Xaml.Interop.h>
+#include <winrt/Windows.UI.Xaml.Markup.h>
 #include <winrt/Windows.UI.Xaml.Media.h>
 #include <winrt/Windows.UI.Xaml.Media.Animation.h>
 #include <winrt/Windows.UI.Xaml.Media.Imaging.h>
 #include <Windows.UI.Xaml.Hosting.DesktopWindowXamlSource.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <iterator>
+#include <list>
+#include <map>
 #include <string>
+#include <string_view>
 #include <memory>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "xaml_animation.h"
+#include "xaml_frame_stats.h"
+#include "xaml_group.h"
+#include "xaml_list_model.h"
+#include "xaml_log_buffer.h"
+#include "xaml_number_format.h"
+#include "xaml_property_changes.h"
+#include "xaml_slot_table.h"
+#include "xaml_string_table.h"
 
 using namespace winrt;
 using namespace Windows::Foundation;
@@ -33,8 +65,24 @@ void set_last_error(const std::wstring& message) {
     g_last_error = message;
 }
 
+// Exported calls made on this thread. Frame stats report how many the UI
+// thread made between two frames.
+thread_local uint64_t g_bridge_calls = 0;
+
+inline void count_bridge_call() {
+    ++g_bridge_calls;
+}
+
+// The portable kernels store text as char16_t; wchar_t is UTF-16 on Windows.
+static_assert(sizeof(wchar_t) == sizeof(char16_t), "wchar_t must be UTF-16");
+
+std::u16string to_u16string(const wchar_t* text) {
+    return std::u16string(reinterpret_cast<const char16_t*>(text));
+}
+
 // Initialize the XAML framework
 XamlManagerHandle xaml_initialize() {
+    count_bridge_call();
     try {
         init_apartment(apartment_type::single_threaded);
 
@@ -58,6 +106,7 @@ XamlManagerHandle xaml_initialize() {
 
 // Uninitialize the XAML framework
 void xaml_uninitialize(XamlManagerHandle manager) {
+    count_bridge_call();
     if (manager) {
         auto* mgr = reinterpret_cast<std::shared_ptr<WindowsXamlManager>*>(manager);
         delete mgr;
@@ -66,6 +115,7 @@ void xaml_uninitialize(XamlManagerHandle manager) {
 
 // Create a DesktopWindowXamlSource
 XamlSourceHandle xaml_source_create() {
+    count_bridge_call();
     try {
         auto source = DesktopWindowXamlSource();
         auto* handle = new std::shared_ptr<DesktopWindowXamlSource>(
@@ -83,16 +133,24 @@ XamlSourceHandle xaml_source_create() {
     }
 }
 
+// Defined with the island activity tracking below.
+void release_source_activity(void* key);
+
 // Destroy a DesktopWindowXamlSource
 void xaml_source_destroy(XamlSourceHandle source) {
+    count_bridge_call();
     if (source) {
         auto* src = reinterpret_cast<std::shared_ptr<DesktopWindowXamlSource>*>(source);
+        if (*src) {
+            release_source_activity(get_abi(**src));
+        }
         delete src;
     }
 }
 
 // Attach XAML source to a Win32 window
 HWND xaml_source_attach_to_window(XamlSourceHandle source, HWND parent_hwnd) {
+    count_bridge_call();
     if (!source || !parent_hwnd) {
         set_last_error(L"Invalid source or parent HWND");
         return nullptr;
@@ -123,12 +181,14 @@ HWND xaml_source_attach_to_window(XamlSourceHandle source, HWND parent_hwnd) {
 
 // Set the size of the XAML island
 int xaml_source_set_size(XamlSourceHandle source, int width, int height) {
+    count_bridge_call();
     // Size is managed by the parent window, no-op for now
     return 0;
 }
 
 // Create a WinRT Button
 XamlButtonHandle xaml_button_create() {
+    count_bridge_call();
     try {
         auto button = Button();
         auto* handle = new std::shared_ptr<Button>(
@@ -148,6 +208,7 @@ XamlButtonHandle xaml_button_create() {
 
 // Destroy a WinRT Button
 void xaml_button_destroy(XamlButtonHandle button) {
+    count_bridge_call();
     if (button) {
         auto* btn = reinterpret_cast<std::shared_ptr<Button>*>(button);
         delete btn;
@@ -155,7 +216,11 @@ void xaml_button_destroy(XamlButtonHandle button) {
 }
 
 // Set button content
+// Defined with the string table implementation below.
+void forget_label_binding(const Windows::Foundation::IInspectable& element);
+
 int xaml_button_set_content(XamlButtonHandle button, const wchar_t* content) {
+    count_bridge_call();
     if (!button || !content) {
         set_last_error(L"Invalid button or content");
         return -1;
@@ -163,6 +228,7 @@ int xaml_button_set_content(XamlButtonHandle button, const wchar_t* content) {
 
     try {
         auto* btn = reinterpret_cast<std::shared_ptr<Button>*>(button);
+        forget_label_binding(**btn);
         (*btn)->Content(box_value(hstring(content)));
         return 0;
     }
@@ -178,6 +244,7 @@ int xaml_button_set_content(XamlButtonHandle button, const wchar_t* content) {
 
 // Set button size
 int xaml_button_set_size(XamlButtonHandle button, double width, double height) {
+    count_bridge_call();
     if (!button) {
         set_last_error(L"Invalid button");
         return -1;
@@ -201,6 +268,7 @@ int xaml_button_set_size(XamlButtonHandle button, double width, double height) {
 
 // Register a click event handler for a button
 int xaml_button_register_click(XamlButtonHandle button, void (*callback)(void* user_data), void* user_data) {
+    count_bridge_call();
     if (!button || !callback) {
         set_last_error(L"Invalid button or callback");
         return -1;
@@ -232,8 +300,12 @@ int xaml_button_register_click(XamlButtonHandle button, void (*callback)(void* u
     }
 }
 
+// Defined with the island activity tracking below.
+void watch_source_activity(const DesktopWindowXamlSource& source);
+
 // Set the XAML content
 int xaml_source_set_content(XamlSourceHandle source, XamlButtonHandle button) {
+    count_bridge_call();
     if (!source || !button) {
         set_last_error(L"Invalid source or button");
         return -1;
@@ -244,6 +316,7 @@ int xaml_source_set_content(XamlSourceHandle source, XamlButtonHandle button) {
         auto* btn = reinterpret_cast<std::shared_ptr<Button>*>(button);
 
         (*src)->Content(**btn);
+        watch_source_activity(**src);
         return 0;
     }
     catch (const hresult_error& e) {
@@ -258,11 +331,34 @@ int xaml_source_set_content(XamlSourceHandle source, XamlButtonHandle button) {
 
 // Get last error
 const wchar_t* xaml_get_last_error() {
+    count_bridge_call();
     return g_last_error.c_str();
 }
 
 // ===== TextBlock Implementation =====
+
+// Text last written by xaml_textblock_set_number, keyed by handle. Other
+// text setters and destroy drop the entry so a stale value never suppresses
+// an update.
+std::mutex g_number_text_mutex;
+xaml_bridge::NumberTextCache g_number_text;
+
+void forget_number_text(XamlTextBlockHandle textblock) {
+    std::lock_guard<std::mutex> lock(g_number_text_mutex);
+    g_number_text.forget(textblock);
+}
+
+// The same for a TextBlock reached through another handle. Scans the cache,
+// so keep it off hot paths.
+void forget_number_text(const TextBlock& textblock) {
+    std::lock_guard<std::mutex> lock(g_number_text_mutex);
+    g_number_text.forget_if([&](const void* key) {
+        return **static_cast<const std::shared_ptr<TextBlock>*>(key) == textblock;
+    });
+}
+
 XamlTextBlockHandle xaml_textblock_create() {
+    count_bridge_call();
     try {
         auto textblock = TextBlock();
         auto* handle = new std::shared_ptr<TextBlock>(
@@ -281,20 +377,25 @@ XamlTextBlockHandle xaml_textblock_create() {
 }
 
 void xaml_textblock_destroy(XamlTextBlockHandle textblock) {
+    count_bridge_call();
     if (textblock) {
+        forget_number_text(textblock);
         auto* tb = reinterpret_cast<std::shared_ptr<TextBlock>*>(textblock);
         delete tb;
     }
 }
 
 int xaml_textblock_set_text(XamlTextBlockHandle textblock, const wchar_t* text) {
+    count_bridge_call();
     if (!textblock || !text) {
         set_last_error(L"Invalid textblock or text");
         return -1;
     }
 
     try {
+        forget_number_text(textblock);
         auto* tb = reinterpret_cast<std::shared_ptr<TextBlock>*>(textblock);
+        forget_label_binding(**tb);
         (*tb)->Text(text);
         return 0;
     }
@@ -309,6 +410,7 @@ int xaml_textblock_set_text(XamlTextBlockHandle textblock, const wchar_t* text)
 }
 
 int xaml_textblock_set_font_size(XamlTextBlockHandle textblock, double size) {
+    count_bridge_call();
     if (!textblock) {
         set_last_error(L"Invalid textblock");
         return -1;
@@ -329,8 +431,158 @@ int xaml_textblock_set_font_size(XamlTextBlockHandle textblock, double size) {
     }
 }
 
+// Defined with the styling implementations below.
+SolidColorBrush create_solid_brush(unsigned int argb);
+
+// Run foregrounds share one brush per color on each UI thread. Log views
+// color thousands of runs from a handful of colors.
+constexpr size_t kRunBrushCacheCapacity = 256;
+thread_local std::unordered_map<uint32_t, SolidColorBrush> g_run_brushes;
+
+SolidColorBrush cached_run_brush(uint32_t argb) {
+    auto it = g_run_brushes.find(argb);
+    if (it != g_run_brushes.end()) {
+        return it->second;
+    }
+    if (g_run_brushes.size() >= kRunBrushCacheCapacity) {
+        g_run_brushes.clear();
+    }
+    return g_run_brushes.emplace(argb, create_solid_brush(argb)).first->second;
+}
+
+int xaml_textblock_set_runs(
+    XamlTextBlockHandle textblock,
+    const wchar_t* text,
+    const XamlRunSpec* runs,
+    int count
+) {
+    count_bridge_call();
+    if (!textblock || !text || count < 0 || (count > 0 && !runs)) {
+        set_last_error(L"Invalid textblock, text or runs");
+        return -1;
+    }
+
+    const std::wstring_view view(text);
+    int64_t cursor = 0;
+    for (int i = 0; i < count; ++i) {
+        const int64_t start = runs[i].start;
+        const int64_t end = start + runs[i].length;
+        if (runs[i].length < 0 || start < cursor || end > static_cast<int64_t>(view.size())) {
+            set_last_error(L"Run " + std::to_wstring(i) + L" is out of order, overlaps or lies outside the text");
+            return -1;
+        }
+        cursor = end;
+    }
+
+    try {
+        forget_number_text(textblock);
+        auto& tb = *reinterpret_cast<std::shared_ptr<TextBlock>*>(textblock);
+        forget_label_binding(*tb);
+        std::vector<Documents::Inline> inlines;
+        inlines.reserve(static_cast<size_t>(count) * 2 + 1);
+        auto add_run = [&](size_t from, size_t to) {
+            Documents::Run run;
+            run.Text(hstring(view.substr(from, to - from)));
+            inlines.push_back(run);
+            return run;
+        };
+
+        size_t position = 0;
+        for (int i = 0; i < count; ++i) {
+            const XamlRunSpec& spec = runs[i];
+            const size_t start = static_cast<size_t>(spec.start);
+            if (start > position) {
+                add_run(position, start);
+            }
+            position = start + static_cast<size_t>(spec.length);
+            if (spec.length == 0) {
+                continue;
+            }
+            Documents::Run run = add_run(start, position);
+            if (spec.foreground != 0) {
+                run.Foreground(cached_run_brush(spec.foreground));
+            }
+            if (spec.weight > 0) {
+                Windows::UI::Text::FontWeight weight;
+                weight.Weight = static_cast<uint16_t>(spec.weight);
+                run.FontWeight(weight);
+            }
+            if (spec.italic) {
+                run.FontStyle(Windows::UI::Text::FontStyle::Italic);
+            }
+        }
+        if (position < view.size()) {
+            add_run(position, view.size());
+        }
+
+        // One collection change instead of a Clear plus an Append per run.
+        tb->Inlines().ReplaceAll(inlines);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_textblock_set_runs");
+        return -1;
+    }
+}
+
+int xaml_textblock_set_number(XamlTextBlockHandle textblock, double value, const XamlNumberFormat* format) {
+    count_bridge_call();
+    if (!textblock) {
+        set_last_error(L"Invalid textblock");
+        return -1;
+    }
+
+    xaml_bridge::NumberFormat options;
+    if (format) {
+        options.precision = format->precision;
+        options.grouping = (format->flags & XAML_NUMBER_GROUPING) != 0;
+        options.plus_sign = (format->flags & XAML_NUMBER_PLUS_SIGN) != 0;
+        if (format->decimal_point) {
+            options.decimal_point = static_cast<char16_t>(format->decimal_point);
+        }
+        if (format->group_separator) {
+            options.group_separator = static_cast<char16_t>(format->group_separator);
+        }
+        if (format->prefix) {
+            options.prefix = reinterpret_cast<const char16_t*>(format->prefix);
+        }
+        if (format->suffix) {
+            options.suffix = reinterpret_cast<const char16_t*>(format->suffix);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(g_number_text_mutex);
+    if (!g_number_text.update(textblock, value, options)) {
+        return 0;
+    }
+
+    try {
+        // The formatted text is NUL-terminated, so XAML receives it as a
+        // string reference without another copy on our side.
+        auto& tb = *reinterpret_cast<std::shared_ptr<TextBlock>*>(textblock);
+        forget_label_binding(*tb);
+        tb->Text(reinterpret_cast<const wchar_t*>(g_number_text.text().c_str()));
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        g_number_text.forget(textblock);
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        g_number_text.forget(textblock);
+        set_last_error(L"Unknown error in xaml_textblock_set_number");
+        return -1;
+    }
+}
+
 // ===== TextBox Implementation =====
 XamlTextBoxHandle xaml_textbox_create() {
+    count_bridge_call();
     try {
         auto textbox = TextBox();
         auto* handle = new std::shared_ptr<TextBox>(
@@ -349,6 +601,7 @@ XamlTextBoxHandle xaml_textbox_create() {
 }
 
 void xaml_textbox_destroy(XamlTextBoxHandle textbox) {
+    count_bridge_call();
     if (textbox) {
         auto* tb = reinterpret_cast<std::shared_ptr<TextBox>*>(textbox);
         delete tb;
@@ -356,6 +609,7 @@ void xaml_textbox_destroy(XamlTextBoxHandle textbox) {
 }
 
 int xaml_textbox_set_text(XamlTextBoxHandle textbox, const wchar_t* text) {
+    count_bridge_call();
     if (!textbox || !text) {
         set_last_error(L"Invalid textbox or text");
         return -1;
@@ -378,7 +632,8 @@ int xaml_textbox_set_text(XamlTextBoxHandle textbox, const wchar_t* text) {
 
 // Get the text content from a TextBox
 int xaml_textbox_get_text(XamlTextBoxHandle textbox, wchar_t* buffer, int buffer_size) {
-    if (!textbox || !buffer || buffer_size <= 0) {
+    count_bridge_call();
+    if (!textbox || buffer_size < 0 || (buffer_size > 0 && !buffer)) {
         set_last_error(L"Invalid textbox, buffer, or buffer size");
         return -1;
     }
@@ -387,28 +642,139 @@ int xaml_textbox_get_text(XamlTextBoxHandle textbox, wchar_t* buffer, int buffer
         auto* tb = reinterpret_cast<std::shared_ptr<TextBox>*>(textbox);
         auto text = (*tb)->Text();
 
-        // Copy the text to the buffer
-        int len = static_cast<int>(text.size());
-        if (len >= buffer_size) {
-            len = buffer_size - 1; // Leave room for null terminator
+        // Copy what fits and report the full length
+        const int len = static_cast<int>(text.size());
+        if (buffer_size > 0) {
+            const int copied = std::min(len, buffer_size - 1);
+            wcsncpy_s(buffer, buffer_size, text.c_str(), copied);
         }
+        return len;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_textbox_get_text");
+        return -1;
+    }
+}
 
-        wcsncpy_s(buffer, buffer_size, text.c_str(), len);
-        buffer[len] = L'\0';
+int xaml_textbox_get_text_length(XamlTextBoxHandle textbox) {
+    count_bridge_call();
+    if (!textbox) {
+        set_last_error(L"Invalid textbox");
+        return -1;
+    }
 
-        return len; // Return the number of characters copied
+    try {
+        auto* tb = reinterpret_cast<std::shared_ptr<TextBox>*>(textbox);
+        return static_cast<int>((*tb)->Text().size());
     }
     catch (const hresult_error& e) {
         set_last_error(e.message().c_str());
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_textbox_get_text");
+        set_last_error(L"Unknown error in xaml_textbox_get_text_length");
+        return -1;
+    }
+}
+
+// Length of the TextBox's text without copying it out: select everything
+// and read the selection. The caller restores the selection.
+int32_t textbox_length_by_selection(const TextBox& tb) {
+    tb.SelectAll();
+    return tb.SelectionStart() + tb.SelectionLength();
+}
+
+// Replace [start, start + length) through the selection, so XAML edits its
+// text store in place. start < 0 appends. Returns false, with the selection
+// untouched, when the range lies outside the text.
+bool edit_textbox_range(const TextBox& tb, int32_t start, int32_t length, std::wstring_view text) {
+    const int32_t selection_start = tb.SelectionStart();
+    const int32_t selection_end = selection_start + tb.SelectionLength();
+    const int32_t before = textbox_length_by_selection(tb);
+    if (start < 0) {
+        start = before;
+        length = 0;
+    }
+    if (length < 0 || start > before || length > before - start) {
+        tb.Select(selection_start, selection_end - selection_start);
+        return false;
+    }
+
+    tb.Select(start, length);
+    tb.SelectedText(hstring(text));
+    // Line breaks are normalized on insertion, so measure the inserted text
+    // rather than trusting text.size().
+    const int32_t inserted = textbox_length_by_selection(tb) - (before - length);
+    const int32_t delta = inserted - length;
+    const int32_t edit_end = start + length;
+
+    int32_t new_start = selection_start;
+    int32_t new_end = selection_end;
+    if (selection_start >= edit_end) {
+        new_start += delta;
+        new_end += delta;
+    } else if (selection_end > start) {
+        new_start = new_end = start + inserted;
+    }
+    tb.Select(new_start, new_end - new_start);
+    return true;
+}
+
+int xaml_textbox_append(XamlTextBoxHandle textbox, const wchar_t* text, int text_length) {
+    count_bridge_call();
+    if (!textbox || !text || text_length < -1) {
+        set_last_error(L"Invalid textbox, text or text length");
+        return -1;
+    }
+
+    try {
+        auto& tb = *reinterpret_cast<std::shared_ptr<TextBox>*>(textbox);
+        const std::wstring_view view = text_length < 0 ? std::wstring_view(text) : std::wstring_view(text, static_cast<size_t>(text_length));
+        edit_textbox_range(*tb, -1, 0, view);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_textbox_append");
+        return -1;
+    }
+}
+
+int xaml_textbox_replace_range(XamlTextBoxHandle textbox, int start, int length, const wchar_t* text, int text_length) {
+    count_bridge_call();
+    if (!textbox || !text || text_length < -1 || start < 0 || length < 0) {
+        set_last_error(L"Invalid textbox, range, text or text length");
+        return -1;
+    }
+
+    try {
+        auto& tb = *reinterpret_cast<std::shared_ptr<TextBox>*>(textbox);
+        const std::wstring_view view = text_length < 0 ? std::wstring_view(text) : std::wstring_view(text, static_cast<size_t>(text_length));
+        if (!edit_textbox_range(*tb, start, length, view)) {
+            set_last_error(L"Range " + std::to_wstring(start) + L"+" + std::to_wstring(length) + L" lies outside the text");
+            return -1;
+        }
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_textbox_replace_range");
         return -1;
     }
 }
 
 int xaml_textbox_set_placeholder(XamlTextBoxHandle textbox, const wchar_t* placeholder) {
+    count_bridge_call();
     if (!textbox || !placeholder) {
         set_last_error(L"Invalid textbox or placeholder");
         return -1;
@@ -430,6 +796,7 @@ int xaml_textbox_set_placeholder(XamlTextBoxHandle textbox, const wchar_t* place
 }
 
 int xaml_textbox_set_size(XamlTextBoxHandle textbox, double width, double height) {
+    count_bridge_call();
     if (!textbox) {
         set_last_error(L"Invalid textbox");
         return -1;
@@ -453,6 +820,7 @@ int xaml_textbox_set_size(XamlTextBoxHandle textbox, double width, double height
 
 // ===== StackPanel Implementation =====
 XamlStackPanelHandle xaml_stackpanel_create() {
+    count_bridge_call();
     try {
         auto panel = StackPanel();
         auto* handle = new std::shared_ptr<StackPanel>(
@@ -471,6 +839,7 @@ XamlStackPanelHandle xaml_stackpanel_create() {
 }
 
 void xaml_stackpanel_destroy(XamlStackPanelHandle panel) {
+    count_bridge_call();
     if (panel) {
         auto* sp = reinterpret_cast<std::shared_ptr<StackPanel>*>(panel);
         delete sp;
@@ -478,6 +847,7 @@ void xaml_stackpanel_destroy(XamlStackPanelHandle panel) {
 }
 
 int xaml_stackpanel_add_child(XamlStackPanelHandle panel, XamlUIElementHandle child) {
+    count_bridge_call();
     if (!panel || !child) {
         set_last_error(L"Invalid panel or child");
         return -1;
@@ -504,6 +874,7 @@ int xaml_stackpanel_add_child(XamlStackPanelHandle panel, XamlUIElementHandle ch
 }
 
 int xaml_stackpanel_set_orientation(XamlStackPanelHandle panel, int vertical) {
+    count_bridge_call();
     if (!panel) {
         set_last_error(L"Invalid panel");
         return -1;
@@ -525,6 +896,7 @@ int xaml_stackpanel_set_orientation(XamlStackPanelHandle panel, int vertical) {
 }
 
 int xaml_stackpanel_set_spacing(XamlStackPanelHandle panel, double spacing) {
+    count_bridge_call();
     if (!panel) {
         set_last_error(L"Invalid panel");
         return -1;
@@ -547,6 +919,7 @@ int xaml_stackpanel_set_spacing(XamlStackPanelHandle panel, double spacing) {
 
 // ===== Grid Implementation =====
 XamlGridHandle xaml_grid_create() {
+    count_bridge_call();
     try {
         auto grid = Grid();
         auto* handle = new std::shared_ptr<Grid>(
@@ -565,6 +938,7 @@ XamlGridHandle xaml_grid_create() {
 }
 
 void xaml_grid_destroy(XamlGridHandle grid) {
+    count_bridge_call();
     if (grid) {
         auto* g = reinterpret_cast<std::shared_ptr<Grid>*>(grid);
         delete g;
@@ -572,6 +946,7 @@ void xaml_grid_destroy(XamlGridHandle grid) {
 }
 
 int xaml_grid_add_child(XamlGridHandle grid, XamlUIElementHandle child) {
+    count_bridge_call();
     if (!grid || !child) {
         set_last_error(L"Invalid grid or child");
         return -1;
@@ -599,6 +974,7 @@ int xaml_grid_add_child(XamlGridHandle grid, XamlUIElementHandle child) {
 
 // ===== ScrollViewer APIs =====
 XamlScrollViewerHandle xaml_scrollviewer_create() {
+    count_bridge_call();
     try {
         auto scrollviewer = ScrollViewer();
         auto* handle = new std::shared_ptr<ScrollViewer>(
@@ -617,6 +993,7 @@ XamlScrollViewerHandle xaml_scrollviewer_create() {
 }
 
 void xaml_scrollviewer_destroy(XamlScrollViewerHandle scrollviewer) {
+    count_bridge_call();
     if (scrollviewer) {
         auto* sv = reinterpret_cast<std::shared_ptr<ScrollViewer>*>(scrollviewer);
         delete sv;
@@ -624,6 +1001,7 @@ void xaml_scrollviewer_destroy(XamlScrollViewerHandle scrollviewer) {
 }
 
 int xaml_scrollviewer_set_content(XamlScrollViewerHandle scrollviewer, XamlUIElementHandle content) {
+    count_bridge_call();
     if (!scrollviewer || !content) {
         set_last_error(L"Invalid scrollviewer or content");
         return -1;
@@ -646,6 +1024,7 @@ int xaml_scrollviewer_set_content(XamlScrollViewerHandle scrollviewer, XamlUIEle
 }
 
 int xaml_scrollviewer_set_horizontal_scroll_mode(XamlScrollViewerHandle scrollviewer, int mode) {
+    count_bridge_call();
     if (!scrollviewer) {
         set_last_error(L"Invalid scrollviewer handle");
         return -1;
@@ -669,6 +1048,7 @@ int xaml_scrollviewer_set_horizontal_scroll_mode(XamlScrollViewerHandle scrollvi
 }
 
 int xaml_scrollviewer_set_vertical_scroll_mode(XamlScrollViewerHandle scrollviewer, int mode) {
+    count_bridge_call();
     if (!scrollviewer) {
         set_last_error(L"Invalid scrollviewer handle");
         return -1;
@@ -692,6 +1072,7 @@ int xaml_scrollviewer_set_vertical_scroll_mode(XamlScrollViewerHandle scrollview
 }
 
 int xaml_scrollviewer_set_horizontal_scroll_bar_visibility(XamlScrollViewerHandle scrollviewer, int visibility) {
+    count_bridge_call();
     if (!scrollviewer) {
         set_last_error(L"Invalid scrollviewer handle");
         return -1;
@@ -715,6 +1096,7 @@ int xaml_scrollviewer_set_horizontal_scroll_bar_visibility(XamlScrollViewerHandl
 }
 
 int xaml_scrollviewer_set_vertical_scroll_bar_visibility(XamlScrollViewerHandle scrollviewer, int visibility) {
+    count_bridge_call();
     if (!scrollviewer) {
         set_last_error(L"Invalid scrollviewer handle");
         return -1;
@@ -739,6 +1121,7 @@ int xaml_scrollviewer_set_vertical_scroll_bar_visibility(XamlScrollViewerHandle
 
 // ===== Generic Content API =====
 int xaml_source_set_content_generic(XamlSourceHandle source, XamlUIElementHandle element) {
+    count_bridge_call();
     if (!source || !element) {
         set_last_error(L"Invalid source or element");
         return -1;
@@ -748,6 +1131,7 @@ int xaml_source_set_content_generic(XamlSourceHandle source, XamlUIElementHandle
         auto* src = reinterpret_cast<std::shared_ptr<DesktopWindowXamlSource>*>(source);
         auto* elem = reinterpret_cast<std::shared_ptr<UIElement>*>(element);
         (*src)->Content(**elem);
+        watch_source_activity(**src);
         return 0;
     }
     catch (const hresult_error& e) {
@@ -762,6 +1146,7 @@ int xaml_source_set_content_generic(XamlSourceHandle source, XamlUIElementHandle
 
 // ===== Type Conversion APIs =====
 XamlUIElementHandle xaml_button_as_uielement(XamlButtonHandle button) {
+    count_bridge_call();
     if (!button) return nullptr;
 
     try {
@@ -778,6 +1163,7 @@ XamlUIElementHandle xaml_button_as_uielement(XamlButtonHandle button) {
 }
 
 XamlUIElementHandle xaml_textblock_as_uielement(XamlTextBlockHandle textblock) {
+    count_bridge_call();
     if (!textblock) return nullptr;
 
     try {
@@ -794,6 +1180,7 @@ XamlUIElementHandle xaml_textblock_as_uielement(XamlTextBlockHandle textblock) {
 }
 
 XamlUIElementHandle xaml_textbox_as_uielement(XamlTextBoxHandle textbox) {
+    count_bridge_call();
     if (!textbox) return nullptr;
 
     try {
@@ -810,6 +1197,7 @@ XamlUIElementHandle xaml_textbox_as_uielement(XamlTextBoxHandle textbox) {
 }
 
 XamlUIElementHandle xaml_stackpanel_as_uielement(XamlStackPanelHandle panel) {
+    count_bridge_call();
     if (!panel) return nullptr;
 
     try {
@@ -826,6 +1214,7 @@ XamlUIElementHandle xaml_stackpanel_as_uielement(XamlStackPanelHandle panel) {
 }
 
 XamlUIElementHandle xaml_grid_as_uielement(XamlGridHandle grid) {
+    count_bridge_call();
     if (!grid) return nullptr;
 
     try {
@@ -842,6 +1231,7 @@ XamlUIElementHandle xaml_grid_as_uielement(XamlGridHandle grid) {
 }
 
 XamlUIElementHandle xaml_scrollviewer_as_uielement(XamlScrollViewerHandle scrollviewer) {
+    count_bridge_call();
     if (!scrollviewer) return nullptr;
 
     try {
@@ -876,6 +1266,7 @@ SolidColorBrush create_solid_brush(unsigned int argb) {
 
 // Button styling
 int xaml_button_set_background(XamlButtonHandle button, unsigned int color) {
+    count_bridge_call();
     if (!button) {
         set_last_error(L"Invalid button handle");
         return -1;
@@ -897,6 +1288,7 @@ int xaml_button_set_background(XamlButtonHandle button, unsigned int color) {
 }
 
 int xaml_button_set_foreground(XamlButtonHandle button, unsigned int color) {
+    count_bridge_call();
     if (!button) {
         set_last_error(L"Invalid button handle");
         return -1;
@@ -918,6 +1310,7 @@ int xaml_button_set_foreground(XamlButtonHandle button, unsigned int color) {
 }
 
 int xaml_button_set_corner_radius(XamlButtonHandle button, double radius) {
+    count_bridge_call();
     if (!button) {
         set_last_error(L"Invalid button handle");
         return -1;
@@ -939,6 +1332,7 @@ int xaml_button_set_corner_radius(XamlButtonHandle button, double radius) {
 }
 
 int xaml_button_set_padding(XamlButtonHandle button, double left, double top, double right, double bottom) {
+    count_bridge_call();
     if (!button) {
         set_last_error(L"Invalid button handle");
         return -1;
@@ -961,6 +1355,7 @@ int xaml_button_set_padding(XamlButtonHandle button, double left, double top, do
 
 // TextBlock styling
 int xaml_textblock_set_foreground(XamlTextBlockHandle textblock, unsigned int color) {
+    count_bridge_call();
     if (!textblock) {
         set_last_error(L"Invalid textblock handle");
         return -1;
@@ -982,6 +1377,7 @@ int xaml_textblock_set_foreground(XamlTextBlockHandle textblock, unsigned int co
 }
 
 int xaml_textblock_set_font_weight(XamlTextBlockHandle textblock, int weight) {
+    count_bridge_call();
     if (!textblock) {
         set_last_error(L"Invalid textblock handle");
         return -1;
@@ -1005,6 +1401,7 @@ int xaml_textblock_set_font_weight(XamlTextBlockHandle textblock, int weight) {
 }
 
 int xaml_textblock_set_margin(XamlTextBlockHandle textblock, double left, double top, double right, double bottom) {
+    count_bridge_call();
     if (!textblock) {
         set_last_error(L"Invalid textblock handle");
         return -1;
@@ -1027,6 +1424,7 @@ int xaml_textblock_set_margin(XamlTextBlockHandle textblock, double left, double
 
 // TextBox styling
 int xaml_textbox_set_background(XamlTextBoxHandle textbox, unsigned int color) {
+    count_bridge_call();
     if (!textbox) {
         set_last_error(L"Invalid textbox handle");
         return -1;
@@ -1048,6 +1446,7 @@ int xaml_textbox_set_background(XamlTextBoxHandle textbox, unsigned int color) {
 }
 
 int xaml_textbox_set_foreground(XamlTextBoxHandle textbox, unsigned int color) {
+    count_bridge_call();
     if (!textbox) {
         set_last_error(L"Invalid textbox handle");
         return -1;
@@ -1069,6 +1468,7 @@ int xaml_textbox_set_foreground(XamlTextBoxHandle textbox, unsigned int color) {
 }
 
 int xaml_textbox_set_corner_radius(XamlTextBoxHandle textbox, double radius) {
+    count_bridge_call();
     if (!textbox) {
         set_last_error(L"Invalid textbox handle");
         return -1;
@@ -1090,6 +1490,7 @@ int xaml_textbox_set_corner_radius(XamlTextBoxHandle textbox, double radius) {
 }
 
 int xaml_textbox_set_padding(XamlTextBoxHandle textbox, double left, double top, double right, double bottom) {
+    count_bridge_call();
     if (!textbox) {
         set_last_error(L"Invalid textbox handle");
         return -1;
@@ -1112,6 +1513,7 @@ int xaml_textbox_set_padding(XamlTextBoxHandle textbox, double left, double top,
 
 // StackPanel styling
 int xaml_stackpanel_set_background(XamlStackPanelHandle panel, unsigned int color) {
+    count_bridge_call();
     if (!panel) {
         set_last_error(L"Invalid panel handle");
         return -1;
@@ -1133,6 +1535,7 @@ int xaml_stackpanel_set_background(XamlStackPanelHandle panel, unsigned int colo
 }
 
 int xaml_stackpanel_set_padding(XamlStackPanelHandle panel, double left, double top, double right, double bottom) {
+    count_bridge_call();
     if (!panel) {
         set_last_error(L"Invalid panel handle");
         return -1;
@@ -1154,6 +1557,7 @@ int xaml_stackpanel_set_padding(XamlStackPanelHandle panel, double left, double
 }
 
 int xaml_stackpanel_set_corner_radius(XamlStackPanelHandle panel, double radius) {
+    count_bridge_call();
     if (!panel) {
         set_last_error(L"Invalid panel handle");
         return -1;
@@ -1176,6 +1580,7 @@ int xaml_stackpanel_set_corner_radius(XamlStackPanelHandle panel, double radius)
 
 // Grid styling
 int xaml_grid_set_background(XamlGridHandle grid, unsigned int color) {
+    count_bridge_call();
     if (!grid) {
         set_last_error(L"Invalid grid handle");
         return -1;
@@ -1197,6 +1602,7 @@ int xaml_grid_set_background(XamlGridHandle grid, unsigned int color) {
 }
 
 int xaml_grid_set_padding(XamlGridHandle grid, double left, double top, double right, double bottom) {
+    count_bridge_call();
     if (!grid) {
         set_last_error(L"Invalid grid handle");
         return -1;
@@ -1218,6 +1624,7 @@ int xaml_grid_set_padding(XamlGridHandle grid, double left, double top, double r
 }
 
 int xaml_grid_set_corner_radius(XamlGridHandle grid, double radius) {
+    count_bridge_call();
     if (!grid) {
         set_last_error(L"Invalid grid handle");
         return -1;
@@ -1242,6 +1649,7 @@ int xaml_grid_set_corner_radius(XamlGridHandle grid, double radius) {
 // ===== CheckBox Implementation =====
 
 XamlCheckBoxHandle xaml_checkbox_create() {
+    count_bridge_call();
     try {
         auto* checkbox = new std::shared_ptr<CheckBox>(std::make_shared<CheckBox>());
         return checkbox;
@@ -1253,6 +1661,7 @@ XamlCheckBoxHandle xaml_checkbox_create() {
 }
 
 int xaml_checkbox_set_content(XamlCheckBoxHandle handle, const wchar_t* content) {
+    count_bridge_call();
     if (!handle || !content) return -1;
     try {
         auto* checkbox = reinterpret_cast<std::shared_ptr<CheckBox>*>(handle);
@@ -1266,6 +1675,7 @@ int xaml_checkbox_set_content(XamlCheckBoxHandle handle, const wchar_t* content)
 }
 
 int xaml_checkbox_set_is_checked(XamlCheckBoxHandle handle, bool is_checked) {
+    count_bridge_call();
     if (!handle) return -1;
     try {
         auto* checkbox = reinterpret_cast<std::shared_ptr<CheckBox>*>(handle);
@@ -1279,6 +1689,7 @@ int xaml_checkbox_set_is_checked(XamlCheckBoxHandle handle, bool is_checked) {
 }
 
 bool xaml_checkbox_get_is_checked(XamlCheckBoxHandle handle) {
+    count_bridge_call();
     if (!handle) return false;
     try {
         auto* checkbox = reinterpret_cast<std::shared_ptr<CheckBox>*>(handle);
@@ -1294,6 +1705,7 @@ bool xaml_checkbox_get_is_checked(XamlCheckBoxHandle handle) {
 // ===== ComboBox Implementation =====
 
 XamlComboBoxHandle xaml_combobox_create() {
+    count_bridge_call();
     try {
         auto* combobox = new std::shared_ptr<ComboBox>(std::make_shared<ComboBox>());
         return combobox;
@@ -1305,6 +1717,7 @@ XamlComboBoxHandle xaml_combobox_create() {
 }
 
 int xaml_combobox_add_item(XamlComboBoxHandle handle, const wchar_t* item) {
+    count_bridge_call();
     if (!handle || !item) return -1;
     try {
         auto* combobox = reinterpret_cast<std::shared_ptr<ComboBox>*>(handle);
@@ -1320,6 +1733,7 @@ int xaml_combobox_add_item(XamlComboBoxHandle handle, const wchar_t* item) {
 }
 
 int xaml_combobox_set_selected_index(XamlComboBoxHandle handle, int index) {
+    count_bridge_call();
     if (!handle) return -1;
     try {
         auto* combobox = reinterpret_cast<std::shared_ptr<ComboBox>*>(handle);
@@ -1333,6 +1747,7 @@ int xaml_combobox_set_selected_index(XamlComboBoxHandle handle, int index) {
 }
 
 int xaml_combobox_get_selected_index(XamlComboBoxHandle handle) {
+    count_bridge_call();
     if (!handle) return -1;
     try {
         auto* combobox = reinterpret_cast<std::shared_ptr<ComboBox>*>(handle);
@@ -1347,6 +1762,7 @@ int xaml_combobox_get_selected_index(XamlComboBoxHandle handle) {
 // ===== Slider Implementation =====
 
 XamlSliderHandle xaml_slider_create() {
+    count_bridge_call();
     try {
         auto* slider = new std::shared_ptr<Slider>(std::make_shared<Slider>());
         return slider;
@@ -1358,6 +1774,7 @@ XamlSliderHandle xaml_slider_create() {
 }
 
 int xaml_slider_set_minimum(XamlSliderHandle handle, double minimum) {
+    count_bridge_call();
     if (!handle) return -1;
     try {
         auto* slider = reinterpret_cast<std::shared_ptr<Slider>*>(handle);
@@ -1371,6 +1788,7 @@ int xaml_slider_set_minimum(XamlSliderHandle handle, double minimum) {
 }
 
 int xaml_slider_set_maximum(XamlSliderHandle handle, double maximum) {
+    count_bridge_call();
     if (!handle) return -1;
     try {
         auto* slider = reinterpret_cast<std::shared_ptr<Slider>*>(handle);
@@ -1384,6 +1802,7 @@ int xaml_slider_set_maximum(XamlSliderHandle handle, double maximum) {
 }
 
 int xaml_slider_set_value(XamlSliderHandle handle, double value) {
+    count_bridge_call();
     if (!handle) return -1;
     try {
         auto* slider = reinterpret_cast<std::shared_ptr<Slider>*>(handle);
@@ -1397,6 +1816,7 @@ int xaml_slider_set_value(XamlSliderHandle handle, double value) {
 }
 
 double xaml_slider_get_value(XamlSliderHandle handle) {
+    count_bridge_call();
     if (!handle) return 0.0;
     try {
         auto* slider = reinterpret_cast<std::shared_ptr<Slider>*>(handle);
@@ -1411,6 +1831,7 @@ double xaml_slider_get_value(XamlSliderHandle handle) {
 // ===== ProgressBar Implementation =====
 
 XamlProgressBarHandle xaml_progressbar_create() {
+    count_bridge_call();
     try {
         auto* progressbar = new std::shared_ptr<ProgressBar>(std::make_shared<ProgressBar>());
         return progressbar;
@@ -1422,6 +1843,7 @@ XamlProgressBarHandle xaml_progressbar_create() {
 }
 
 int xaml_progressbar_set_minimum(XamlProgressBarHandle handle, double minimum) {
+    count_bridge_call();
     if (!handle) return -1;
     try {
         auto* progressbar = reinterpret_cast<std::shared_ptr<ProgressBar>*>(handle);
@@ -1435,6 +1857,7 @@ int xaml_progressbar_set_minimum(XamlProgressBarHandle handle, double minimum) {
 }
 
 int xaml_progressbar_set_maximum(XamlProgressBarHandle handle, double maximum) {
+    count_bridge_call();
     if (!handle) return -1;
     try {
         auto* progressbar = reinterpret_cast<std::shared_ptr<ProgressBar>*>(handle);
@@ -1448,6 +1871,7 @@ int xaml_progressbar_set_maximum(XamlProgressBarHandle handle, double maximum) {
 }
 
 int xaml_progressbar_set_value(XamlProgressBarHandle handle, double value) {
+    count_bridge_call();
     if (!handle) return -1;
     try {
         auto* progressbar = reinterpret_cast<std::shared_ptr<ProgressBar>*>(handle);
@@ -1460,11 +1884,16 @@ int xaml_progressbar_set_value(XamlProgressBarHandle handle, double value) {
     }
 }
 
+void forget_paused_progress(const ProgressBar& bar);
+
 int xaml_progressbar_set_is_indeterminate(XamlProgressBarHandle handle, bool is_indeterminate) {
+    count_bridge_call();
     if (!handle) return -1;
     try {
         auto* progressbar = reinterpret_cast<std::shared_ptr<ProgressBar>*>(handle);
         (*progressbar)->IsIndeterminate(is_indeterminate);
+        // The host's setting wins over a hidden island's restore.
+        forget_paused_progress(**progressbar);
         return 0;
     }
     catch (const hresult_error& ex) {
@@ -1476,18 +1905,22 @@ int xaml_progressbar_set_is_indeterminate(XamlProgressBarHandle handle, bool is_
 // ===== Type Conversion for New Controls =====
 
 XamlUIElementHandle xaml_checkbox_as_uielement(XamlCheckBoxHandle checkbox) {
+    count_bridge_call();
     return reinterpret_cast<XamlUIElementHandle>(checkbox);
 }
 
 XamlUIElementHandle xaml_combobox_as_uielement(XamlComboBoxHandle combobox) {
+    count_bridge_call();
     return reinterpret_cast<XamlUIElementHandle>(combobox);
 }
 
 XamlUIElementHandle xaml_slider_as_uielement(XamlSliderHandle slider) {
+    count_bridge_call();
     return reinterpret_cast<XamlUIElementHandle>(slider);
 }
 
 XamlUIElementHandle xaml_progressbar_as_uielement(XamlProgressBarHandle progressbar) {
+    count_bridge_call();
     return reinterpret_cast<XamlUIElementHandle>(progressbar);
 }
 
@@ -1496,6 +1929,7 @@ XamlUIElementHandle xaml_progressbar_as_uielement(XamlProgressBarHandle progress
 // ============================================================================
 
 XamlResourceDictionaryHandle xaml_resource_dictionary_create() {
+    count_bridge_call();
     try {
         auto dict = ResourceDictionary();
         auto* handle = new std::shared_ptr<ResourceDictionary>(
@@ -1514,6 +1948,7 @@ XamlResourceDictionaryHandle xaml_resource_dictionary_create() {
 }
 
 void xaml_resource_dictionary_destroy(XamlResourceDictionaryHandle dict) {
+    count_bridge_call();
     if (dict) {
         auto* ptr = reinterpret_cast<std::shared_ptr<ResourceDictionary>*>(dict);
         delete ptr;
@@ -1525,6 +1960,7 @@ int xaml_resource_dictionary_insert_color(
     const wchar_t* key,
     unsigned int color
 ) {
+    count_bridge_call();
     if (!dict || !key) {
         set_last_error(L"Invalid handle or key");
         return -1;
@@ -1559,6 +1995,7 @@ int xaml_resource_dictionary_insert_double(
     const wchar_t* key,
     double value
 ) {
+    count_bridge_call();
     if (!dict || !key) {
         set_last_error(L"Invalid handle or key");
         return -1;
@@ -1584,6 +2021,7 @@ int xaml_resource_dictionary_insert_string(
     const wchar_t* key,
     const wchar_t* value
 ) {
+    count_bridge_call();
     if (!dict || !key || !value) {
         set_last_error(L"Invalid handle, key, or value");
         return -1;
@@ -1608,6 +2046,7 @@ int xaml_resource_dictionary_has_key(
     XamlResourceDictionaryHandle dict,
     const wchar_t* key
 ) {
+    count_bridge_call();
     if (!dict || !key) {
         return 0;
     }
@@ -1625,6 +2064,7 @@ unsigned int xaml_resource_dictionary_get_color(
     XamlResourceDictionaryHandle dict,
     const wchar_t* key
 ) {
+    count_bridge_call();
     if (!dict || !key) {
         set_last_error(L"Invalid handle or key");
         return 0;
@@ -1652,6 +2092,7 @@ double xaml_resource_dictionary_get_double(
     XamlResourceDictionaryHandle dict,
     const wchar_t* key
 ) {
+    count_bridge_call();
     if (!dict || !key) {
         set_last_error(L"Invalid handle or key");
         return 0.0;
@@ -1676,6 +2117,7 @@ int xaml_resource_dictionary_remove(
     XamlResourceDictionaryHandle dict,
     const wchar_t* key
 ) {
+    count_bridge_call();
     if (!dict || !key) {
         set_last_error(L"Invalid handle or key");
         return -1;
@@ -1697,6 +2139,7 @@ int xaml_resource_dictionary_remove(
 }
 
 void xaml_resource_dictionary_clear(XamlResourceDictionaryHandle dict) {
+    count_bridge_call();
     if (!dict) {
         return;
     }
@@ -1714,6 +2157,7 @@ int xaml_uielement_set_resources(
     XamlUIElementHandle element,
     XamlResourceDictionaryHandle dict
 ) {
+    count_bridge_call();
     if (!element || !dict) {
         set_last_error(L"Invalid element or dictionary handle");
         return -1;
@@ -1742,6 +2186,7 @@ int xaml_uielement_set_resources(
 // ============================================================================
 
 XamlControlTemplateHandle xaml_control_template_create() {
+    count_bridge_call();
     try {
         auto template_obj = ControlTemplate();
         auto* handle = new std::shared_ptr<ControlTemplate>(
@@ -1760,6 +2205,7 @@ XamlControlTemplateHandle xaml_control_template_create() {
 }
 
 void xaml_control_template_destroy(XamlControlTemplateHandle template_handle) {
+    count_bridge_call();
     if (template_handle) {
         auto* ptr = reinterpret_cast<std::shared_ptr<ControlTemplate>*>(template_handle);
         delete ptr;
@@ -1770,15 +2216,16 @@ int xaml_control_template_set_content(
     XamlControlTemplateHandle template_handle,
     XamlUIElementHandle content
 ) {
+    count_bridge_call();
     if (!template_handle || !content) {
         set_last_error(L"Invalid template or content handle");
         return -1;
     }
 
     try {
-        // Note: Control templates in WinRT require XAML markup or
-        // more complex programmatic setup. This is a simplified version.
-        set_last_error(L"Control template content setting requires XAML markup");
+        // A ControlTemplate's visual tree is a factory for each templated
+        // control, which only markup can describe.
+        set_last_error(L"Control templates must be created with xaml_control_template_from_markup");
         return -1;
     }
     catch (const hresult_error& e) {
@@ -1791,10 +2238,103 @@ int xaml_control_template_set_content(
     }
 }
 
+// Templates belong to the thread that parsed them, so each UI thread keeps
+// its own cache, keyed by the markup as passed in. When full, the least
+// recently used template is evicted, so hot templates stay shared.
+constexpr size_t kTemplateCacheCapacity = 256;
+
+struct TemplateCache {
+    using Entry = std::pair<std::wstring, ControlTemplate>;
+    std::list<Entry> entries;          // Most recently used first
+    std::unordered_map<std::wstring_view, std::list<Entry>::iterator> index;  // Views into `entries`
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+};
+thread_local TemplateCache g_template_cache;
+
+ControlTemplate parse_control_template(const std::wstring& markup) {
+    std::wstring text = markup;
+    static const wchar_t root_tag[] = L"<ControlTemplate";
+    if (text.find(L"xmlns") == std::wstring::npos) {
+        const size_t root = text.find(root_tag);
+        if (root != std::wstring::npos) {
+            text.insert(root + std::size(root_tag) - 1,
+                L" xmlns=\"http://schemas.microsoft.com/winfx/2006/xaml/presentation\""
+                L" xmlns:x=\"http://schemas.microsoft.com/winfx/2006/xaml\"");
+        }
+    }
+    return Markup::XamlReader::Load(text).try_as<ControlTemplate>();
+}
+
+XamlControlTemplateHandle xaml_control_template_from_markup(const wchar_t* markup) {
+    count_bridge_call();
+    if (!markup || !*markup) {
+        set_last_error(L"Template markup is empty");
+        return nullptr;
+    }
+
+    try {
+        TemplateCache& cache = g_template_cache;
+        ControlTemplate template_obj{nullptr};
+        auto cached = cache.index.find(std::wstring_view(markup));
+        if (cached != cache.index.end()) {
+            cache.entries.splice(cache.entries.begin(), cache.entries, cached->second);
+            template_obj = cached->second->second;
+            ++cache.hits;
+        } else {
+            std::wstring key(markup);
+            template_obj = parse_control_template(key);
+            if (!template_obj) {
+                set_last_error(L"Template markup must have a ControlTemplate root");
+                return nullptr;
+            }
+            ++cache.misses;
+            if (cache.entries.size() >= kTemplateCacheCapacity) {
+                cache.index.erase(cache.entries.back().first);
+                cache.entries.pop_back();
+            }
+            cache.entries.emplace_front(std::move(key), template_obj);
+            cache.index.emplace(cache.entries.front().first, cache.entries.begin());
+        }
+        auto* handle = new std::shared_ptr<ControlTemplate>(
+            std::make_shared<ControlTemplate>(template_obj)
+        );
+        return reinterpret_cast<XamlControlTemplateHandle>(handle);
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return nullptr;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_control_template_from_markup");
+        return nullptr;
+    }
+}
+
+int xaml_control_template_get_cache_stats(XamlTemplateCacheStats* stats) {
+    count_bridge_call();
+    if (!stats) {
+        set_last_error(L"Invalid stats pointer");
+        return -1;
+    }
+    stats->hits = g_template_cache.hits;
+    stats->misses = g_template_cache.misses;
+    stats->cached_templates = static_cast<uint32_t>(g_template_cache.entries.size());
+    return 0;
+}
+
+int xaml_control_template_clear_cache() {
+    count_bridge_call();
+    g_template_cache.index.clear();
+    g_template_cache.entries.clear();
+    return 0;
+}
+
 int xaml_button_set_template(
     XamlButtonHandle button,
     XamlControlTemplateHandle template_handle
 ) {
+    count_bridge_call();
     if (!button || !template_handle) {
         set_last_error(L"Invalid button or template handle");
         return -1;
@@ -1818,48 +2358,208 @@ int xaml_button_set_template(
 }
 
 // ============================================================================
-// Animation System Implementation
+// Style Implementation
 // ============================================================================
 
-XamlStoryboardHandle xaml_storyboard_create() {
+struct SharedStyle {
+    Style style{nullptr};
+    int target = XAML_STYLE_BUTTON;
+};
+
+bool is_style_panel(int target) {
+    return target == XAML_STYLE_STACKPANEL || target == XAML_STYLE_GRID;
+}
+
+bool is_style_control(int target) {
+    return !is_style_panel(target) && target != XAML_STYLE_TEXTBLOCK && target != XAML_STYLE_IMAGE;
+}
+
+Interop::TypeName style_target_type(int target) {
+    switch (target) {
+    case XAML_STYLE_BUTTON: return xaml_typename<Button>();
+    case XAML_STYLE_TEXTBLOCK: return xaml_typename<TextBlock>();
+    case XAML_STYLE_TEXTBOX: return xaml_typename<TextBox>();
+    case XAML_STYLE_STACKPANEL: return xaml_typename<StackPanel>();
+    case XAML_STYLE_GRID: return xaml_typename<Grid>();
+    case XAML_STYLE_CHECKBOX: return xaml_typename<CheckBox>();
+    case XAML_STYLE_COMBOBOX: return xaml_typename<ComboBox>();
+    case XAML_STYLE_SLIDER: return xaml_typename<Slider>();
+    case XAML_STYLE_PROGRESSBAR: return xaml_typename<ProgressBar>();
+    case XAML_STYLE_RADIOBUTTON: return xaml_typename<RadioButton>();
+    case XAML_STYLE_LISTVIEW: return xaml_typename<ListView>();
+    case XAML_STYLE_SCROLLVIEWER: return xaml_typename<ScrollViewer>();
+    default: return xaml_typename<Image>();
+    }
+}
+
+// XAML only applies a style to its TargetType or a type derived from it.
+bool element_matches_style(const UIElement& element, int target) {
+    switch (target) {
+    case XAML_STYLE_BUTTON: return static_cast<bool>(element.try_as<Button>());
+    case XAML_STYLE_TEXTBLOCK: return static_cast<bool>(element.try_as<TextBlock>());
+    case XAML_STYLE_TEXTBOX: return static_cast<bool>(element.try_as<TextBox>());
+    case XAML_STYLE_STACKPANEL: return static_cast<bool>(element.try_as<StackPanel>());
+    case XAML_STYLE_GRID: return static_cast<bool>(element.try_as<Grid>());
+    case XAML_STYLE_CHECKBOX: return static_cast<bool>(element.try_as<CheckBox>());
+    case XAML_STYLE_COMBOBOX: return static_cast<bool>(element.try_as<ComboBox>());
+    case XAML_STYLE_SLIDER: return static_cast<bool>(element.try_as<Slider>());
+    case XAML_STYLE_PROGRESSBAR: return static_cast<bool>(element.try_as<ProgressBar>());
+    case XAML_STYLE_RADIOBUTTON: return static_cast<bool>(element.try_as<RadioButton>());
+    case XAML_STYLE_LISTVIEW: return static_cast<bool>(element.try_as<ListView>());
+    case XAML_STYLE_SCROLLVIEWER: return static_cast<bool>(element.try_as<ScrollViewer>());
+    default: return static_cast<bool>(element.try_as<Image>());
+    }
+}
+
+// Returns nullptr when the target type has no such property.
+DependencyProperty style_property(int target, int property) {
+    const bool control = is_style_control(target);
+    const bool text = target == XAML_STYLE_TEXTBLOCK;
+    const bool stack = target == XAML_STYLE_STACKPANEL;
+    const bool grid = target == XAML_STYLE_GRID;
+    switch (property) {
+    case XAML_STYLE_BACKGROUND:
+        if (control) return Control::BackgroundProperty();
+        if (stack || grid) return Panel::BackgroundProperty();
+        break;
+    case XAML_STYLE_FOREGROUND:
+        if (control) return Control::ForegroundProperty();
+        if (text) return TextBlock::ForegroundProperty();
+        break;
+    case XAML_STYLE_BORDER_BRUSH:
+        if (control) return Control::BorderBrushProperty();
+        if (stack) return StackPanel::BorderBrushProperty();
+        if (grid) return Grid::BorderBrushProperty();
+        break;
+    case XAML_STYLE_BORDER_THICKNESS:
+        if (control) return Control::BorderThicknessProperty();
+        if (stack) return StackPanel::BorderThicknessProperty();
+        if (grid) return Grid::BorderThicknessProperty();
+        break;
+    case XAML_STYLE_CORNER_RADIUS:
+        if (control) return Control::CornerRadiusProperty();
+        if (stack) return StackPanel::CornerRadiusProperty();
+        if (grid) return Grid::CornerRadiusProperty();
+        break;
+    case XAML_STYLE_PADDING:
+        if (control) return Control::PaddingProperty();
+        if (text) return TextBlock::PaddingProperty();
+        if (stack) return StackPanel::PaddingProperty();
+        if (grid) return Grid::PaddingProperty();
+        break;
+    case XAML_STYLE_MARGIN: return FrameworkElement::MarginProperty();
+    case XAML_STYLE_WIDTH: return FrameworkElement::WidthProperty();
+    case XAML_STYLE_HEIGHT: return FrameworkElement::HeightProperty();
+    case XAML_STYLE_OPACITY: return UIElement::OpacityProperty();
+    case XAML_STYLE_FONT_SIZE:
+        if (control) return Control::FontSizeProperty();
+        if (text) return TextBlock::FontSizeProperty();
+        break;
+    case XAML_STYLE_FONT_WEIGHT:
+        if (control) return Control::FontWeightProperty();
+        if (text) return TextBlock::FontWeightProperty();
+        break;
+    case XAML_STYLE_HORIZONTAL_ALIGNMENT: return FrameworkElement::HorizontalAlignmentProperty();
+    case XAML_STYLE_VERTICAL_ALIGNMENT: return FrameworkElement::VerticalAlignmentProperty();
+    }
+    return nullptr;
+}
+
+IInspectable style_setter_value(int property, const XamlStyleValue& value) {
+    switch (property) {
+    case XAML_STYLE_BACKGROUND:
+    case XAML_STYLE_FOREGROUND:
+    case XAML_STYLE_BORDER_BRUSH:
+        // Every styled element shares this brush.
+        return create_solid_brush(value.color);
+    case XAML_STYLE_BORDER_THICKNESS:
+    case XAML_STYLE_PADDING:
+    case XAML_STYLE_MARGIN:
+        return box_value(Thickness{ value.left, value.top, value.right, value.bottom });
+    case XAML_STYLE_CORNER_RADIUS:
+        return box_value(CornerRadius{ value.number, value.number, value.number, value.number });
+    case XAML_STYLE_FONT_WEIGHT: {
+        Windows::UI::Text::FontWeight weight;
+        weight.Weight = static_cast<uint16_t>(value.number);
+        return box_value(weight);
+    }
+    case XAML_STYLE_HORIZONTAL_ALIGNMENT:
+        return box_value(static_cast<HorizontalAlignment>(static_cast<int32_t>(value.number)));
+    case XAML_STYLE_VERTICAL_ALIGNMENT:
+        return box_value(static_cast<VerticalAlignment>(static_cast<int32_t>(value.number)));
+    default:
+        return box_value(value.number);
+    }
+}
+
+XamlStyleHandle xaml_style_create(int target_type) {
+    count_bridge_call();
+    if (target_type < XAML_STYLE_BUTTON || target_type > XAML_STYLE_IMAGE) {
+        set_last_error(L"Invalid style target type");
+        return nullptr;
+    }
+
     try {
-        auto storyboard = Storyboard();
-        auto* handle = new std::shared_ptr<Storyboard>(
-            std::make_shared<Storyboard>(storyboard)
-        );
-        return reinterpret_cast<XamlStoryboardHandle>(handle);
+        auto entry = std::make_shared<SharedStyle>();
+        entry->style = Style();
+        entry->style.TargetType(style_target_type(target_type));
+        entry->target = target_type;
+        auto* handle = new std::shared_ptr<SharedStyle>(std::move(entry));
+        return reinterpret_cast<XamlStyleHandle>(handle);
     }
     catch (const hresult_error& e) {
         set_last_error(e.message().c_str());
         return nullptr;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_storyboard_create");
+        set_last_error(L"Unknown error in xaml_style_create");
         return nullptr;
     }
 }
 
-void xaml_storyboard_destroy(XamlStoryboardHandle storyboard) {
-    if (storyboard) {
-        auto* ptr = reinterpret_cast<std::shared_ptr<Storyboard>*>(storyboard);
+// Elements keep their style alive after the handle is destroyed.
+void xaml_style_destroy(XamlStyleHandle style) {
+    count_bridge_call();
+    if (style) {
+        auto* ptr = reinterpret_cast<std::shared_ptr<SharedStyle>*>(style);
         delete ptr;
     }
 }
 
-int xaml_storyboard_add_animation(
-    XamlStoryboardHandle storyboard,
-    XamlDoubleAnimationHandle animation
-) {
-    if (!storyboard || !animation) {
-        set_last_error(L"Invalid storyboard or animation handle");
+int xaml_style_add_setter(XamlStyleHandle style, int property, const XamlStyleValue* value) {
+    count_bridge_call();
+    if (!style || !value) {
+        set_last_error(L"Invalid style handle or value pointer");
         return -1;
     }
 
     try {
-        auto& sb_ptr = *reinterpret_cast<std::shared_ptr<Storyboard>*>(storyboard);
-        auto& anim_ptr = *reinterpret_cast<std::shared_ptr<DoubleAnimation>*>(animation);
+        auto& entry = *reinterpret_cast<std::shared_ptr<SharedStyle>*>(style);
+        if (entry->style.IsSealed()) {
+            set_last_error(L"The style has been applied and can no longer change");
+            return -1;
+        }
+        DependencyProperty dp = style_property(entry->target, property);
+        if (!dp) {
+            set_last_error(L"The style's target type has no such property");
+            return -1;
+        }
+        if ((property == XAML_STYLE_HORIZONTAL_ALIGNMENT || property == XAML_STYLE_VERTICAL_ALIGNMENT) &&
+            (value->number < 0.0 || value->number > 3.0)) {
+            set_last_error(L"Alignment must be between 0 and 3");
+            return -1;
+        }
 
-        sb_ptr->Children().Append(*anim_ptr);
+        // A second setter for the same property replaces the first.
+        auto setters = entry->style.Setters();
+        for (uint32_t i = 0; i < setters.Size(); ++i) {
+            auto existing = setters.GetAt(i).try_as<Setter>();
+            if (existing && existing.Property() == dp) {
+                setters.RemoveAt(i);
+                break;
+            }
+        }
+        setters.Append(Setter(dp, style_setter_value(property, *value)));
         return 0;
     }
     catch (const hresult_error& e) {
@@ -1867,25 +2567,31 @@ int xaml_storyboard_add_animation(
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_storyboard_add_animation");
+        set_last_error(L"Unknown error in xaml_style_add_setter");
         return -1;
     }
 }
 
-int xaml_storyboard_add_color_animation(
-    XamlStoryboardHandle storyboard,
-    XamlColorAnimationHandle animation
-) {
-    if (!storyboard || !animation) {
-        set_last_error(L"Invalid storyboard or color animation handle");
+int xaml_element_set_style(XamlUIElementHandle element, XamlStyleHandle style) {
+    count_bridge_call();
+    if (!element) {
+        set_last_error(L"Invalid element handle");
         return -1;
     }
 
     try {
-        auto& sb_ptr = *reinterpret_cast<std::shared_ptr<Storyboard>*>(storyboard);
-        auto& anim_ptr = *reinterpret_cast<std::shared_ptr<ColorAnimation>*>(animation);
-
-        sb_ptr->Children().Append(*anim_ptr);
+        auto& elem_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(element);
+        auto framework_element = elem_ptr->as<FrameworkElement>();
+        if (!style) {
+            framework_element.ClearValue(FrameworkElement::StyleProperty());
+            return 0;
+        }
+        auto& entry = *reinterpret_cast<std::shared_ptr<SharedStyle>*>(style);
+        if (!element_matches_style(*elem_ptr, entry->target)) {
+            set_last_error(L"The element is not of the style's target type");
+            return -1;
+        }
+        framework_element.Style(entry->style);
         return 0;
     }
     catch (const hresult_error& e) {
@@ -1893,20 +2599,37 @@ int xaml_storyboard_add_color_animation(
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_storyboard_add_color_animation");
+        set_last_error(L"Unknown error in xaml_element_set_style");
         return -1;
     }
 }
 
-int xaml_storyboard_begin(XamlStoryboardHandle storyboard) {
-    if (!storyboard) {
-        set_last_error(L"Invalid storyboard handle");
+int xaml_apply_style(XamlStyleHandle style, const XamlUIElementHandle* elements, int count) {
+    count_bridge_call();
+    if (!style || (!elements && count > 0) || count < 0) {
+        set_last_error(L"Invalid style handle or element array");
         return -1;
     }
 
     try {
-        auto& sb_ptr = *reinterpret_cast<std::shared_ptr<Storyboard>*>(storyboard);
-        sb_ptr->Begin();
+        auto& entry = *reinterpret_cast<std::shared_ptr<SharedStyle>*>(style);
+        std::vector<FrameworkElement> targets;
+        targets.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            if (!elements[i]) {
+                set_last_error(L"Invalid element handle at index " + std::to_wstring(i));
+                return -1;
+            }
+            auto& elem_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(elements[i]);
+            if (!element_matches_style(*elem_ptr, entry->target)) {
+                set_last_error(L"Element " + std::to_wstring(i) + L" is not of the style's target type");
+                return -1;
+            }
+            targets.push_back(elem_ptr->as<FrameworkElement>());
+        }
+        for (auto& target : targets) {
+            target.Style(entry->style);
+        }
         return 0;
     }
     catch (const hresult_error& e) {
@@ -1914,41 +2637,408 @@ int xaml_storyboard_begin(XamlStoryboardHandle storyboard) {
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_storyboard_begin");
+        set_last_error(L"Unknown error in xaml_apply_style");
         return -1;
     }
 }
 
-int xaml_storyboard_stop(XamlStoryboardHandle storyboard) {
-    if (!storyboard) {
-        set_last_error(L"Invalid storyboard handle");
-        return -1;
-    }
+// ============================================================================
+// Animation System Implementation
+// ============================================================================
 
-    try {
-        auto& sb_ptr = *reinterpret_cast<std::shared_ptr<Storyboard>*>(storyboard);
-        sb_ptr->Stop();
-        return 0;
-    }
-    catch (const hresult_error& e) {
-        set_last_error(e.message().c_str());
-        return -1;
-    }
-    catch (...) {
-        set_last_error(L"Unknown error in xaml_storyboard_stop");
-        return -1;
+// Process-wide animation counters for xaml_animation_get_stats.
+std::atomic<uint64_t> g_composition_animations_started{0};
+std::atomic<uint64_t> g_storyboard_independent{0};
+std::atomic<uint64_t> g_storyboard_dependent{0};
+
+// Indices of the storyboard's children that XAML animates on the UI thread.
+std::vector<int> storyboard_dependent_animations(const Storyboard& storyboard) {
+    std::vector<int> dependent;
+    int index = 0;
+    for (const auto& timeline : storyboard.Children()) {
+        // Automatic resolves to one second for From/To animations.
+        double duration_ms = 1000.0;
+        const auto duration = timeline.Duration();
+        if (duration.Type == DurationType::TimeSpan) {
+            duration_ms = std::chrono::duration<double, std::milli>(duration.TimeSpan).count();
+        }
+        const hstring path = Storyboard::GetTargetProperty(timeline);
+        if (!xaml_bridge::is_independent_animation(to_u16string(path.c_str()), duration_ms)) {
+            dependent.push_back(index);
+        }
+        ++index;
     }
+    return dependent;
 }
 
-int xaml_storyboard_pause(XamlStoryboardHandle storyboard) {
-    if (!storyboard) {
-        set_last_error(L"Invalid storyboard handle");
-        return -1;
+// A Duration whose Type is TimeSpan; a default-constructed Duration is Automatic.
+Duration duration_from_ms(int milliseconds) {
+    return DurationHelper::FromTimeSpan(TimeSpan(std::chrono::milliseconds(milliseconds)));
+}
+
+// COM identity of a WinRT object; the same for every interface it implements.
+void* object_identity(const Windows::Foundation::IInspectable& object) {
+    return get_abi(object.as<Windows::Foundation::IUnknown>());
+}
+
+// Elements that bridge animations target, keyed by timeline identity.
+// Storyboard has no GetTarget, so this is how a running storyboard is traced
+// back to the island it animates.
+struct TimelineTarget {
+    weak_ref<Timeline> timeline;
+    weak_ref<UIElement> target;
+};
+
+std::mutex g_timeline_target_mutex;
+std::unordered_map<void*, TimelineTarget> g_timeline_targets;
+size_t g_timeline_target_sweep_at = 256;
+
+void set_animation_target(const Timeline& timeline, const UIElement& target) {
+    Storyboard::SetTarget(timeline, target);
+    std::lock_guard<std::mutex> lock(g_timeline_target_mutex);
+    if (g_timeline_targets.size() >= g_timeline_target_sweep_at) {
+        for (auto it = g_timeline_targets.begin(); it != g_timeline_targets.end();) {
+            it = it->second.timeline.get() ? std::next(it) : g_timeline_targets.erase(it);
+        }
+        g_timeline_target_sweep_at = std::max<size_t>(256, g_timeline_targets.size() * 2);
     }
+    g_timeline_targets[object_identity(timeline)] = {make_weak(timeline), make_weak(target)};
+}
 
-    try {
-        auto& sb_ptr = *reinterpret_cast<std::shared_ptr<Storyboard>*>(storyboard);
+// Identity of the XamlRoot of the first child whose target is in a live
+// tree, or null.
+void* storyboard_root(const Storyboard& storyboard) {
+    std::lock_guard<std::mutex> lock(g_timeline_target_mutex);
+    for (const auto& child : storyboard.Children()) {
+        auto it = g_timeline_targets.find(object_identity(child));
+        if (it == g_timeline_targets.end() || it->second.timeline.get() != child) {
+            continue;
+        }
+        if (auto target = it->second.target.get()) {
+            if (auto root = target.XamlRoot()) {
+                return object_identity(root);
+            }
+        }
+    }
+    return nullptr;
+}
+
+// Storyboards the bridge has begun or been asked to watch, keyed by ABI
+// pointer. An entry owns the storyboard's single Completed handler and lives
+// while the storyboard runs or has completion callbacks.
+struct StoryboardTracking {
+    weak_ref<Storyboard> owner;
+    event_token completed_token{};
+    std::vector<std::pair<void (*)(void*), void*>> on_completed;
+    bool running = false;
+    bool host_paused = false;    // xaml_storyboard_pause; hidden islands leave it paused
+    uint32_t animations = 0;
+    uint32_t dependent = 0;
+    void* root = nullptr;        // XamlRoot identity at the latest Begin
+};
+
+std::mutex g_storyboard_mutex;
+std::unordered_map<void*, StoryboardTracking> g_storyboard_tracking;
+size_t g_storyboard_sweep_at = 256;   // Guarded by g_storyboard_mutex
+uint64_t g_running_storyboards = 0;   // Guarded by g_storyboard_mutex
+uint64_t g_active_animations = 0;
+uint64_t g_active_dependent = 0;
+uint64_t g_active_animation_limit = 0; // 0 = unlimited
+std::atomic<uint64_t> g_storyboards_completed{0};
+
+void storyboard_completed(void* key);
+bool source_suspended_for_root(void* root, const Storyboard& storyboard, uint32_t animations);
+
+// Caller holds g_storyboard_mutex.
+void set_storyboard_running(StoryboardTracking& tracking, bool running) {
+    if (tracking.running == running) {
+        return;
+    }
+    tracking.running = running;
+    if (running) {
+        ++g_running_storyboards;
+        g_active_animations += tracking.animations;
+        g_active_dependent += tracking.dependent;
+    } else {
+        --g_running_storyboards;
+        g_active_animations -= tracking.animations;
+        g_active_dependent -= tracking.dependent;
+    }
+}
+
+// Entry for `storyboard`, subscribing to Completed on first use. A stale entry
+// left by a destroyed storyboard at the same address is replaced. Other dead
+// entries are swept once the map doubles, so tracking a burst of new
+// storyboards stays linear. Caller holds g_storyboard_mutex.
+StoryboardTracking& storyboard_tracking(const Storyboard& storyboard) {
+    void* key = get_abi(storyboard);
+    auto it = g_storyboard_tracking.find(key);
+    if (it != g_storyboard_tracking.end()) {
+        if (it->second.owner.get() == storyboard) {
+            return it->second;
+        }
+        set_storyboard_running(it->second, false);
+    }
+
+    if (g_storyboard_tracking.size() >= g_storyboard_sweep_at) {
+        for (auto dead = g_storyboard_tracking.begin(); dead != g_storyboard_tracking.end();) {
+            if (!dead->second.owner.get()) {
+                set_storyboard_running(dead->second, false);
+                dead = g_storyboard_tracking.erase(dead);
+            } else {
+                ++dead;
+            }
+        }
+        g_storyboard_sweep_at = std::max<size_t>(256, g_storyboard_tracking.size() * 2);
+    }
+
+    StoryboardTracking& tracking = g_storyboard_tracking[key];
+    tracking = StoryboardTracking{};
+    tracking.owner = make_weak(storyboard);
+    tracking.completed_token = storyboard.Completed([key](IInspectable const&, IInspectable const&) {
+        storyboard_completed(key);
+    });
+    return tracking;
+}
+
+// Existing entry for `storyboard`, or null. Caller holds g_storyboard_mutex.
+StoryboardTracking* find_storyboard_tracking(const Storyboard& storyboard) {
+    auto it = g_storyboard_tracking.find(get_abi(storyboard));
+    if (it == g_storyboard_tracking.end() || it->second.owner.get() != storyboard) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+// Caller holds g_storyboard_mutex. Returns the storyboard whose Completed
+// handler must be revoked once the lock is released, or null.
+Storyboard release_idle_tracking(void* key, event_token& token) {
+    auto it = g_storyboard_tracking.find(key);
+    if (it == g_storyboard_tracking.end() || it->second.running || !it->second.on_completed.empty()) {
+        return nullptr;
+    }
+    Storyboard storyboard = it->second.owner.get();
+    token = it->second.completed_token;
+    g_storyboard_tracking.erase(it);
+    return storyboard;
+}
+
+void storyboard_completed(void* key) {
+    std::vector<std::pair<void (*)(void*), void*>> callbacks;
+    event_token token{};
+    Storyboard idle{nullptr};
+    {
+        std::lock_guard<std::mutex> lock(g_storyboard_mutex);
+        auto it = g_storyboard_tracking.find(key);
+        if (it == g_storyboard_tracking.end()) {
+            return;
+        }
+        set_storyboard_running(it->second, false);
+        callbacks = it->second.on_completed;
+        idle = release_idle_tracking(key, token);
+    }
+    g_storyboards_completed.fetch_add(1, std::memory_order_relaxed);
+    if (idle) {
+        idle.Completed(token);
+    }
+    for (const auto& [callback, user_data] : callbacks) {
+        callback(user_data);
+    }
+}
+
+// Record that `storyboard` stopped without completing. Recycled storyboards
+// also drop their completion callbacks, which belonged to the previous user.
+void storyboard_stopped(const Storyboard& storyboard, bool drop_callbacks = false) {
+    event_token token{};
+    Storyboard idle{nullptr};
+    {
+        std::lock_guard<std::mutex> lock(g_storyboard_mutex);
+        auto it = g_storyboard_tracking.find(get_abi(storyboard));
+        if (it == g_storyboard_tracking.end()) {
+            return;
+        }
+        set_storyboard_running(it->second, false);
+        if (drop_callbacks) {
+            it->second.on_completed.clear();
+        }
+        idle = release_idle_tracking(it->first, token);
+    }
+    if (idle) {
+        idle.Completed(token);
+    }
+}
+
+XamlStoryboardHandle xaml_storyboard_create() {
+    count_bridge_call();
+    try {
+        auto storyboard = Storyboard();
+        auto* handle = new std::shared_ptr<Storyboard>(
+            std::make_shared<Storyboard>(storyboard)
+        );
+        return reinterpret_cast<XamlStoryboardHandle>(handle);
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return nullptr;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_storyboard_create");
+        return nullptr;
+    }
+}
+
+void xaml_storyboard_destroy(XamlStoryboardHandle storyboard) {
+    count_bridge_call();
+    if (storyboard) {
+        auto* ptr = reinterpret_cast<std::shared_ptr<Storyboard>*>(storyboard);
+        delete ptr;
+    }
+}
+
+int xaml_storyboard_add_animation(
+    XamlStoryboardHandle storyboard,
+    XamlDoubleAnimationHandle animation
+) {
+    count_bridge_call();
+    if (!storyboard || !animation) {
+        set_last_error(L"Invalid storyboard or animation handle");
+        return -1;
+    }
+
+    try {
+        auto& sb_ptr = *reinterpret_cast<std::shared_ptr<Storyboard>*>(storyboard);
+        auto& anim_ptr = *reinterpret_cast<std::shared_ptr<DoubleAnimation>*>(animation);
+
+        sb_ptr->Children().Append(*anim_ptr);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_storyboard_add_animation");
+        return -1;
+    }
+}
+
+int xaml_storyboard_add_color_animation(
+    XamlStoryboardHandle storyboard,
+    XamlColorAnimationHandle animation
+) {
+    count_bridge_call();
+    if (!storyboard || !animation) {
+        set_last_error(L"Invalid storyboard or color animation handle");
+        return -1;
+    }
+
+    try {
+        auto& sb_ptr = *reinterpret_cast<std::shared_ptr<Storyboard>*>(storyboard);
+        auto& anim_ptr = *reinterpret_cast<std::shared_ptr<ColorAnimation>*>(animation);
+
+        sb_ptr->Children().Append(*anim_ptr);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_storyboard_add_color_animation");
+        return -1;
+    }
+}
+
+int xaml_storyboard_begin(XamlStoryboardHandle storyboard) {
+    count_bridge_call();
+    if (!storyboard) {
+        set_last_error(L"Invalid storyboard handle");
+        return -1;
+    }
+
+    try {
+        auto& sb_ptr = *reinterpret_cast<std::shared_ptr<Storyboard>*>(storyboard);
+        const uint32_t total = sb_ptr->Children().Size();
+        const uint32_t dependent = static_cast<uint32_t>(storyboard_dependent_animations(*sb_ptr).size());
+        {
+            std::lock_guard<std::mutex> lock(g_storyboard_mutex);
+            // Looked up, not created: a rejected Begin must leave no entry.
+            const StoryboardTracking* tracking = find_storyboard_tracking(*sb_ptr);
+            // Restarting a running storyboard replaces its previous run.
+            const uint64_t others = g_active_animations - (tracking && tracking->running ? tracking->animations : 0);
+            if (g_active_animation_limit > 0 && others + total > g_active_animation_limit) {
+                set_last_error(L"Active animation limit reached");
+                return -1;
+            }
+        }
+        // Completed is raised from a later tick, so Begin runs unlocked.
+        sb_ptr->Begin();
+        void* root = storyboard_root(*sb_ptr);
+        {
+            std::lock_guard<std::mutex> lock(g_storyboard_mutex);
+            StoryboardTracking& tracking = storyboard_tracking(*sb_ptr);
+            set_storyboard_running(tracking, false);
+            tracking.animations = total;
+            tracking.dependent = dependent;
+            tracking.root = root;
+            tracking.host_paused = false;
+            set_storyboard_running(tracking, true);
+        }
+        // Storyboards begun inside a hidden island start paused.
+        if (root && source_suspended_for_root(root, *sb_ptr, total)) {
+            sb_ptr->Pause();
+        }
+        g_storyboard_dependent.fetch_add(dependent, std::memory_order_relaxed);
+        g_storyboard_independent.fetch_add(total - dependent, std::memory_order_relaxed);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_storyboard_begin");
+        return -1;
+    }
+}
+
+int xaml_storyboard_stop(XamlStoryboardHandle storyboard) {
+    count_bridge_call();
+    if (!storyboard) {
+        set_last_error(L"Invalid storyboard handle");
+        return -1;
+    }
+
+    try {
+        auto& sb_ptr = *reinterpret_cast<std::shared_ptr<Storyboard>*>(storyboard);
+        sb_ptr->Stop();
+        storyboard_stopped(*sb_ptr);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_storyboard_stop");
+        return -1;
+    }
+}
+
+int xaml_storyboard_pause(XamlStoryboardHandle storyboard) {
+    count_bridge_call();
+    if (!storyboard) {
+        set_last_error(L"Invalid storyboard handle");
+        return -1;
+    }
+
+    try {
+        auto& sb_ptr = *reinterpret_cast<std::shared_ptr<Storyboard>*>(storyboard);
         sb_ptr->Pause();
+        std::lock_guard<std::mutex> lock(g_storyboard_mutex);
+        if (StoryboardTracking* tracking = find_storyboard_tracking(*sb_ptr)) {
+            tracking->host_paused = true;
+        }
         return 0;
     }
     catch (const hresult_error& e) {
@@ -1962,6 +3052,7 @@ int xaml_storyboard_pause(XamlStoryboardHandle storyboard) {
 }
 
 int xaml_storyboard_resume(XamlStoryboardHandle storyboard) {
+    count_bridge_call();
     if (!storyboard) {
         set_last_error(L"Invalid storyboard handle");
         return -1;
@@ -1969,7 +3060,20 @@ int xaml_storyboard_resume(XamlStoryboardHandle storyboard) {
 
     try {
         auto& sb_ptr = *reinterpret_cast<std::shared_ptr<Storyboard>*>(storyboard);
-        sb_ptr->Resume();
+        void* root = nullptr;
+        uint32_t animations = 0;
+        {
+            std::lock_guard<std::mutex> lock(g_storyboard_mutex);
+            if (StoryboardTracking* tracking = find_storyboard_tracking(*sb_ptr)) {
+                tracking->host_paused = false;
+                root = tracking->running ? tracking->root : nullptr;
+                animations = tracking->animations;
+            }
+        }
+        // Inside a hidden island it stays paused until the island is shown.
+        if (!root || !source_suspended_for_root(root, *sb_ptr, animations)) {
+            sb_ptr->Resume();
+        }
         return 0;
     }
     catch (const hresult_error& e) {
@@ -1986,6 +3090,7 @@ int xaml_storyboard_set_target(
     XamlStoryboardHandle storyboard,
     XamlUIElementHandle target
 ) {
+    count_bridge_call();
     if (!storyboard || !target) {
         set_last_error(L"Invalid storyboard or target handle");
         return -1;
@@ -1997,7 +3102,7 @@ int xaml_storyboard_set_target(
 
         // Set target for all animations in the storyboard
         for (auto& timeline : sb_ptr->Children()) {
-            Storyboard::SetTarget(timeline, *target_ptr);
+            set_animation_target(timeline, *target_ptr);
         }
         return 0;
     }
@@ -2011,7 +3116,35 @@ int xaml_storyboard_set_target(
     }
 }
 
+int xaml_storyboard_on_completed(
+    XamlStoryboardHandle storyboard,
+    void (*callback)(void* user_data),
+    void* user_data
+) {
+    count_bridge_call();
+    if (!storyboard || !callback) {
+        set_last_error(L"Invalid storyboard or callback");
+        return -1;
+    }
+
+    try {
+        auto& sb_ptr = *reinterpret_cast<std::shared_ptr<Storyboard>*>(storyboard);
+        std::lock_guard<std::mutex> lock(g_storyboard_mutex);
+        storyboard_tracking(*sb_ptr).on_completed.emplace_back(callback, user_data);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_storyboard_on_completed");
+        return -1;
+    }
+}
+
 XamlDoubleAnimationHandle xaml_double_animation_create() {
+    count_bridge_call();
     try {
         auto animation = DoubleAnimation();
         auto* handle = new std::shared_ptr<DoubleAnimation>(
@@ -2030,6 +3163,7 @@ XamlDoubleAnimationHandle xaml_double_animation_create() {
 }
 
 void xaml_double_animation_destroy(XamlDoubleAnimationHandle animation) {
+    count_bridge_call();
     if (animation) {
         auto* ptr = reinterpret_cast<std::shared_ptr<DoubleAnimation>*>(animation);
         delete ptr;
@@ -2037,6 +3171,7 @@ void xaml_double_animation_destroy(XamlDoubleAnimationHandle animation) {
 }
 
 int xaml_double_animation_set_from(XamlDoubleAnimationHandle animation, double from) {
+    count_bridge_call();
     if (!animation) {
         set_last_error(L"Invalid animation handle");
         return -1;
@@ -2058,6 +3193,7 @@ int xaml_double_animation_set_from(XamlDoubleAnimationHandle animation, double f
 }
 
 int xaml_double_animation_set_to(XamlDoubleAnimationHandle animation, double to) {
+    count_bridge_call();
     if (!animation) {
         set_last_error(L"Invalid animation handle");
         return -1;
@@ -2079,6 +3215,7 @@ int xaml_double_animation_set_to(XamlDoubleAnimationHandle animation, double to)
 }
 
 int xaml_double_animation_set_duration(XamlDoubleAnimationHandle animation, int milliseconds) {
+    count_bridge_call();
     if (!animation) {
         set_last_error(L"Invalid animation handle");
         return -1;
@@ -2086,9 +3223,7 @@ int xaml_double_animation_set_duration(XamlDoubleAnimationHandle animation, int
 
     try {
         auto& anim_ptr = *reinterpret_cast<std::shared_ptr<DoubleAnimation>*>(animation);
-        Duration duration;
-        duration.TimeSpan = TimeSpan(std::chrono::milliseconds(milliseconds));
-        anim_ptr->Duration(duration);
+        anim_ptr->Duration(duration_from_ms(milliseconds));
         return 0;
     }
     catch (const hresult_error& e) {
@@ -2106,6 +3241,7 @@ int xaml_double_animation_set_target_property(
     XamlUIElementHandle target,
     const wchar_t* property_path
 ) {
+    count_bridge_call();
     if (!animation || !target || !property_path) {
         set_last_error(L"Invalid animation, target, or property path");
         return -1;
@@ -2115,7 +3251,7 @@ int xaml_double_animation_set_target_property(
         auto& anim_ptr = *reinterpret_cast<std::shared_ptr<DoubleAnimation>*>(animation);
         auto& target_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(target);
 
-        Storyboard::SetTarget(*anim_ptr, *target_ptr);
+        set_animation_target(*anim_ptr, *target_ptr);
         Storyboard::SetTargetProperty(*anim_ptr, hstring(property_path));
         return 0;
     }
@@ -2130,6 +3266,7 @@ int xaml_double_animation_set_target_property(
 }
 
 XamlColorAnimationHandle xaml_color_animation_create() {
+    count_bridge_call();
     try {
         auto animation = ColorAnimation();
         auto* handle = new std::shared_ptr<ColorAnimation>(
@@ -2148,6 +3285,7 @@ XamlColorAnimationHandle xaml_color_animation_create() {
 }
 
 void xaml_color_animation_destroy(XamlColorAnimationHandle animation) {
+    count_bridge_call();
     if (animation) {
         auto* ptr = reinterpret_cast<std::shared_ptr<ColorAnimation>*>(animation);
         delete ptr;
@@ -2155,6 +3293,7 @@ void xaml_color_animation_destroy(XamlColorAnimationHandle animation) {
 }
 
 int xaml_color_animation_set_from(XamlColorAnimationHandle animation, unsigned int from) {
+    count_bridge_call();
     if (!animation) {
         set_last_error(L"Invalid animation handle");
         return -1;
@@ -2182,6 +3321,7 @@ int xaml_color_animation_set_from(XamlColorAnimationHandle animation, unsigned i
 }
 
 int xaml_color_animation_set_to(XamlColorAnimationHandle animation, unsigned int to) {
+    count_bridge_call();
     if (!animation) {
         set_last_error(L"Invalid animation handle");
         return -1;
@@ -2209,6 +3349,7 @@ int xaml_color_animation_set_to(XamlColorAnimationHandle animation, unsigned int
 }
 
 int xaml_color_animation_set_duration(XamlColorAnimationHandle animation, int milliseconds) {
+    count_bridge_call();
     if (!animation) {
         set_last_error(L"Invalid animation handle");
         return -1;
@@ -2216,9 +3357,7 @@ int xaml_color_animation_set_duration(XamlColorAnimationHandle animation, int mi
 
     try {
         auto& anim_ptr = *reinterpret_cast<std::shared_ptr<ColorAnimation>*>(animation);
-        Duration duration;
-        duration.TimeSpan = TimeSpan(std::chrono::milliseconds(milliseconds));
-        anim_ptr->Duration(duration);
+        anim_ptr->Duration(duration_from_ms(milliseconds));
         return 0;
     }
     catch (const hresult_error& e) {
@@ -2236,6 +3375,7 @@ int xaml_color_animation_set_target_property(
     XamlUIElementHandle target,
     const wchar_t* property_path
 ) {
+    count_bridge_call();
     if (!animation || !target || !property_path) {
         set_last_error(L"Invalid animation, target, or property path");
         return -1;
@@ -2245,7 +3385,7 @@ int xaml_color_animation_set_target_property(
         auto& anim_ptr = *reinterpret_cast<std::shared_ptr<ColorAnimation>*>(animation);
         auto& target_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(target);
 
-        Storyboard::SetTarget(*anim_ptr, *target_ptr);
+        set_animation_target(*anim_ptr, *target_ptr);
         Storyboard::SetTargetProperty(*anim_ptr, hstring(property_path));
         return 0;
     }
@@ -2259,44 +3399,182 @@ int xaml_color_animation_set_target_property(
     }
 }
 
-// ============================================================================
-// RadioButton Implementation
-// ============================================================================
+// ----- Keyframe animations -----
 
-XamlRadioButtonHandle xaml_radiobutton_create() {
+KeyTime key_time(float milliseconds) {
+    return KeyTimeHelper::FromTimeSpan(
+        std::chrono::duration_cast<TimeSpan>(std::chrono::duration<double, std::milli>(milliseconds)));
+}
+
+KeySpline make_key_spline(const xaml_bridge::KeySplinePoints& points) {
+    KeySpline spline;
+    spline.ControlPoint1(Point{points.x1, points.y1});
+    spline.ControlPoint2(Point{points.x2, points.y2});
+    return spline;
+}
+
+// XAML easing function for an eased XamlKeyFrameKind. Keyframe animations only
+// need it for the kinds a KeySpline cannot express.
+EasingFunctionBase make_easing(uint8_t kind) {
+    EasingFunctionBase easing{nullptr};
+    switch (xaml_bridge::easing_family(kind)) {
+    case xaml_bridge::EasingFamily::Sine: easing = SineEase(); break;
+    case xaml_bridge::EasingFamily::Quad: easing = QuadraticEase(); break;
+    case xaml_bridge::EasingFamily::Cubic: easing = CubicEase(); break;
+    case xaml_bridge::EasingFamily::Quart: easing = QuarticEase(); break;
+    case xaml_bridge::EasingFamily::Quint: easing = QuinticEase(); break;
+    case xaml_bridge::EasingFamily::Expo: {
+        // e^(6.93t) tracks the 2^(10t - 10) curve the keyframe splines fit.
+        ExponentialEase exponential;
+        exponential.Exponent(6.93);
+        easing = exponential;
+        break;
+    }
+    case xaml_bridge::EasingFamily::Circ: easing = CircleEase(); break;
+    case xaml_bridge::EasingFamily::Back: easing = BackEase(); break;
+    case xaml_bridge::EasingFamily::Elastic: easing = ElasticEase(); break;
+    default: easing = BounceEase(); break;
+    }
+    switch (xaml_bridge::easing_mode(kind)) {
+    case xaml_bridge::EasingMode::In: easing.EasingMode(EasingMode::EaseIn); break;
+    case xaml_bridge::EasingMode::Out: easing.EasingMode(EasingMode::EaseOut); break;
+    default: easing.EasingMode(EasingMode::EaseInOut); break;
+    }
+    return easing;
+}
+
+// Build the XAML keyframe for one planned key; Frame is DoubleKeyFrame or ColorKeyFrame.
+template <class Frame, class LinearFrame, class DiscreteFrame, class SplineFrame, class EasingFrame, class Value>
+Frame make_keyframe(const xaml_bridge::PlannedKeyFrame& planned, const Value& value) {
+    Frame frame{nullptr};
+    switch (planned.type) {
+    case xaml_bridge::KeyFrameType::Linear:
+        frame = LinearFrame();
+        break;
+    case xaml_bridge::KeyFrameType::Discrete:
+        frame = DiscreteFrame();
+        break;
+    case xaml_bridge::KeyFrameType::Spline: {
+        SplineFrame spline_frame;
+        spline_frame.KeySpline(make_key_spline(planned.spline));
+        frame = spline_frame;
+        break;
+    }
+    case xaml_bridge::KeyFrameType::Eased: {
+        EasingFrame easing_frame;
+        easing_frame.EasingFunction(make_easing(planned.kind));
+        frame = easing_frame;
+        break;
+    }
+    }
+    frame.KeyTime(key_time(planned.time_ms));
+    frame.Value(value);
+    return frame;
+}
+
+uint8_t color_channel(float value) {
+    return static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 255.0f)));
+}
+
+XamlKeyFrameAnimationHandle xaml_double_keyframe_animation_create() {
+    count_bridge_call();
     try {
-        auto radiobutton = RadioButton();
-        auto* handle = new std::shared_ptr<RadioButton>(
-            std::make_shared<RadioButton>(radiobutton)
+        auto animation = DoubleAnimationUsingKeyFrames();
+        auto* handle = new std::shared_ptr<Timeline>(
+            std::make_shared<Timeline>(animation)
         );
-        return reinterpret_cast<XamlRadioButtonHandle>(handle);
+        return reinterpret_cast<XamlKeyFrameAnimationHandle>(handle);
     }
     catch (const hresult_error& e) {
         set_last_error(e.message().c_str());
         return nullptr;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_radiobutton_create");
+        set_last_error(L"Unknown error in xaml_double_keyframe_animation_create");
         return nullptr;
     }
 }
 
-void xaml_radiobutton_destroy(XamlRadioButtonHandle radiobutton) {
-    if (radiobutton) {
-        auto* ptr = reinterpret_cast<std::shared_ptr<RadioButton>*>(radiobutton);
+XamlKeyFrameAnimationHandle xaml_color_keyframe_animation_create() {
+    count_bridge_call();
+    try {
+        auto animation = ColorAnimationUsingKeyFrames();
+        auto* handle = new std::shared_ptr<Timeline>(
+            std::make_shared<Timeline>(animation)
+        );
+        return reinterpret_cast<XamlKeyFrameAnimationHandle>(handle);
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return nullptr;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_color_keyframe_animation_create");
+        return nullptr;
+    }
+}
+
+void xaml_keyframe_animation_destroy(XamlKeyFrameAnimationHandle animation) {
+    count_bridge_call();
+    if (animation) {
+        auto* ptr = reinterpret_cast<std::shared_ptr<Timeline>*>(animation);
         delete ptr;
     }
 }
 
-int xaml_radiobutton_set_content(XamlRadioButtonHandle radiobutton, const wchar_t* content) {
-    if (!radiobutton || !content) {
-        set_last_error(L"Invalid handle or content");
+int xaml_keyframes_set(
+    XamlKeyFrameAnimationHandle animation,
+    const float* times,
+    const float* values,
+    const uint8_t* kinds,
+    int count
+) {
+    count_bridge_call();
+    if (!animation || count < 0 || (count > 0 && (!times || !values))) {
+        set_last_error(L"Invalid keyframe animation handle or keyframe arrays");
         return -1;
     }
+    for (int i = 0; i < count; ++i) {
+        if (!std::isfinite(times[i]) || times[i] < 0.0f) {
+            set_last_error(L"Keyframe times must be finite and non-negative");
+            return -1;
+        }
+        if (kinds && kinds[i] >= xaml_bridge::kKeyFrameKindCount) {
+            set_last_error(L"Unknown keyframe kind");
+            return -1;
+        }
+    }
 
     try {
-        auto& rb_ptr = *reinterpret_cast<std::shared_ptr<RadioButton>*>(radiobutton);
-        rb_ptr->Content(box_value(hstring(content)));
+        auto& timeline = *reinterpret_cast<std::shared_ptr<Timeline>*>(animation);
+        const auto double_animation = timeline->try_as<DoubleAnimationUsingKeyFrames>();
+        const size_t components = double_animation ? 1 : 4;
+        if (!std::all_of(values, values + static_cast<size_t>(count) * components,
+                [](float value) { return std::isfinite(value); })) {
+            set_last_error(L"Keyframe values must be finite");
+            return -1;
+        }
+
+        const auto planned = xaml_bridge::plan_keyframes(times, values, kinds, static_cast<size_t>(count), components);
+        if (double_animation) {
+            std::vector<DoubleKeyFrame> frames;
+            frames.reserve(planned.size());
+            for (const auto& key : planned) {
+                frames.push_back(make_keyframe<DoubleKeyFrame, LinearDoubleKeyFrame, DiscreteDoubleKeyFrame,
+                    SplineDoubleKeyFrame, EasingDoubleKeyFrame>(key, static_cast<double>(key.value[0])));
+            }
+            double_animation.KeyFrames().ReplaceAll(frames);
+        } else {
+            std::vector<ColorKeyFrame> frames;
+            frames.reserve(planned.size());
+            for (const auto& key : planned) {
+                const Color color{color_channel(key.value[0]), color_channel(key.value[1]),
+                    color_channel(key.value[2]), color_channel(key.value[3])};
+                frames.push_back(make_keyframe<ColorKeyFrame, LinearColorKeyFrame, DiscreteColorKeyFrame,
+                    SplineColorKeyFrame, EasingColorKeyFrame>(key, color));
+            }
+            timeline->as<ColorAnimationUsingKeyFrames>().KeyFrames().ReplaceAll(frames);
+        }
         return 0;
     }
     catch (const hresult_error& e) {
@@ -2304,20 +3582,28 @@ int xaml_radiobutton_set_content(XamlRadioButtonHandle radiobutton, const wchar_
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_radiobutton_set_content");
+        set_last_error(L"Unknown error in xaml_keyframes_set");
         return -1;
     }
 }
 
-int xaml_radiobutton_set_is_checked(XamlRadioButtonHandle radiobutton, int is_checked) {
-    if (!radiobutton) {
-        set_last_error(L"Invalid handle");
+int xaml_keyframe_animation_set_target_property(
+    XamlKeyFrameAnimationHandle animation,
+    XamlUIElementHandle target,
+    const wchar_t* property_path
+) {
+    count_bridge_call();
+    if (!animation || !target || !property_path) {
+        set_last_error(L"Invalid animation, target, or property path");
         return -1;
     }
 
     try {
-        auto& rb_ptr = *reinterpret_cast<std::shared_ptr<RadioButton>*>(radiobutton);
-        rb_ptr->IsChecked(is_checked != 0);
+        auto& anim_ptr = *reinterpret_cast<std::shared_ptr<Timeline>*>(animation);
+        auto& target_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(target);
+
+        set_animation_target(*anim_ptr, *target_ptr);
+        Storyboard::SetTargetProperty(*anim_ptr, hstring(property_path));
         return 0;
     }
     catch (const hresult_error& e) {
@@ -2325,35 +3611,2377 @@ int xaml_radiobutton_set_is_checked(XamlRadioButtonHandle radiobutton, int is_ch
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_radiobutton_set_is_checked");
+        set_last_error(L"Unknown error in xaml_keyframe_animation_set_target_property");
         return -1;
     }
 }
 
-int xaml_radiobutton_get_is_checked(XamlRadioButtonHandle radiobutton) {
+int xaml_storyboard_add_keyframe_animation(
+    XamlStoryboardHandle storyboard,
+    XamlKeyFrameAnimationHandle animation
+) {
+    count_bridge_call();
+    if (!storyboard || !animation) {
+        set_last_error(L"Invalid storyboard or keyframe animation handle");
+        return -1;
+    }
+
+    try {
+        auto& sb_ptr = *reinterpret_cast<std::shared_ptr<Storyboard>*>(storyboard);
+        auto& anim_ptr = *reinterpret_cast<std::shared_ptr<Timeline>*>(animation);
+
+        sb_ptr->Children().Append(*anim_ptr);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_storyboard_add_keyframe_animation");
+        return -1;
+    }
+}
+
+// ----- Storyboard templates -----
+
+// Recycled storyboards kept per template.
+constexpr size_t kStoryboardPoolLimit = 32;
+
+struct StoryboardTemplate {
+    std::vector<XamlAnimSpec> specs;   // property_path is unused; see paths
+    std::vector<hstring> paths;
+    std::vector<Storyboard> pool;
+    // Storyboards instantiated and not yet recycled, keyed by identity; only
+    // these are accepted back. The weak reference rejects a foreign storyboard
+    // that reuses a destroyed instance's address.
+    std::unordered_map<void*, weak_ref<Storyboard>> live;
+    size_t live_sweep_at = 64;
+};
+
+Color color_from_argb(uint32_t argb) {
+    return Color{
+        static_cast<uint8_t>(argb >> 24), static_cast<uint8_t>(argb >> 16),
+        static_cast<uint8_t>(argb >> 8), static_cast<uint8_t>(argb)};
+}
+
+// Check an animation spec; returns an error message or nullptr.
+const wchar_t* validate_anim_spec(const XamlAnimSpec& spec) {
+    if (spec.kind != XAML_ANIM_DOUBLE && spec.kind != XAML_ANIM_COLOR) {
+        return L"Unknown animation kind";
+    }
+    if (!spec.property_path) {
+        return L"Animation spec needs a property path";
+    }
+    if (spec.duration_ms < 0 || spec.begin_ms < 0) {
+        return L"Animation duration and begin time must be non-negative";
+    }
+    if (spec.easing < 0 || spec.easing >= xaml_bridge::kKeyFrameKindCount || spec.easing == XAML_KEYFRAME_DISCRETE) {
+        return L"Invalid animation easing";
+    }
+    if (spec.kind == XAML_ANIM_DOUBLE && (!std::isfinite(spec.to) || !std::isfinite(spec.from))) {
+        return L"Animation values must be finite";
+    }
+    return nullptr;
+}
+
+Timeline make_spec_timeline(const XamlAnimSpec& spec, const hstring& path) {
+    Timeline timeline{nullptr};
+    if (spec.kind == XAML_ANIM_COLOR) {
+        ColorAnimation animation;
+        if (spec.flags & XAML_ANIM_HAS_FROM) {
+            animation.From(color_from_argb(spec.from_color));
+        }
+        animation.To(color_from_argb(spec.to_color));
+        if (spec.easing != XAML_KEYFRAME_LINEAR) {
+            animation.EasingFunction(make_easing(static_cast<uint8_t>(spec.easing)));
+        }
+        timeline = animation;
+    } else {
+        DoubleAnimation animation;
+        if (spec.flags & XAML_ANIM_HAS_FROM) {
+            animation.From(spec.from);
+        }
+        animation.To(spec.to);
+        if (spec.easing != XAML_KEYFRAME_LINEAR) {
+            animation.EasingFunction(make_easing(static_cast<uint8_t>(spec.easing)));
+        }
+        timeline = animation;
+    }
+    timeline.Duration(duration_from_ms(spec.duration_ms));
+    timeline.BeginTime(IReference<TimeSpan>(TimeSpan(std::chrono::milliseconds(spec.begin_ms))));
+    Storyboard::SetTargetProperty(timeline, path);
+    return timeline;
+}
+
+XamlStoryboardTemplateHandle xaml_storyboard_template_create(const XamlAnimSpec* animations, int count) {
+    count_bridge_call();
+    if (!animations || count <= 0) {
+        set_last_error(L"A storyboard template needs at least one animation");
+        return nullptr;
+    }
+    for (int i = 0; i < count; ++i) {
+        if (const wchar_t* error = validate_anim_spec(animations[i])) {
+            set_last_error(error);
+            return nullptr;
+        }
+    }
+
+    try {
+        auto tpl = std::make_shared<StoryboardTemplate>();
+        tpl->specs.assign(animations, animations + count);
+        for (auto& spec : tpl->specs) {
+            tpl->paths.emplace_back(spec.property_path);
+            spec.property_path = nullptr;
+        }
+        auto* handle = new std::shared_ptr<StoryboardTemplate>(std::move(tpl));
+        return reinterpret_cast<XamlStoryboardTemplateHandle>(handle);
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return nullptr;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_storyboard_template_create");
+        return nullptr;
+    }
+}
+
+void xaml_storyboard_template_destroy(XamlStoryboardTemplateHandle template_handle) {
+    count_bridge_call();
+    if (template_handle) {
+        auto* ptr = reinterpret_cast<std::shared_ptr<StoryboardTemplate>*>(template_handle);
+        delete ptr;
+    }
+}
+
+XamlStoryboardHandle xaml_storyboard_instantiate(
+    XamlStoryboardTemplateHandle template_handle,
+    XamlUIElementHandle target
+) {
+    count_bridge_call();
+    if (!template_handle || !target) {
+        set_last_error(L"Invalid storyboard template or target handle");
+        return nullptr;
+    }
+
+    try {
+        auto& tpl = *reinterpret_cast<std::shared_ptr<StoryboardTemplate>*>(template_handle);
+        auto& target_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(target);
+
+        Storyboard storyboard{nullptr};
+        if (!tpl->pool.empty()) {
+            storyboard = std::move(tpl->pool.back());
+            tpl->pool.pop_back();
+        } else {
+            std::vector<Timeline> children;
+            children.reserve(tpl->specs.size());
+            for (size_t i = 0; i < tpl->specs.size(); ++i) {
+                children.push_back(make_spec_timeline(tpl->specs[i], tpl->paths[i]));
+            }
+            storyboard = Storyboard();
+            storyboard.Children().ReplaceAll(children);
+        }
+        for (const auto& timeline : storyboard.Children()) {
+            set_animation_target(timeline, *target_ptr);
+        }
+
+        // Drop instances the host destroyed instead of recycling.
+        if (tpl->live.size() >= tpl->live_sweep_at) {
+            for (auto it = tpl->live.begin(); it != tpl->live.end();) {
+                it = it->second.get() ? std::next(it) : tpl->live.erase(it);
+            }
+            tpl->live_sweep_at = std::max<size_t>(64, tpl->live.size() * 2);
+        }
+        tpl->live[object_identity(storyboard)] = make_weak(storyboard);
+
+        auto* handle = new std::shared_ptr<Storyboard>(
+            std::make_shared<Storyboard>(storyboard)
+        );
+        return reinterpret_cast<XamlStoryboardHandle>(handle);
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return nullptr;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_storyboard_instantiate");
+        return nullptr;
+    }
+}
+
+int xaml_storyboard_template_recycle(
+    XamlStoryboardTemplateHandle template_handle,
+    XamlStoryboardHandle storyboard
+) {
+    count_bridge_call();
+    if (!template_handle || !storyboard) {
+        set_last_error(L"Invalid storyboard template or storyboard handle");
+        return -1;
+    }
+
+    try {
+        auto& tpl = *reinterpret_cast<std::shared_ptr<StoryboardTemplate>*>(template_handle);
+        auto* sb_handle = reinterpret_cast<std::shared_ptr<Storyboard>*>(storyboard);
+        Storyboard instance = **sb_handle;
+        auto live = tpl->live.find(object_identity(instance));
+        if (live == tpl->live.end() || live->second.get() != instance) {
+            set_last_error(L"Storyboard was not created from this template");
+            return -1;
+        }
+        tpl->live.erase(live);
+
+        // Keeps its last target alive until the next instantiate retargets it.
+        instance.Stop();
+        storyboard_stopped(instance, true);
+        delete sb_handle;
+        if (tpl->pool.size() < kStoryboardPoolLimit) {
+            tpl->pool.push_back(std::move(instance));
+        }
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_storyboard_template_recycle");
+        return -1;
+    }
+}
+
+int xaml_storyboard_template_pooled_count(XamlStoryboardTemplateHandle template_handle) {
+    count_bridge_call();
+    if (!template_handle) {
+        set_last_error(L"Invalid storyboard template handle");
+        return -1;
+    }
+    auto& tpl = *reinterpret_cast<std::shared_ptr<StoryboardTemplate>*>(template_handle);
+    return static_cast<int>(tpl->pool.size());
+}
+
+// Latest start offset of a staggered batch: `base_ms` for the last target.
+int64_t last_stagger_offset(int64_t base_ms, int target_count, int stagger_ms) {
+    return base_ms + static_cast<int64_t>(target_count - 1) * stagger_ms;
+}
+
+XamlStoryboardHandle xaml_animate_staggered(
+    const XamlUIElementHandle* targets,
+    int target_count,
+    const XamlAnimSpec* animations,
+    int animation_count,
+    int stagger_ms
+) {
+    count_bridge_call();
+    if (!targets || target_count <= 0 || !animations || animation_count <= 0 || stagger_ms < 0) {
+        set_last_error(L"Staggered animation needs targets, animations and a non-negative stagger");
+        return nullptr;
+    }
+    for (int i = 0; i < target_count; ++i) {
+        if (!targets[i]) {
+            set_last_error(L"Invalid target handle");
+            return nullptr;
+        }
+    }
+    for (int j = 0; j < animation_count; ++j) {
+        if (const wchar_t* error = validate_anim_spec(animations[j])) {
+            set_last_error(error);
+            return nullptr;
+        }
+        if (last_stagger_offset(animations[j].begin_ms, target_count, stagger_ms) > INT_MAX) {
+            set_last_error(L"Staggered begin time is out of range");
+            return nullptr;
+        }
+    }
+
+    try {
+        std::vector<hstring> paths;
+        paths.reserve(animation_count);
+        for (int j = 0; j < animation_count; ++j) {
+            paths.emplace_back(animations[j].property_path);
+        }
+
+        std::vector<Timeline> children;
+        children.reserve(static_cast<size_t>(target_count) * animation_count);
+        for (int i = 0; i < target_count; ++i) {
+            auto& target_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(targets[i]);
+            for (int j = 0; j < animation_count; ++j) {
+                XamlAnimSpec spec = animations[j];
+                spec.begin_ms += i * stagger_ms;
+                Timeline timeline = make_spec_timeline(spec, paths[j]);
+                set_animation_target(timeline, *target_ptr);
+                children.push_back(std::move(timeline));
+            }
+        }
+
+        auto storyboard = Storyboard();
+        storyboard.Children().ReplaceAll(children);
+        auto* handle = new std::shared_ptr<Storyboard>(
+            std::make_shared<Storyboard>(storyboard)
+        );
+        return reinterpret_cast<XamlStoryboardHandle>(handle);
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return nullptr;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_animate_staggered");
+        return nullptr;
+    }
+}
+
+int xaml_storyboard_get_dependent_animations(
+    XamlStoryboardHandle storyboard,
+    int* out_indices,
+    int capacity
+) {
+    count_bridge_call();
+    if (!storyboard || capacity < 0 || (capacity > 0 && !out_indices)) {
+        set_last_error(L"Invalid storyboard handle or output buffer");
+        return -1;
+    }
+
+    try {
+        auto& sb_ptr = *reinterpret_cast<std::shared_ptr<Storyboard>*>(storyboard);
+        const auto dependent = storyboard_dependent_animations(*sb_ptr);
+        const size_t copied = std::min(dependent.size(), static_cast<size_t>(capacity));
+        std::copy_n(dependent.begin(), copied, out_indices);
+        return static_cast<int>(dependent.size());
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_storyboard_get_dependent_animations");
+        return -1;
+    }
+}
+
+// ============================================================================
+// String Table Implementation
+// ============================================================================
+
+std::mutex g_string_table_mutex;
+std::shared_ptr<const xaml_bridge::StringTable> g_string_table;
+std::atomic<uint64_t> g_string_table_generation{0};
+std::atomic<uint64_t> g_string_cache_hits{0};
+std::atomic<uint64_t> g_string_cache_misses{0};
+
+// One table string as XAML takes it. Every Button showing the id shares the
+// boxed value as its Content.
+struct CachedString {
+    hstring text;
+    Windows::Foundation::IInspectable boxed{nullptr};
+};
+
+// A UI thread's view of the active table. It holds the table it was filled
+// from, so the old mapping stays valid until the thread notices a switch.
+struct StringTableCache {
+    uint64_t generation = 0;
+    std::shared_ptr<const xaml_bridge::StringTable> table;
+    std::unordered_map<uint32_t, CachedString> strings;
+};
+
+thread_local StringTableCache g_string_cache;
+
+// Elements this thread labelled by id, keyed by object identity.
+struct LabelBinding {
+    weak_ref<DependencyObject> element;
+    uint32_t id = 0;
+};
+
+thread_local std::unordered_map<void*, LabelBinding> g_label_bindings;
+thread_local size_t g_label_binding_sweep_at = 256;
+
+// The cached string for `id`, or nullptr when no table is loaded or the id
+// has no string.
+CachedString* cached_string(uint32_t id) {
+    StringTableCache& cache = g_string_cache;
+    if (cache.generation != g_string_table_generation.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(g_string_table_mutex);
+        cache.table = g_string_table;
+        cache.generation = g_string_table_generation.load(std::memory_order_relaxed);
+        cache.strings.clear();
+    }
+    if (!cache.table) {
+        return nullptr;
+    }
+    auto it = cache.strings.find(id);
+    if (it != cache.strings.end()) {
+        g_string_cache_hits.fetch_add(1, std::memory_order_relaxed);
+        return &it->second;
+    }
+    if (!cache.table->contains(id)) {
+        return nullptr;
+    }
+    g_string_cache_misses.fetch_add(1, std::memory_order_relaxed);
+    const std::u16string_view text = cache.table->get(id);
+    CachedString entry;
+    entry.text = hstring(std::wstring_view(reinterpret_cast<const wchar_t*>(text.data()), text.size()));
+    return &cache.strings.emplace(id, std::move(entry)).first->second;
+}
+
+void apply_label(const DependencyObject& element, CachedString& label) {
+    if (auto button = element.try_as<Button>()) {
+        if (!label.boxed) {
+            label.boxed = box_value(label.text);
+        }
+        button.Content(label.boxed);
+    } else if (auto textblock = element.try_as<TextBlock>()) {
+        textblock.Text(label.text);
+    }
+}
+
+void forget_label_binding(const Windows::Foundation::IInspectable& element) {
+    if (!g_label_bindings.empty()) {
+        g_label_bindings.erase(object_identity(element));
+    }
+}
+
+int set_label_id(const DependencyObject& element, uint32_t id) {
+    CachedString* label = cached_string(id);
+    if (!label) {
+        set_last_error(g_string_cache.table ? L"String id " + std::to_wstring(id) + L" is not in the string table"
+                                            : std::wstring(L"No string table is loaded"));
+        return -1;
+    }
+    apply_label(element, *label);
+
+    if (g_label_bindings.size() >= g_label_binding_sweep_at) {
+        for (auto it = g_label_bindings.begin(); it != g_label_bindings.end();) {
+            it = it->second.element.get() ? std::next(it) : g_label_bindings.erase(it);
+        }
+        g_label_binding_sweep_at = std::max<size_t>(256, g_label_bindings.size() * 2);
+    }
+    g_label_bindings[object_identity(element)] = LabelBinding{make_weak(element), id};
+    return 0;
+}
+
+// Relabel this thread's live elements from the active table. Ids missing
+// from the new table keep their old text.
+void relabel_bound_elements() {
+    for (auto it = g_label_bindings.begin(); it != g_label_bindings.end();) {
+        DependencyObject element = it->second.element.get();
+        if (!element) {
+            it = g_label_bindings.erase(it);
+            continue;
+        }
+        if (CachedString* label = cached_string(it->second.id)) {
+            apply_label(element, *label);
+        }
+        ++it;
+    }
+}
+
+void publish_string_table(std::shared_ptr<const xaml_bridge::StringTable> table) {
+    std::lock_guard<std::mutex> lock(g_string_table_mutex);
+    g_string_table = std::move(table);
+    g_string_table_generation.fetch_add(1, std::memory_order_release);
+}
+
+int xaml_string_table_load(const wchar_t* path) {
+    count_bridge_call();
+    if (!path) {
+        set_last_error(L"Invalid string table path");
+        return -1;
+    }
+
+    try {
+        auto table = std::make_shared<xaml_bridge::StringTable>();
+        std::string error;
+        if (!table->open(path, error)) {
+            set_last_error(L"Cannot load string table: " + std::wstring(error.begin(), error.end()));
+            return -1;
+        }
+        publish_string_table(std::move(table));
+        relabel_bound_elements();
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_string_table_load");
+        return -1;
+    }
+}
+
+int xaml_string_table_unload() {
+    count_bridge_call();
+    // Labelled elements keep their text; *_id calls fail until the next load.
+    publish_string_table(nullptr);
+    return 0;
+}
+
+int xaml_string_table_get_info(XamlStringTableInfo* info_out) {
+    count_bridge_call();
+    if (!info_out) {
+        set_last_error(L"Invalid string table info pointer");
+        return -1;
+    }
+
+    *info_out = XamlStringTableInfo{};
+    {
+        std::lock_guard<std::mutex> lock(g_string_table_mutex);
+        info_out->generation = g_string_table_generation.load(std::memory_order_relaxed);
+        if (g_string_table) {
+            info_out->count = g_string_table->size();
+            const std::u16string_view locale = g_string_table->locale();
+            const size_t copied = std::min(locale.size(), std::size(info_out->locale) - 1);
+            std::copy_n(locale.begin(), copied, info_out->locale);
+        }
+    }
+    info_out->bound_elements = static_cast<uint32_t>(g_label_bindings.size());
+    info_out->cache_hits = g_string_cache_hits.load(std::memory_order_relaxed);
+    info_out->cache_misses = g_string_cache_misses.load(std::memory_order_relaxed);
+    return 0;
+}
+
+int xaml_button_set_content_id(XamlButtonHandle button, uint32_t id) {
+    count_bridge_call();
+    if (!button) {
+        set_last_error(L"Invalid button handle");
+        return -1;
+    }
+
+    try {
+        auto& btn = *reinterpret_cast<std::shared_ptr<Button>*>(button);
+        return set_label_id(*btn, id);
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_button_set_content_id");
+        return -1;
+    }
+}
+
+int xaml_textblock_set_text_id(XamlTextBlockHandle textblock, uint32_t id) {
+    count_bridge_call();
+    if (!textblock) {
+        set_last_error(L"Invalid textblock");
+        return -1;
+    }
+
+    try {
+        forget_number_text(textblock);
+        auto& tb = *reinterpret_cast<std::shared_ptr<TextBlock>*>(textblock);
+        return set_label_id(*tb, id);
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_textblock_set_text_id");
+        return -1;
+    }
+}
+
+// ============================================================================
+// Composition Animation Implementation
+// ============================================================================
+
+using Windows::Foundation::Numerics::float3;
+
+const wchar_t* const kClipInsets[] = {L"LeftInset", L"TopInset", L"RightInset", L"BottomInset"};
+
+// Visual property animated for each XamlVisualProperty other than CLIP.
+const wchar_t* visual_property_name(int property) {
+    switch (property) {
+    case XAML_VISUAL_OFFSET: return L"Translation";
+    case XAML_VISUAL_SCALE: return L"Scale";
+    case XAML_VISUAL_OPACITY: return L"Opacity";
+    case XAML_VISUAL_ROTATION: return L"RotationAngleInDegrees";
+    default: return nullptr;
+    }
+}
+
+void configure_keyframe_animation(const Composition::KeyFrameAnimation& animation, const XamlVisualAnimation& spec) {
+    // The compositor rejects durations below one millisecond.
+    animation.Duration(std::chrono::milliseconds(std::max(spec.duration_ms, 1)));
+    animation.DelayTime(std::chrono::milliseconds(spec.delay_ms));
+    if (spec.iterations <= 0) {
+        animation.IterationBehavior(Composition::AnimationIterationBehavior::Forever);
+    } else {
+        animation.IterationCount(spec.iterations);
+    }
+}
+
+Composition::ScalarKeyFrameAnimation make_scalar_animation(
+    const Composition::Compositor& compositor,
+    const XamlVisualAnimation& spec,
+    int component
+) {
+    auto animation = compositor.CreateScalarKeyFrameAnimation();
+    for (int i = 0; i < spec.keyframe_count; ++i) {
+        animation.InsertKeyFrame(spec.keyframes[i].progress, spec.keyframes[i].value[component]);
+    }
+    configure_keyframe_animation(animation, spec);
+    return animation;
+}
+
+// Scale and rotation pivot around the element's current center.
+void center_visual(const Composition::Visual& visual, const UIElement& element) {
+    if (auto framework_element = element.try_as<FrameworkElement>()) {
+        visual.CenterPoint(float3{
+            static_cast<float>(framework_element.ActualWidth() / 2),
+            static_cast<float>(framework_element.ActualHeight() / 2),
+            0.0f});
+    }
+}
+
+// Check a composition animation; returns an error message or nullptr.
+const wchar_t* validate_visual_animation(const XamlVisualAnimation& spec) {
+    if (spec.property < XAML_VISUAL_OFFSET || spec.property > XAML_VISUAL_CLIP) {
+        return L"Unknown visual property";
+    }
+    if (!spec.keyframes || spec.keyframe_count <= 0 || spec.duration_ms < 0 || spec.delay_ms < 0) {
+        return L"Animation needs keyframes and a non-negative duration and delay";
+    }
+    for (int i = 0; i < spec.keyframe_count; ++i) {
+        const float progress = spec.keyframes[i].progress;
+        if (!(progress >= 0.0f && progress <= 1.0f)) {
+            return L"Keyframe progress must be between 0 and 1";
+        }
+    }
+    return nullptr;
+}
+
+// Start a validated composition animation on the element's visual.
+void start_visual_animation(const UIElement& element, const XamlVisualAnimation& spec) {
+    auto visual = ElementCompositionPreview::GetElementVisual(element);
+    auto compositor = visual.Compositor();
+
+    switch (spec.property) {
+    case XAML_VISUAL_OFFSET:
+    case XAML_VISUAL_SCALE: {
+        auto vector_animation = compositor.CreateVector3KeyFrameAnimation();
+        for (int i = 0; i < spec.keyframe_count; ++i) {
+            const auto& frame = spec.keyframes[i];
+            vector_animation.InsertKeyFrame(frame.progress, float3{frame.value[0], frame.value[1], frame.value[2]});
+        }
+        configure_keyframe_animation(vector_animation, spec);
+        if (spec.property == XAML_VISUAL_OFFSET) {
+            ElementCompositionPreview::SetIsTranslationEnabled(element, true);
+        } else {
+            center_visual(visual, element);
+        }
+        visual.StartAnimation(visual_property_name(spec.property), vector_animation);
+        break;
+    }
+    case XAML_VISUAL_OPACITY:
+    case XAML_VISUAL_ROTATION:
+        if (spec.property == XAML_VISUAL_ROTATION) {
+            center_visual(visual, element);
+        }
+        visual.StartAnimation(visual_property_name(spec.property), make_scalar_animation(compositor, spec, 0));
+        break;
+    case XAML_VISUAL_CLIP: {
+        auto clip = visual.Clip().try_as<Composition::InsetClip>();
+        if (!clip) {
+            clip = compositor.CreateInsetClip();
+            visual.Clip(clip);
+        }
+        for (int side = 0; side < 4; ++side) {
+            clip.StartAnimation(kClipInsets[side], make_scalar_animation(compositor, spec, side));
+        }
+        break;
+    }
+    }
+    g_composition_animations_started.fetch_add(1, std::memory_order_relaxed);
+}
+
+int xaml_element_start_animation(XamlUIElementHandle element, const XamlVisualAnimation* animation) {
+    count_bridge_call();
+    if (!element || !animation) {
+        set_last_error(L"Invalid element or animation");
+        return -1;
+    }
+    if (const wchar_t* error = validate_visual_animation(*animation)) {
+        set_last_error(error);
+        return -1;
+    }
+
+    try {
+        auto& element_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(element);
+        start_visual_animation(*element_ptr, *animation);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_element_start_animation");
+        return -1;
+    }
+}
+
+int xaml_element_stop_animation(XamlUIElementHandle element, int property) {
+    count_bridge_call();
+    if (!element) {
+        set_last_error(L"Invalid element handle");
+        return -1;
+    }
+    if (property < XAML_VISUAL_OFFSET || property > XAML_VISUAL_CLIP) {
+        set_last_error(L"Unknown visual property");
+        return -1;
+    }
+
+    try {
+        auto& element_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(element);
+        auto visual = ElementCompositionPreview::GetElementVisual(*element_ptr);
+        if (property == XAML_VISUAL_CLIP) {
+            if (auto clip = visual.Clip().try_as<Composition::InsetClip>()) {
+                for (const wchar_t* inset : kClipInsets) {
+                    clip.StopAnimation(inset);
+                }
+            }
+        } else {
+            visual.StopAnimation(visual_property_name(property));
+        }
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_element_stop_animation");
+        return -1;
+    }
+}
+
+int xaml_element_animate_staggered(
+    const XamlUIElementHandle* elements,
+    int element_count,
+    const XamlVisualAnimation* animation,
+    int stagger_ms
+) {
+    count_bridge_call();
+    if (!elements || element_count <= 0 || !animation || stagger_ms < 0) {
+        set_last_error(L"Staggered animation needs elements, an animation and a non-negative stagger");
+        return -1;
+    }
+    if (const wchar_t* error = validate_visual_animation(*animation)) {
+        set_last_error(error);
+        return -1;
+    }
+    if (last_stagger_offset(animation->delay_ms, element_count, stagger_ms) > INT_MAX) {
+        set_last_error(L"Staggered delay is out of range");
+        return -1;
+    }
+    for (int i = 0; i < element_count; ++i) {
+        if (!elements[i]) {
+            set_last_error(L"Invalid element handle");
+            return -1;
+        }
+    }
+
+    try {
+        XamlVisualAnimation spec = *animation;
+        for (int i = 0; i < element_count; ++i) {
+            auto& element_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(elements[i]);
+            spec.delay_ms = animation->delay_ms + i * stagger_ms;
+            start_visual_animation(*element_ptr, spec);
+        }
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_element_animate_staggered");
+        return -1;
+    }
+}
+
+int xaml_bind_scroll_expression(
+    XamlScrollViewerHandle scrollviewer,
+    XamlUIElementHandle target,
+    int property,
+    const wchar_t* expression
+) {
+    count_bridge_call();
+    if (!scrollviewer || !target || !expression || !*expression) {
+        set_last_error(L"Invalid scroll viewer, target or expression");
+        return -1;
+    }
+    if (property < XAML_VISUAL_OFFSET || property >= XAML_VISUAL_CLIP) {
+        set_last_error(L"Scroll expressions support offset, scale, opacity and rotation");
+        return -1;
+    }
+
+    try {
+        auto& sv_ptr = *reinterpret_cast<std::shared_ptr<ScrollViewer>*>(scrollviewer);
+        auto& target_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(target);
+        auto scroll = ElementCompositionPreview::GetScrollViewerManipulationPropertySet(*sv_ptr);
+        auto visual = ElementCompositionPreview::GetElementVisual(*target_ptr);
+
+        auto animation = visual.Compositor().CreateExpressionAnimation(expression);
+        animation.SetReferenceParameter(L"scroll", scroll);
+        if (property == XAML_VISUAL_OFFSET) {
+            ElementCompositionPreview::SetIsTranslationEnabled(*target_ptr, true);
+        } else if (property != XAML_VISUAL_OPACITY) {
+            center_visual(visual, *target_ptr);
+        }
+        visual.StartAnimation(visual_property_name(property), animation);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_bind_scroll_expression");
+        return -1;
+    }
+}
+
+constexpr int kImplicitAnimationFlags = XAML_IMPLICIT_OFFSET | XAML_IMPLICIT_SIZE | XAML_IMPLICIT_SHOW | XAML_IMPLICIT_HIDE;
+constexpr int kDefaultImplicitDurationMs = 250;
+
+// Opacity fade for ElementCompositionPreview's show and hide triggers.
+Composition::ScalarKeyFrameAnimation make_fade_animation(
+    const Composition::Compositor& compositor,
+    float from,
+    float to,
+    TimeSpan duration
+) {
+    auto animation = compositor.CreateScalarKeyFrameAnimation();
+    animation.Target(L"Opacity");
+    animation.InsertKeyFrame(0.0f, from);
+    animation.InsertKeyFrame(1.0f, to);
+    animation.Duration(duration);
+    return animation;
+}
+
+int xaml_element_set_implicit_animations(XamlUIElementHandle element, int flags, int duration_ms) {
+    count_bridge_call();
+    if (!element) {
+        set_last_error(L"Invalid element handle");
+        return -1;
+    }
+    if (flags & ~kImplicitAnimationFlags) {
+        set_last_error(L"Unknown implicit animation flags");
+        return -1;
+    }
+
+    try {
+        auto& element_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(element);
+        auto visual = ElementCompositionPreview::GetElementVisual(*element_ptr);
+        auto compositor = visual.Compositor();
+        const TimeSpan duration = std::chrono::milliseconds(
+            duration_ms > 0 ? duration_ms : kDefaultImplicitDurationMs);
+
+        // Layout writes the visual's Offset and Size; "this.FinalValue" is the
+        // value it just wrote, so each change animates from the old one.
+        if (flags & (XAML_IMPLICIT_OFFSET | XAML_IMPLICIT_SIZE)) {
+            auto implicit = compositor.CreateImplicitAnimationCollection();
+            if (flags & XAML_IMPLICIT_OFFSET) {
+                auto offset = compositor.CreateVector3KeyFrameAnimation();
+                offset.Target(L"Offset");
+                offset.InsertExpressionKeyFrame(1.0f, L"this.FinalValue");
+                offset.Duration(duration);
+                implicit.Insert(L"Offset", offset);
+            }
+            if (flags & XAML_IMPLICIT_SIZE) {
+                auto size = compositor.CreateVector2KeyFrameAnimation();
+                size.Target(L"Size");
+                size.InsertExpressionKeyFrame(1.0f, L"this.FinalValue");
+                size.Duration(duration);
+                implicit.Insert(L"Size", size);
+            }
+            visual.ImplicitAnimations(implicit);
+        } else {
+            visual.ImplicitAnimations(nullptr);
+        }
+
+        Composition::ICompositionAnimationBase show{nullptr};
+        Composition::ICompositionAnimationBase hide{nullptr};
+        if (flags & XAML_IMPLICIT_SHOW) {
+            show = make_fade_animation(compositor, 0.0f, 1.0f, duration);
+        }
+        if (flags & XAML_IMPLICIT_HIDE) {
+            hide = make_fade_animation(compositor, 1.0f, 0.0f, duration);
+        }
+        ElementCompositionPreview::SetImplicitShowAnimation(*element_ptr, show);
+        ElementCompositionPreview::SetImplicitHideAnimation(*element_ptr, hide);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_element_set_implicit_animations");
+        return -1;
+    }
+}
+
+int xaml_animation_get_stats(XamlAnimationStats* stats) {
+    count_bridge_call();
+    if (!stats) {
+        set_last_error(L"Invalid stats pointer");
+        return -1;
+    }
+    stats->composition_started = g_composition_animations_started.load(std::memory_order_relaxed);
+    stats->storyboard_independent = g_storyboard_independent.load(std::memory_order_relaxed);
+    stats->storyboard_dependent = g_storyboard_dependent.load(std::memory_order_relaxed);
+    stats->storyboards_completed = g_storyboards_completed.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(g_storyboard_mutex);
+    stats->running_storyboards = g_running_storyboards;
+    stats->active_animations = g_active_animations;
+    stats->active_dependent = g_active_dependent;
+    return 0;
+}
+
+int xaml_animation_set_active_limit(int max_active_animations) {
+    count_bridge_call();
+    if (max_active_animations < 0) {
+        set_last_error(L"Active animation limit must not be negative");
+        return -1;
+    }
+    std::lock_guard<std::mutex> lock(g_storyboard_mutex);
+    g_active_animation_limit = static_cast<uint64_t>(max_active_animations);
+    return 0;
+}
+
+// ============================================================================
+// Island Activity Implementation
+// ============================================================================
+
+// Frame pacing for one source. Readers on other threads only touch stats.
+struct FrameRecorder {
+    xaml_bridge::FrameStats stats;
+    int64_t last_render_ticks = 0;     // RenderingTime of the previous frame, 0 if none
+    uint64_t last_bridge_calls = 0;
+    bool suspended = false;            // Hidden sources record nothing
+};
+
+// Per-source visibility, keyed by source ABI pointer. While a source is
+// hidden its running storyboards are paused and its indeterminate progress
+// bars are switched off; showing it restores both.
+struct SourceActivity {
+    weak_ref<DesktopWindowXamlSource> source;
+    void* watched_root = nullptr;      // XamlRoot whose Changed event is hooked
+    weak_ref<XamlRoot> root;
+    event_token root_changed_token{};
+    weak_ref<FrameworkElement> content;
+    event_token loaded_token{};
+    bool host_visible = true;          // XamlRoot.IsHostVisible
+    bool requested_visible = true;     // xaml_source_set_visible
+    bool suspended = false;
+    void* suspended_root = nullptr;
+    std::vector<weak_ref<Storyboard>> paused_storyboards;
+    std::vector<weak_ref<ProgressBar>> paused_progress;
+    uint64_t paused_animations = 0;
+    std::chrono::steady_clock::time_point suspended_at;
+    uint64_t suspensions = 0;
+    uint64_t hidden_ms = 0;
+    uint64_t suspended_animation_ms = 0;
+    std::shared_ptr<FrameRecorder> frames;   // Set once frame stats are enabled
+    event_token rendering_token{};
+};
+
+std::mutex g_source_mutex;
+std::unordered_map<void*, SourceActivity> g_source_activity;
+
+void update_source_activity(void* key);
+
+// Caller holds g_source_mutex.
+SourceActivity* find_source_activity(void* key) {
+    auto it = g_source_activity.find(key);
+    return it == g_source_activity.end() ? nullptr : &it->second;
+}
+
+// Revoke every event handler the entry installed. Caller holds g_source_mutex.
+void unhook_source_activity(SourceActivity& activity) {
+    if (activity.rendering_token) {
+        CompositionTarget::Rendering(activity.rendering_token);
+    }
+    if (auto root = activity.root.get(); root && activity.root_changed_token) {
+        root.Changed(activity.root_changed_token);
+    }
+    if (auto content = activity.content.get(); content && activity.loaded_token) {
+        content.Loaded(activity.loaded_token);
+    }
+}
+
+// Drops the entry and its handlers when the source is destroyed, so a new
+// source at the same address sees none of the old root's events.
+void release_source_activity(void* key) {
+    std::lock_guard<std::mutex> lock(g_source_mutex);
+    auto it = g_source_activity.find(key);
+    if (it == g_source_activity.end()) {
+        return;
+    }
+    unhook_source_activity(it->second);
+    g_source_activity.erase(it);
+}
+
+// Caller holds g_source_mutex. A new source at a recycled ABI pointer starts
+// from a clean entry.
+SourceActivity& source_activity_for(void* key, const DesktopWindowXamlSource& source) {
+    SourceActivity& activity = g_source_activity[key];
+    if (activity.source.get() != source) {
+        unhook_source_activity(activity);
+        activity = SourceActivity{};
+        activity.source = make_weak(source);
+    }
+    return activity;
+}
+
+void collect_indeterminate_progress(const DependencyObject& node, std::vector<ProgressBar>& bars) {
+    if (auto bar = node.try_as<ProgressBar>()) {
+        if (bar.IsIndeterminate()) {
+            bars.push_back(bar);
+        }
+        return;
+    }
+    const int32_t count = VisualTreeHelper::GetChildrenCount(node);
+    for (int32_t i = 0; i < count; ++i) {
+        collect_indeterminate_progress(VisualTreeHelper::GetChild(node, i), bars);
+    }
+}
+
+void forget_paused_progress(const ProgressBar& bar) {
+    std::lock_guard<std::mutex> lock(g_source_mutex);
+    for (auto& [key, activity] : g_source_activity) {
+        auto& paused = activity.paused_progress;
+        paused.erase(std::remove_if(paused.begin(), paused.end(), [&](const weak_ref<ProgressBar>& weak) {
+            return weak.get() == bar;
+        }), paused.end());
+    }
+}
+
+// Record `storyboard` as paused by the hidden island at `root`, if any.
+bool source_suspended_for_root(void* root, const Storyboard& storyboard, uint32_t animations) {
+    std::lock_guard<std::mutex> lock(g_source_mutex);
+    for (auto& [key, activity] : g_source_activity) {
+        if (activity.suspended && activity.suspended_root == root) {
+            for (const auto& paused : activity.paused_storyboards) {
+                if (paused.get() == storyboard) {
+                    return true;
+                }
+            }
+            activity.paused_storyboards.push_back(make_weak(storyboard));
+            activity.paused_animations += animations;
+            return true;
+        }
+    }
+    return false;
+}
+
+void suspend_source(void* key, const DesktopWindowXamlSource& source) {
+    auto content = source.Content();
+    XamlRoot root{nullptr};
+    if (content) {
+        root = content.XamlRoot();
+    }
+    void* root_id = root ? object_identity(root) : nullptr;
+
+    std::vector<Storyboard> storyboards;
+    uint64_t animations = 0;
+    if (root_id) {
+        std::lock_guard<std::mutex> lock(g_storyboard_mutex);
+        for (const auto& [sb_key, tracking] : g_storyboard_tracking) {
+            // Storyboards the host paused stay paused and are not resumed.
+            if (tracking.running && !tracking.host_paused && tracking.root == root_id) {
+                if (auto storyboard = tracking.owner.get()) {
+                    storyboards.push_back(storyboard);
+                    animations += tracking.animations;
+                }
+            }
+        }
+    }
+    std::vector<ProgressBar> bars;
+    if (content) {
+        collect_indeterminate_progress(content, bars);
+    }
+
+    for (auto& storyboard : storyboards) {
+        storyboard.Pause();
+    }
+    for (auto& bar : bars) {
+        bar.IsIndeterminate(false);
+    }
+
+    std::lock_guard<std::mutex> lock(g_source_mutex);
+    SourceActivity* activity = find_source_activity(key);
+    if (!activity) {
+        return;
+    }
+    activity->suspended = true;
+    activity->suspended_root = root_id;
+    activity->suspended_at = std::chrono::steady_clock::now();
+    activity->paused_animations = animations;
+    ++activity->suspensions;
+    if (activity->frames) {
+        activity->frames->suspended = true;
+    }
+    for (auto& storyboard : storyboards) {
+        activity->paused_storyboards.push_back(make_weak(storyboard));
+    }
+    for (auto& bar : bars) {
+        activity->paused_progress.push_back(make_weak(bar));
+    }
+}
+
+void resume_source(void* key) {
+    std::vector<weak_ref<Storyboard>> storyboards;
+    std::vector<weak_ref<ProgressBar>> bars;
+    {
+        std::lock_guard<std::mutex> lock(g_source_mutex);
+        SourceActivity* activity = find_source_activity(key);
+        if (!activity) {
+            return;
+        }
+        const auto hidden = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - activity->suspended_at).count();
+        activity->hidden_ms += hidden;
+        activity->suspended_animation_ms += hidden * activity->paused_animations;
+        activity->suspended = false;
+        activity->suspended_root = nullptr;
+        activity->paused_animations = 0;
+        if (activity->frames) {
+            activity->frames->suspended = false;
+        }
+        storyboards.swap(activity->paused_storyboards);
+        bars.swap(activity->paused_progress);
+    }
+    // Storyboards stopped while hidden ignore Resume; those the host paused
+    // while hidden are left alone.
+    std::vector<Storyboard> resumed;
+    {
+        std::lock_guard<std::mutex> lock(g_storyboard_mutex);
+        for (auto& weak : storyboards) {
+            if (auto storyboard = weak.get()) {
+                const StoryboardTracking* tracking = find_storyboard_tracking(storyboard);
+                if (!tracking || !tracking->host_paused) {
+                    resumed.push_back(storyboard);
+                }
+            }
+        }
+    }
+    for (auto& storyboard : resumed) {
+        storyboard.Resume();
+    }
+    // Bars the host set while hidden were dropped from the list.
+    for (auto& weak : bars) {
+        if (auto bar = weak.get(); bar && !bar.IsIndeterminate()) {
+            bar.IsIndeterminate(true);
+        }
+    }
+}
+
+void update_source_activity(void* key) {
+    DesktopWindowXamlSource source{nullptr};
+    bool suspend = false;
+    bool resume = false;
+    {
+        std::lock_guard<std::mutex> lock(g_source_mutex);
+        SourceActivity* activity = find_source_activity(key);
+        if (!activity) {
+            return;
+        }
+        source = activity->source.get();
+        const bool visible = activity->host_visible && activity->requested_visible;
+        suspend = source && !visible && !activity->suspended;
+        resume = visible && activity->suspended;
+    }
+    if (suspend) {
+        suspend_source(key, source);
+    } else if (resume) {
+        resume_source(key);
+    }
+}
+
+// Follow XamlRoot.IsHostVisible for the source's content. The content only
+// gets a XamlRoot once it is loaded, so the hook is attached from Loaded too.
+void watch_source_activity(const DesktopWindowXamlSource& source) {
+    void* key = get_abi(source);
+    {
+        std::lock_guard<std::mutex> lock(g_source_mutex);
+        source_activity_for(key, source);
+    }
+
+    auto hook_root = [key](const XamlRoot& root) {
+        if (!root) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(g_source_mutex);
+            SourceActivity* activity = find_source_activity(key);
+            if (!activity || activity->watched_root == object_identity(root)) {
+                return;
+            }
+            if (auto previous = activity->root.get(); previous && activity->root_changed_token) {
+                previous.Changed(activity->root_changed_token);
+            }
+            activity->watched_root = object_identity(root);
+            activity->root = make_weak(root);
+            activity->host_visible = root.IsHostVisible();
+            activity->root_changed_token = root.Changed([key](const XamlRoot& changed, const XamlRootChangedEventArgs&) {
+                {
+                    std::lock_guard<std::mutex> lock(g_source_mutex);
+                    SourceActivity* activity = find_source_activity(key);
+                    if (!activity) {
+                        return;
+                    }
+                    activity->host_visible = changed.IsHostVisible();
+                }
+                update_source_activity(key);
+            });
+        }
+        update_source_activity(key);
+    };
+
+    auto content = source.Content();
+    if (!content) {
+        return;
+    }
+    hook_root(content.XamlRoot());
+    if (auto element = content.try_as<FrameworkElement>()) {
+        auto token = element.Loaded([hook_root](const IInspectable& sender, const RoutedEventArgs&) {
+            hook_root(sender.as<UIElement>().XamlRoot());
+        });
+        std::lock_guard<std::mutex> lock(g_source_mutex);
+        if (SourceActivity* activity = find_source_activity(key)) {
+            if (auto previous = activity->content.get(); previous && activity->loaded_token) {
+                previous.Loaded(activity->loaded_token);
+            }
+            activity->content = make_weak(element);
+            activity->loaded_token = token;
+        }
+    }
+}
+
+int xaml_source_set_visible(XamlSourceHandle source, int visible) {
+    count_bridge_call();
+    if (!source) {
+        set_last_error(L"Invalid source handle");
+        return -1;
+    }
+
+    try {
+        auto& src_ptr = *reinterpret_cast<std::shared_ptr<DesktopWindowXamlSource>*>(source);
+        void* key = get_abi(*src_ptr);
+        {
+            std::lock_guard<std::mutex> lock(g_source_mutex);
+            source_activity_for(key, *src_ptr).requested_visible = visible != 0;
+        }
+        update_source_activity(key);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_source_set_visible");
+        return -1;
+    }
+}
+
+int xaml_source_get_activity(XamlSourceHandle source, XamlSourceActivity* activity_out) {
+    count_bridge_call();
+    if (!source || !activity_out) {
+        set_last_error(L"Invalid source handle or activity pointer");
+        return -1;
+    }
+
+    auto& src_ptr = *reinterpret_cast<std::shared_ptr<DesktopWindowXamlSource>*>(source);
+    *activity_out = XamlSourceActivity{};
+    activity_out->visible = 1;
+    std::lock_guard<std::mutex> lock(g_source_mutex);
+    const SourceActivity* activity = find_source_activity(get_abi(*src_ptr));
+    if (!activity) {
+        return 0;
+    }
+    uint64_t hidden_ms = activity->hidden_ms;
+    uint64_t suspended_animation_ms = activity->suspended_animation_ms;
+    if (activity->suspended) {
+        const auto hidden = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - activity->suspended_at).count();
+        hidden_ms += hidden;
+        suspended_animation_ms += hidden * activity->paused_animations;
+    }
+    activity_out->visible = activity->host_visible && activity->requested_visible ? 1 : 0;
+    activity_out->suspended = activity->suspended ? 1 : 0;
+    activity_out->paused_storyboards = static_cast<uint32_t>(activity->paused_storyboards.size());
+    activity_out->paused_progress_bars = static_cast<uint32_t>(activity->paused_progress.size());
+    activity_out->suspensions = activity->suspensions;
+    activity_out->hidden_ms = hidden_ms;
+    activity_out->suspended_animation_ms = suspended_animation_ms;
+    return 0;
+}
+
+void record_frame(FrameRecorder& recorder, TimeSpan rendering_time) {
+    // Rendering can fire more than once per frame; RenderingTime tells the
+    // duplicates apart.
+    const int64_t ticks = rendering_time.count();
+    if (recorder.suspended) {
+        recorder.last_render_ticks = 0;
+        return;
+    }
+    if (ticks == recorder.last_render_ticks) {
+        return;
+    }
+    const uint64_t calls = g_bridge_calls;
+    if (recorder.last_render_ticks != 0 && ticks > recorder.last_render_ticks) {
+        recorder.stats.record((ticks - recorder.last_render_ticks) / 10000.0, calls - recorder.last_bridge_calls);
+    }
+    recorder.last_render_ticks = ticks;
+    recorder.last_bridge_calls = calls;
+}
+
+int xaml_source_enable_frame_stats(XamlSourceHandle source, int enabled) {
+    count_bridge_call();
+    if (!source) {
+        set_last_error(L"Invalid source handle");
+        return -1;
+    }
+
+    try {
+        auto& src_ptr = *reinterpret_cast<std::shared_ptr<DesktopWindowXamlSource>*>(source);
+        std::lock_guard<std::mutex> lock(g_source_mutex);
+        SourceActivity& activity = source_activity_for(get_abi(*src_ptr), *src_ptr);
+        if (activity.rendering_token) {
+            CompositionTarget::Rendering(activity.rendering_token);
+            activity.rendering_token = {};
+        }
+        // Disabling keeps the last stats readable.
+        if (enabled) {
+            auto recorder = std::make_shared<FrameRecorder>();
+            recorder->suspended = activity.suspended;
+            recorder->last_bridge_calls = g_bridge_calls;
+            activity.frames = recorder;
+            activity.rendering_token = CompositionTarget::Rendering(
+                [recorder](const IInspectable&, const IInspectable& args) {
+                    record_frame(*recorder, args.as<RenderingEventArgs>().RenderingTime());
+                });
+        }
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_source_enable_frame_stats");
+        return -1;
+    }
+}
+
+int xaml_source_get_frame_stats(XamlSourceHandle source, XamlFrameStats* stats_out) {
+    count_bridge_call();
+    if (!source || !stats_out) {
+        set_last_error(L"Invalid source handle or stats pointer");
+        return -1;
+    }
+
+    auto& src_ptr = *reinterpret_cast<std::shared_ptr<DesktopWindowXamlSource>*>(source);
+    *stats_out = XamlFrameStats{};
+    std::shared_ptr<FrameRecorder> recorder;
+    {
+        std::lock_guard<std::mutex> lock(g_source_mutex);
+        const SourceActivity* activity = find_source_activity(get_abi(*src_ptr));
+        if (activity) {
+            recorder = activity->frames;
+        }
+    }
+    if (!recorder) {
+        return 0;
+    }
+    const xaml_bridge::FrameStatsSnapshot snapshot = recorder->stats.snapshot();
+    static_assert(XAML_FRAME_INTERVAL_BUCKETS == xaml_bridge::kFrameIntervalBuckets, "interval buckets");
+    static_assert(XAML_FRAME_WORK_BUCKETS == xaml_bridge::kFrameWorkBuckets, "work buckets");
+    stats_out->frames = snapshot.frames;
+    stats_out->missed_frames = snapshot.missed_frames;
+    stats_out->bridge_calls = snapshot.total_work;
+    stats_out->refresh_ms = snapshot.refresh_ms;
+    stats_out->mean_interval_ms = snapshot.mean_interval_ms;
+    stats_out->max_interval_ms = snapshot.max_interval_ms;
+    std::copy(snapshot.interval_buckets.begin(), snapshot.interval_buckets.end(), stats_out->interval_buckets);
+    std::copy(snapshot.work_buckets.begin(), snapshot.work_buckets.end(), stats_out->work_buckets);
+    return 0;
+}
+
+// ============================================================================
+// RadioButton Implementation
+// ============================================================================
+
+XamlRadioButtonHandle xaml_radiobutton_create() {
+    count_bridge_call();
+    try {
+        auto radiobutton = RadioButton();
+        auto* handle = new std::shared_ptr<RadioButton>(
+            std::make_shared<RadioButton>(radiobutton)
+        );
+        return reinterpret_cast<XamlRadioButtonHandle>(handle);
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return nullptr;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_radiobutton_create");
+        return nullptr;
+    }
+}
+
+void xaml_radiobutton_destroy(XamlRadioButtonHandle radiobutton) {
+    count_bridge_call();
+    if (radiobutton) {
+        auto* ptr = reinterpret_cast<std::shared_ptr<RadioButton>*>(radiobutton);
+        delete ptr;
+    }
+}
+
+int xaml_radiobutton_set_content(XamlRadioButtonHandle radiobutton, const wchar_t* content) {
+    count_bridge_call();
+    if (!radiobutton || !content) {
+        set_last_error(L"Invalid handle or content");
+        return -1;
+    }
+
+    try {
+        auto& rb_ptr = *reinterpret_cast<std::shared_ptr<RadioButton>*>(radiobutton);
+        rb_ptr->Content(box_value(hstring(content)));
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_radiobutton_set_content");
+        return -1;
+    }
+}
+
+int xaml_radiobutton_set_is_checked(XamlRadioButtonHandle radiobutton, int is_checked) {
+    count_bridge_call();
     if (!radiobutton) {
+        set_last_error(L"Invalid handle");
+        return -1;
+    }
+
+    try {
+        auto& rb_ptr = *reinterpret_cast<std::shared_ptr<RadioButton>*>(radiobutton);
+        rb_ptr->IsChecked(is_checked != 0);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_radiobutton_set_is_checked");
+        return -1;
+    }
+}
+
+int xaml_radiobutton_get_is_checked(XamlRadioButtonHandle radiobutton) {
+    count_bridge_call();
+    if (!radiobutton) {
+        return 0;
+    }
+
+    try {
+        auto& rb_ptr = *reinterpret_cast<std::shared_ptr<RadioButton>*>(radiobutton);
+        auto checked = rb_ptr->IsChecked();
+        return (checked && checked.Value()) ? 1 : 0;
+    }
+    catch (...) {
+        return 0;
+    }
+}
+
+int xaml_radiobutton_set_group_name(XamlRadioButtonHandle radiobutton, const wchar_t* group_name) {
+    count_bridge_call();
+    if (!radiobutton || !group_name) {
+        set_last_error(L"Invalid handle or group name");
+        return -1;
+    }
+
+    try {
+        auto& rb_ptr = *reinterpret_cast<std::shared_ptr<RadioButton>*>(radiobutton);
+        rb_ptr->GroupName(hstring(group_name));
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_radiobutton_set_group_name");
+        return -1;
+    }
+}
+
+void xaml_radiobutton_on_checked(XamlRadioButtonHandle radiobutton, void* callback_ptr) {
+    count_bridge_call();
+    if (!radiobutton || !callback_ptr) {
+        return;
+    }
+
+    try {
+        auto& rb_ptr = *reinterpret_cast<std::shared_ptr<RadioButton>*>(radiobutton);
+        auto callback = reinterpret_cast<void(*)()>(callback_ptr);
+
+        rb_ptr->Checked([callback](auto&&, auto&&) {
+            callback();
+        });
+    }
+    catch (...) {
+        // Silently ignore errors in event registration
+    }
+}
+
+void xaml_radiobutton_on_unchecked(XamlRadioButtonHandle radiobutton, void* callback_ptr) {
+    count_bridge_call();
+    if (!radiobutton || !callback_ptr) {
+        return;
+    }
+
+    try {
+        auto& rb_ptr = *reinterpret_cast<std::shared_ptr<RadioButton>*>(radiobutton);
+        auto callback = reinterpret_cast<void(*)()>(callback_ptr);
+
+        rb_ptr->Unchecked([callback](auto&&, auto&&) {
+            callback();
+        });
+    }
+    catch (...) {
+        // Silently ignore errors in event registration
+    }
+}
+
+XamlUIElementHandle xaml_radiobutton_as_uielement(XamlRadioButtonHandle radiobutton) {
+    count_bridge_call();
+    return reinterpret_cast<XamlUIElementHandle>(radiobutton);
+}
+
+// ============================================================================
+// Image Implementation
+// ============================================================================
+
+XamlImageHandle xaml_image_create() {
+    count_bridge_call();
+    try {
+        auto image = Image();
+        auto* handle = new std::shared_ptr<Image>(
+            std::make_shared<Image>(image)
+        );
+        return reinterpret_cast<XamlImageHandle>(handle);
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return nullptr;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_image_create");
+        return nullptr;
+    }
+}
+
+void xaml_image_destroy(XamlImageHandle image) {
+    count_bridge_call();
+    if (image) {
+        auto* ptr = reinterpret_cast<std::shared_ptr<Image>*>(image);
+        delete ptr;
+    }
+}
+
+int xaml_image_set_source(XamlImageHandle image, const wchar_t* uri) {
+    count_bridge_call();
+    if (!image || !uri) {
+        set_last_error(L"Invalid handle or URI");
+        return -1;
+    }
+
+    try {
+        auto& img_ptr = *reinterpret_cast<std::shared_ptr<Image>*>(image);
+        auto bitmap = BitmapImage(Uri(hstring(uri)));
+        img_ptr->Source(bitmap);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_image_set_source");
+        return -1;
+    }
+}
+
+int xaml_image_set_stretch(XamlImageHandle image, int stretch_mode) {
+    count_bridge_call();
+    if (!image) {
+        set_last_error(L"Invalid handle");
+        return -1;
+    }
+
+    try {
+        auto& img_ptr = *reinterpret_cast<std::shared_ptr<Image>*>(image);
+        img_ptr->Stretch(static_cast<Stretch>(stretch_mode));
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_image_set_stretch");
+        return -1;
+    }
+}
+
+int xaml_image_set_size(XamlImageHandle image, double width, double height) {
+    count_bridge_call();
+    if (!image) {
+        set_last_error(L"Invalid handle");
+        return -1;
+    }
+
+    try {
+        auto& img_ptr = *reinterpret_cast<std::shared_ptr<Image>*>(image);
+        img_ptr->Width(width);
+        img_ptr->Height(height);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_image_set_size");
+        return -1;
+    }
+}
+
+XamlUIElementHandle xaml_image_as_uielement(XamlImageHandle image) {
+    count_bridge_call();
+    return reinterpret_cast<XamlUIElementHandle>(image);
+}
+
+// ============================================================================
+// Grid Row/Column Definition Implementation
+// ============================================================================
+
+int xaml_grid_add_row_definition(XamlGridHandle grid, double height, int is_auto, int is_star) {
+    count_bridge_call();
+    if (!grid) {
+        set_last_error(L"Invalid handle");
+        return -1;
+    }
+
+    try {
+        auto& grid_ptr = *reinterpret_cast<std::shared_ptr<Grid>*>(grid);
+        auto rowDef = RowDefinition();
+
+        if (is_auto) {
+            rowDef.Height(GridLengthHelper::Auto());
+        } else if (is_star) {
+            rowDef.Height(GridLengthHelper::FromValueAndType(height, GridUnitType::Star));
+        } else {
+            rowDef.Height(GridLengthHelper::FromPixels(height));
+        }
+
+        grid_ptr->RowDefinitions().Append(rowDef);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_grid_add_row_definition");
+        return -1;
+    }
+}
+
+int xaml_grid_add_column_definition(XamlGridHandle grid, double width, int is_auto, int is_star) {
+    count_bridge_call();
+    if (!grid) {
+        set_last_error(L"Invalid handle");
+        return -1;
+    }
+
+    try {
+        auto& grid_ptr = *reinterpret_cast<std::shared_ptr<Grid>*>(grid);
+        auto colDef = ColumnDefinition();
+
+        if (is_auto) {
+            colDef.Width(GridLengthHelper::Auto());
+        } else if (is_star) {
+            colDef.Width(GridLengthHelper::FromValueAndType(width, GridUnitType::Star));
+        } else {
+            colDef.Width(GridLengthHelper::FromPixels(width));
+        }
+
+        grid_ptr->ColumnDefinitions().Append(colDef);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_grid_add_column_definition");
+        return -1;
+    }
+}
+
+int xaml_grid_set_child_row(XamlUIElementHandle child, int row) {
+    count_bridge_call();
+    if (!child) {
+        set_last_error(L"Invalid handle");
+        return -1;
+    }
+
+    try {
+        auto& child_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(child);
+        auto frameworkElement = child_ptr->as<FrameworkElement>();
+        Grid::SetRow(frameworkElement, row);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_grid_set_child_row");
+        return -1;
+    }
+}
+
+int xaml_grid_set_child_column(XamlUIElementHandle child, int column) {
+    count_bridge_call();
+    if (!child) {
+        set_last_error(L"Invalid handle");
+        return -1;
+    }
+
+    try {
+        auto& child_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(child);
+        auto frameworkElement = child_ptr->as<FrameworkElement>();
+        Grid::SetColumn(frameworkElement, column);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_grid_set_child_column");
+        return -1;
+    }
+}
+
+int xaml_grid_set_child_row_span(XamlUIElementHandle child, int row_span) {
+    count_bridge_call();
+    if (!child) {
+        set_last_error(L"Invalid handle");
+        return -1;
+    }
+
+    try {
+        auto& child_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(child);
+        auto frameworkElement = child_ptr->as<FrameworkElement>();
+        Grid::SetRowSpan(frameworkElement, row_span);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_grid_set_child_row_span");
+        return -1;
+    }
+}
+
+int xaml_grid_set_child_column_span(XamlUIElementHandle child, int column_span) {
+    count_bridge_call();
+    if (!child) {
+        set_last_error(L"Invalid handle");
+        return -1;
+    }
+
+    try {
+        auto& child_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(child);
+        auto frameworkElement = child_ptr->as<FrameworkElement>();
+        Grid::SetColumnSpan(frameworkElement, column_span);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_grid_set_child_column_span");
+        return -1;
+    }
+}
+
+// ============================================================================
+// ListView Implementation
+// ============================================================================
+
+// One group of a grouped ListView. CollectionViewSource enumerates it for the
+// items, and the default group header shows its key through IStringable.
+struct ListGroup : implements<ListGroup,
+                              Collections::IObservableVector<IInspectable>,
+                              Collections::IVector<IInspectable>,
+                              Collections::IVectorView<IInspectable>,
+                              Collections::IIterable<IInspectable>,
+                              IStringable>,
+                   observable_vector_base<ListGroup, IInspectable> {
+    explicit ListGroup(hstring key, std::vector<IInspectable> values = {})
+        : m_key(std::move(key)), m_values(std::move(values)) {}
+
+    auto& get_container() noexcept { return m_values; }
+    auto& get_container() const noexcept { return m_values; }
+    hstring ToString() { return m_key; }
+
+private:
+    hstring m_key;
+    std::vector<IInspectable> m_values;
+};
+
+// Native item store for each ListView. Every item added through the bridge is
+// kept here (text plus its boxed value) so views can be rebuilt without the
+// host re-sending data. Indices used by the public ListView APIs are positions
+// in the current view.
+struct ListViewState {
+    xaml_bridge::ListModel model;
+    std::vector<IInspectable> boxed;  // Indexed by store position
+
+    // Grouped mode (xaml_listview_set_grouped_items). Items are shown through a
+    // CollectionViewSource over `group_source`, and indices are store positions.
+    bool grouped = false;
+    xaml_bridge::GroupIndex groups;
+    Collections::IObservableVector<IInspectable> group_source{nullptr};
+};
+
+std::mutex g_list_states_mutex;
+std::unordered_map<XamlListViewHandle, std::shared_ptr<ListViewState>> g_list_states;
+
+std::shared_ptr<ListViewState> list_view_state(XamlListViewHandle listview) {
+    std::lock_guard<std::mutex> lock(g_list_states_mutex);
+    auto& state = g_list_states[listview];
+    if (!state) {
+        state = std::make_shared<ListViewState>();
+    }
+    return state;
+}
+
+// Replace the visible items with the current view in a single reset,
+// keeping the selected item selected if it is still visible.
+void list_view_apply_view(ListView const& lv, ListViewState& state) {
+    const auto& model = state.model;
+    size_t selected_store = xaml_bridge::ListModel::npos;
+    int selected = lv.SelectedIndex();
+    if (selected >= 0 && static_cast<size_t>(selected) < lv.Items().Size()) {
+        // The model already holds the new view, so find the selected
+        // item's store position by identity.
+        auto item = lv.Items().GetAt(selected);
+        for (size_t i = 0; i < state.boxed.size(); ++i) {
+            if (state.boxed[i] == item) {
+                selected_store = i;
+                break;
+            }
+        }
+    }
+
+    std::vector<IInspectable> visible;
+    visible.reserve(model.view_size());
+    int new_selected = -1;
+    for (size_t v = 0; v < model.view_size(); ++v) {
+        const uint32_t store = model.store_index(v);
+        if (store == selected_store) {
+            new_selected = static_cast<int>(v);
+        }
+        visible.push_back(state.boxed[store]);
+    }
+
+    lv.Items().ReplaceAll(visible);
+    if (new_selected >= 0) {
+        lv.SelectedIndex(new_selected);
+    }
+}
+
+Collections::IVector<IInspectable> list_view_group(ListViewState& state, uint32_t group) {
+    return state.group_source.GetAt(group).as<Collections::IVector<IInspectable>>();
+}
+
+IInspectable make_list_group(ListViewState const& state, uint32_t group) {
+    std::vector<IInspectable> values;
+    values.reserve(state.groups.members(group).size());
+    for (uint32_t item : state.groups.members(group)) {
+        values.push_back(state.boxed[item]);
+    }
+    const auto& key = state.groups.key(group);
+    return make<ListGroup>(hstring(reinterpret_cast<const wchar_t*>(key.c_str()), static_cast<uint32_t>(key.size())),
+                           std::move(values));
+}
+
+// Mirror a GroupIndex removal in the grouped source.
+void list_view_apply_group_removal(ListViewState& state, xaml_bridge::GroupIndex::Placement const& removed) {
+    if (removed.group_changed) {
+        state.group_source.RemoveAt(removed.group);
+    } else {
+        list_view_group(state, removed.group).RemoveAt(static_cast<uint32_t>(removed.position));
+    }
+}
+
+// Mirror a GroupIndex insertion of `item` in the grouped source.
+void list_view_apply_group_insertion(ListViewState& state, xaml_bridge::GroupIndex::Placement const& inserted, size_t item) {
+    if (inserted.group_changed) {
+        state.group_source.Append(make_list_group(state, inserted.group));
+    } else {
+        list_view_group(state, inserted.group).InsertAt(static_cast<uint32_t>(inserted.position), state.boxed[item]);
+    }
+}
+
+XamlListViewHandle xaml_listview_create() {
+    count_bridge_call();
+    try {
+        auto listview = std::make_shared<ListView>();
+        auto* handle = new std::shared_ptr<ListView>(listview);
+        list_view_state(handle);
+        return reinterpret_cast<XamlListViewHandle>(handle);
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return nullptr;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_listview_create");
+        return nullptr;
+    }
+}
+
+void xaml_listview_destroy(XamlListViewHandle listview) {
+    count_bridge_call();
+    if (listview) {
+        {
+            std::lock_guard<std::mutex> lock(g_list_states_mutex);
+            g_list_states.erase(listview);
+        }
+        delete reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+    }
+}
+
+int xaml_listview_add_item(XamlListViewHandle listview, const wchar_t* item) {
+    count_bridge_call();
+    if (!listview || !item) {
+        set_last_error(L"Invalid parameters in xaml_listview_add_item");
+        return -1;
+    }
+
+    try {
+        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+        auto state = list_view_state(listview);
+        if (state->grouped) {
+            set_last_error(L"Use xaml_listview_add_grouped_item on a grouped ListView");
+            return -1;
+        }
+        auto boxed = box_value(hstring(item));
+
+        size_t position = state->model.append(to_u16string(item));
+        state->boxed.push_back(boxed);
+
+        // Filtered-out items stay in the store but are not shown
+        if (position != xaml_bridge::ListModel::npos) {
+            lv_ptr->Items().InsertAt(static_cast<uint32_t>(position), boxed);
+        }
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_listview_add_item");
+        return -1;
+    }
+}
+
+int xaml_listview_remove_item(XamlListViewHandle listview, int index) {
+    count_bridge_call();
+    if (!listview || index < 0) {
+        set_last_error(L"Invalid parameters in xaml_listview_remove_item");
+        return -1;
+    }
+
+    try {
+        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+        auto state = list_view_state(listview);
+        if (state->grouped) {
+            if (static_cast<size_t>(index) >= state->model.size()) {
+                set_last_error(L"Index out of range in xaml_listview_remove_item");
+                return -1;
+            }
+            list_view_apply_group_removal(*state, state->groups.remove(index));
+            state->model.remove_at_view(index);
+            state->boxed.erase(state->boxed.begin() + index);
+            return 0;
+        }
+
+        auto items = lv_ptr->Items();
+        if (index >= static_cast<int>(items.Size())) {
+            set_last_error(L"Index out of range in xaml_listview_remove_item");
+            return -1;
+        }
+
+        if (static_cast<size_t>(index) < state->model.view_size()) {
+            size_t store = state->model.remove_at_view(index);
+            state->boxed.erase(state->boxed.begin() + store);
+        }
+
+        items.RemoveAt(index);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_listview_remove_item");
+        return -1;
+    }
+}
+
+int xaml_listview_clear_items(XamlListViewHandle listview) {
+    count_bridge_call();
+    if (!listview) {
+        set_last_error(L"Invalid parameters in xaml_listview_clear_items");
+        return -1;
+    }
+
+    try {
+        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+        auto state = list_view_state(listview);
+        if (state->grouped) {
+            // Clearing also leaves grouped mode.
+            lv_ptr->ItemsSource(nullptr);
+            state->grouped = false;
+            state->groups.clear();
+            state->group_source = nullptr;
+        }
+        state->model.clear();
+        state->boxed.clear();
+        lv_ptr->Items().Clear();
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_listview_clear_items");
+        return -1;
+    }
+}
+
+int xaml_listview_get_item_count(XamlListViewHandle listview) {
+    count_bridge_call();
+    if (!listview) {
+        set_last_error(L"Invalid parameters in xaml_listview_get_item_count");
+        return -1;
+    }
+
+    try {
+        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+        auto state = list_view_state(listview);
+        if (state->grouped) {
+            return static_cast<int>(state->model.size());
+        }
+        return static_cast<int>(lv_ptr->Items().Size());
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_listview_get_item_count");
+        return -1;
+    }
+}
+
+int xaml_listview_get_selected_index(XamlListViewHandle listview) {
+    count_bridge_call();
+    if (!listview) {
+        set_last_error(L"Invalid parameters in xaml_listview_get_selected_index");
+        return -1;
+    }
+
+    try {
+        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+        const int selected = lv_ptr->SelectedIndex();
+        auto state = list_view_state(listview);
+        if (state->grouped && selected >= 0) {
+            // The ListView reports positions in the flattened groups.
+            const size_t item = state->groups.item_at(static_cast<size_t>(selected));
+            return item == xaml_bridge::GroupIndex::npos ? -1 : static_cast<int>(item);
+        }
+        return selected;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_listview_get_selected_index");
+        return -1;
+    }
+}
+
+int xaml_listview_set_selected_index(XamlListViewHandle listview, int index) {
+    count_bridge_call();
+    if (!listview) {
+        set_last_error(L"Invalid parameters in xaml_listview_set_selected_index");
+        return -1;
+    }
+
+    try {
+        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+        auto state = list_view_state(listview);
+        if (state->grouped && index >= 0) {
+            if (static_cast<size_t>(index) >= state->groups.item_count()) {
+                set_last_error(L"Index out of range in xaml_listview_set_selected_index");
+                return -1;
+            }
+            index = static_cast<int>(state->groups.position_of(static_cast<size_t>(index)));
+        }
+        lv_ptr->SelectedIndex(index);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_listview_set_selected_index");
+        return -1;
+    }
+}
+
+int xaml_listview_get_item(XamlListViewHandle listview, int index, wchar_t* buffer, int buffer_size) {
+    count_bridge_call();
+    if (!listview || buffer_size < 0 || (buffer_size > 0 && !buffer) || index < 0) {
+        set_last_error(L"Invalid parameters in xaml_listview_get_item");
+        return -1;
+    }
+
+    try {
+        auto state = list_view_state(listview);
+        const auto& model = state->model;
+
+        if (static_cast<size_t>(index) >= model.view_size()) {
+            set_last_error(L"Index out of range in xaml_listview_get_item");
+            return -1;
+        }
+
+        // Read from the native store instead of unboxing the XAML item
+        const std::u16string& item_str = model.item(model.store_index(index));
+
+        const int len = static_cast<int>(item_str.size());
+        if (buffer_size > 0) {
+            const int copied = std::min(len, buffer_size - 1);
+            wcsncpy_s(buffer, buffer_size, reinterpret_cast<const wchar_t*>(item_str.c_str()), copied);
+        }
+        return len;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_listview_get_item");
+        return -1;
+    }
+}
+
+void xaml_listview_on_selection_changed(XamlListViewHandle listview, void* callback_ptr) {
+    count_bridge_call();
+    if (!listview || !callback_ptr) {
+        return;
+    }
+
+    try {
+        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+        auto callback = reinterpret_cast<void(*)(int)>(callback_ptr);
+        auto state = list_view_state(listview);
+
+        lv_ptr->SelectionChanged([callback, lv_ptr, state](auto&&, auto&&) {
+            int selected = lv_ptr->SelectedIndex();
+            if (state->grouped && selected >= 0) {
+                // Same insertion positions as xaml_listview_get_selected_index.
+                const size_t item = state->groups.item_at(static_cast<size_t>(selected));
+                selected = item == xaml_bridge::GroupIndex::npos ? -1 : static_cast<int>(item);
+            }
+            callback(selected);
+        });
+    }
+    catch (...) {
+        // Silently ignore errors in event registration
+    }
+}
+
+int xaml_listview_set_selection_mode(XamlListViewHandle listview, int mode) {
+    count_bridge_call();
+    if (!listview) {
+        set_last_error(L"Invalid parameters in xaml_listview_set_selection_mode");
+        return -1;
+    }
+
+    try {
+        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+
+        switch (mode) {
+            case 0:
+                lv_ptr->SelectionMode(ListViewSelectionMode::None);
+                break;
+            case 1:
+                lv_ptr->SelectionMode(ListViewSelectionMode::Single);
+                break;
+            case 2:
+                lv_ptr->SelectionMode(ListViewSelectionMode::Multiple);
+                break;
+            case 3:
+                lv_ptr->SelectionMode(ListViewSelectionMode::Extended);
+                break;
+            default:
+                set_last_error(L"Invalid selection mode in xaml_listview_set_selection_mode");
+                return -1;
+        }
+
         return 0;
     }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_listview_set_selection_mode");
+        return -1;
+    }
+}
+
+int xaml_listview_set_sort(XamlListViewHandle listview, const XamlSortKey* keys, int key_count) {
+    count_bridge_call();
+    if (!listview || key_count < 0 || (key_count > 0 && !keys)) {
+        set_last_error(L"Invalid parameters in xaml_listview_set_sort");
+        return -1;
+    }
+
+    try {
+        std::vector<xaml_bridge::SortKey> sort_keys;
+        sort_keys.reserve(key_count);
+        for (int i = 0; i < key_count; ++i) {
+            if (keys[i].kind < XAML_SORT_TEXT || keys[i].kind > XAML_SORT_COLUMN) {
+                set_last_error(L"Invalid sort key kind in xaml_listview_set_sort");
+                return -1;
+            }
+            sort_keys.push_back({
+                static_cast<xaml_bridge::SortKind>(keys[i].kind),
+                keys[i].column,
+                keys[i].descending != 0,
+            });
+        }
+
+        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+        auto state = list_view_state(listview);
+        if (state->grouped) {
+            set_last_error(L"xaml_listview_set_sort is not supported on a grouped ListView");
+            return -1;
+        }
+        state->model.set_sort(std::move(sort_keys));
+        list_view_apply_view(*lv_ptr, *state);
+        return static_cast<int>(state->model.view_size());
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_listview_set_sort");
+        return -1;
+    }
+}
+
+int xaml_listview_set_filter(XamlListViewHandle listview, const XamlFilterSpec* filter) {
+    count_bridge_call();
+    if (!listview) {
+        set_last_error(L"Invalid parameters in xaml_listview_set_filter");
+        return -1;
+    }
+
+    try {
+        xaml_bridge::FilterSpec spec;
+        if (filter) {
+            if (filter->kind < XAML_FILTER_NONE || filter->kind > XAML_FILTER_COLUMN_RANGE) {
+                set_last_error(L"Invalid filter kind in xaml_listview_set_filter");
+                return -1;
+            }
+            spec.kind = static_cast<xaml_bridge::FilterKind>(filter->kind);
+            spec.ignore_case = (filter->flags & XAML_FILTER_IGNORE_CASE) != 0;
+            spec.text = filter->text ? to_u16string(filter->text) : std::u16string();
+            spec.min = filter->min;
+            spec.max = filter->max;
+            spec.column = filter->column;
+        }
 
-    try {
-        auto& rb_ptr = *reinterpret_cast<std::shared_ptr<RadioButton>*>(radiobutton);
-        auto checked = rb_ptr->IsChecked();
-        return (checked && checked.Value()) ? 1 : 0;
+        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+        auto state = list_view_state(listview);
+        if (state->grouped) {
+            set_last_error(L"xaml_listview_set_filter is not supported on a grouped ListView");
+            return -1;
+        }
+        state->model.set_filter(std::move(spec));
+        list_view_apply_view(*lv_ptr, *state);
+        return static_cast<int>(state->model.view_size());
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
     }
     catch (...) {
-        return 0;
+        set_last_error(L"Unknown error in xaml_listview_set_filter");
+        return -1;
     }
 }
 
-int xaml_radiobutton_set_group_name(XamlRadioButtonHandle radiobutton, const wchar_t* group_name) {
-    if (!radiobutton || !group_name) {
-        set_last_error(L"Invalid handle or group name");
+int xaml_listview_set_column_values(XamlListViewHandle listview, int column, const double* values, int count) {
+    count_bridge_call();
+    if (!listview || column < 0 || count < 0 || (count > 0 && !values)) {
+        set_last_error(L"Invalid parameters in xaml_listview_set_column_values");
         return -1;
     }
 
     try {
-        auto& rb_ptr = *reinterpret_cast<std::shared_ptr<RadioButton>*>(radiobutton);
-        rb_ptr->GroupName(hstring(group_name));
+        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+        auto state = list_view_state(listview);
+        auto& model = state->model;
+
+        auto before = model.view();
+        model.set_column(column, values, count);
+        if (model.view() != before) {
+            list_view_apply_view(*lv_ptr, *state);
+        }
         return 0;
     }
     catch (const hresult_error& e) {
@@ -2361,111 +5989,475 @@ int xaml_radiobutton_set_group_name(XamlRadioButtonHandle radiobutton, const wch
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_radiobutton_set_group_name");
+        set_last_error(L"Unknown error in xaml_listview_set_column_values");
         return -1;
     }
 }
 
-void xaml_radiobutton_on_checked(XamlRadioButtonHandle radiobutton, void* callback_ptr) {
-    if (!radiobutton || !callback_ptr) {
-        return;
+int xaml_listview_search(XamlListViewHandle listview, const wchar_t* query, int flags, int* out_indices, int capacity) {
+    count_bridge_call();
+    if (!listview || !query || capacity < 0 || (capacity > 0 && !out_indices)) {
+        set_last_error(L"Invalid parameters in xaml_listview_search");
+        return -1;
     }
 
     try {
-        auto& rb_ptr = *reinterpret_cast<std::shared_ptr<RadioButton>*>(radiobutton);
-        auto callback = reinterpret_cast<void(*)()>(callback_ptr);
+        auto state = list_view_state(listview);
+        const bool ignore_case = (flags & XAML_SEARCH_IGNORE_CASE) != 0;
+        const std::u16string text = to_u16string(query);
 
-        rb_ptr->Checked([callback](auto&&, auto&&) {
-            callback();
-        });
+        const auto& matches = state->model.search(text, ignore_case);
+        const size_t copied = std::min(matches.size(), static_cast<size_t>(capacity));
+        std::copy(matches.begin(), matches.begin() + copied, out_indices);
+        const int total = static_cast<int>(matches.size());
+
+        if (flags & XAML_SEARCH_APPLY_FILTER) {
+            if (state->grouped) {
+                set_last_error(L"XAML_SEARCH_APPLY_FILTER is not supported on a grouped ListView");
+                return -1;
+            }
+            xaml_bridge::FilterSpec spec;
+            spec.kind = xaml_bridge::FilterKind::Contains;
+            spec.ignore_case = ignore_case;
+            spec.text = text;
+            auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+            state->model.set_filter(std::move(spec));
+            list_view_apply_view(*lv_ptr, *state);
+        }
+        return total;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
     }
     catch (...) {
-        // Silently ignore errors in event registration
+        set_last_error(L"Unknown error in xaml_listview_search");
+        return -1;
     }
 }
 
-void xaml_radiobutton_on_unchecked(XamlRadioButtonHandle radiobutton, void* callback_ptr) {
-    if (!radiobutton || !callback_ptr) {
-        return;
+int xaml_listview_set_grouped_items(XamlListViewHandle listview, const wchar_t* const* items, const wchar_t* const* group_keys, int count) {
+    count_bridge_call();
+    if (!listview || count < 0 || (count > 0 && (!items || !group_keys))) {
+        set_last_error(L"Invalid parameters in xaml_listview_set_grouped_items");
+        return -1;
     }
 
     try {
-        auto& rb_ptr = *reinterpret_cast<std::shared_ptr<RadioButton>*>(radiobutton);
-        auto callback = reinterpret_cast<void(*)()>(callback_ptr);
+        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+        auto state = list_view_state(listview);
 
-        rb_ptr->Unchecked([callback](auto&&, auto&&) {
-            callback();
-        });
+        std::vector<std::u16string> keys;
+        keys.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            if (!items[i] || !group_keys[i]) {
+                set_last_error(L"Null item or key in xaml_listview_set_grouped_items");
+                return -1;
+            }
+            keys.push_back(to_u16string(group_keys[i]));
+        }
+
+        // Grouping replaces the items and any sort or filter.
+        state->model = xaml_bridge::ListModel();
+        state->boxed.clear();
+        state->boxed.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            state->model.append(to_u16string(items[i]));
+            state->boxed.push_back(box_value(hstring(items[i])));
+        }
+        state->groups.assign(keys);
+
+        std::vector<IInspectable> groups;
+        groups.reserve(state->groups.group_count());
+        for (size_t g = 0; g < state->groups.group_count(); ++g) {
+            groups.push_back(make_list_group(*state, static_cast<uint32_t>(g)));
+        }
+        state->group_source = single_threaded_observable_vector<IInspectable>(std::move(groups));
+
+        if (!state->grouped) {
+            lv_ptr->Items().Clear();
+            if (lv_ptr->GroupStyle().Size() == 0) {
+                lv_ptr->GroupStyle().Append(Controls::GroupStyle());
+            }
+            state->grouped = true;
+        }
+
+        Data::CollectionViewSource source;
+        source.IsSourceGrouped(true);
+        source.Source(state->group_source);
+        lv_ptr->ItemsSource(source.View());
+        return static_cast<int>(state->groups.group_count());
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
     }
     catch (...) {
-        // Silently ignore errors in event registration
+        set_last_error(L"Unknown error in xaml_listview_set_grouped_items");
+        return -1;
     }
 }
 
-XamlUIElementHandle xaml_radiobutton_as_uielement(XamlRadioButtonHandle radiobutton) {
-    return reinterpret_cast<XamlUIElementHandle>(radiobutton);
+int xaml_listview_add_grouped_item(XamlListViewHandle listview, const wchar_t* item, const wchar_t* group_key) {
+    count_bridge_call();
+    if (!listview || !item || !group_key) {
+        set_last_error(L"Invalid parameters in xaml_listview_add_grouped_item");
+        return -1;
+    }
+
+    try {
+        auto state = list_view_state(listview);
+        if (!state->grouped) {
+            set_last_error(L"ListView is not grouped in xaml_listview_add_grouped_item");
+            return -1;
+        }
+
+        const size_t index = state->model.size();
+        state->model.append(to_u16string(item));
+        state->boxed.push_back(box_value(hstring(item)));
+        list_view_apply_group_insertion(*state, state->groups.append(to_u16string(group_key)), index);
+        return static_cast<int>(index);
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_listview_add_grouped_item");
+        return -1;
+    }
 }
 
-// ============================================================================
-// Image Implementation
-// ============================================================================
+int xaml_listview_set_item_group(XamlListViewHandle listview, int index, const wchar_t* group_key) {
+    count_bridge_call();
+    if (!listview || index < 0 || !group_key) {
+        set_last_error(L"Invalid parameters in xaml_listview_set_item_group");
+        return -1;
+    }
 
-XamlImageHandle xaml_image_create() {
     try {
-        auto image = Image();
-        auto* handle = new std::shared_ptr<Image>(
-            std::make_shared<Image>(image)
-        );
-        return reinterpret_cast<XamlImageHandle>(handle);
+        auto state = list_view_state(listview);
+        if (!state->grouped) {
+            set_last_error(L"ListView is not grouped in xaml_listview_set_item_group");
+            return -1;
+        }
+        if (static_cast<size_t>(index) >= state->model.size()) {
+            set_last_error(L"Index out of range in xaml_listview_set_item_group");
+            return -1;
+        }
+
+        // Only the two affected groups change; no other group is rebuilt.
+        const auto move = state->groups.set_key(index, to_u16string(group_key));
+        if (move.moved) {
+            list_view_apply_group_removal(*state, move.from);
+            list_view_apply_group_insertion(*state, move.to, index);
+        }
+        return 0;
     }
     catch (const hresult_error& e) {
         set_last_error(e.message().c_str());
-        return nullptr;
+        return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_image_create");
-        return nullptr;
+        set_last_error(L"Unknown error in xaml_listview_set_item_group");
+        return -1;
     }
 }
 
-void xaml_image_destroy(XamlImageHandle image) {
-    if (image) {
-        auto* ptr = reinterpret_cast<std::shared_ptr<Image>*>(image);
-        delete ptr;
+int xaml_listview_export_items(XamlListViewHandle listview, int start, int count, wchar_t* buffer, size_t capacity, uint32_t* offsets) {
+    count_bridge_call();
+    if (!listview || start < 0 || count < 0) {
+        set_last_error(L"Invalid parameters in xaml_listview_export_items");
+        return -1;
+    }
+
+    try {
+        auto state = list_view_state(listview);
+        const auto& model = state->model;
+        if (static_cast<size_t>(start) + static_cast<size_t>(count) > model.view_size()) {
+            set_last_error(L"Range out of bounds in xaml_listview_export_items");
+            return -1;
+        }
+
+        const size_t required = model.export_view(start, count, reinterpret_cast<char16_t*>(buffer), capacity, offsets);
+        if (required > static_cast<size_t>(INT_MAX)) {
+            set_last_error(L"Range too large in xaml_listview_export_items");
+            return -1;
+        }
+        return static_cast<int>(required);
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_listview_export_items");
+        return -1;
     }
 }
 
-int xaml_image_set_source(XamlImageHandle image, const wchar_t* uri) {
-    if (!image || !uri) {
-        set_last_error(L"Invalid handle or URI");
+int xaml_listview_get_selected_indices(XamlListViewHandle listview, int* out_indices, int capacity) {
+    count_bridge_call();
+    if (!listview || capacity < 0 || (capacity > 0 && !out_indices)) {
+        set_last_error(L"Invalid parameters in xaml_listview_get_selected_indices");
         return -1;
     }
 
     try {
-        auto& img_ptr = *reinterpret_cast<std::shared_ptr<Image>*>(image);
-        auto bitmap = BitmapImage(Uri(hstring(uri)));
-        img_ptr->Source(bitmap);
-        return 0;
+        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+
+        // SelectedRanges covers every selection mode without boxing each item.
+        std::vector<int> indices;
+        for (auto const& range : lv_ptr->SelectedRanges()) {
+            for (int i = range.FirstIndex(); i <= range.LastIndex(); ++i) {
+                indices.push_back(i);
+            }
+        }
+        std::sort(indices.begin(), indices.end());
+        auto state = list_view_state(listview);
+        if (state->grouped) {
+            indices = state->groups.items_at(indices);
+        }
+
+        const size_t copied = std::min(indices.size(), static_cast<size_t>(capacity));
+        std::copy(indices.begin(), indices.begin() + copied, out_indices);
+        return static_cast<int>(indices.size());
     }
     catch (const hresult_error& e) {
         set_last_error(e.message().c_str());
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_image_set_source");
+        set_last_error(L"Unknown error in xaml_listview_get_selected_indices");
         return -1;
     }
 }
 
-int xaml_image_set_stretch(XamlImageHandle image, int stretch_mode) {
-    if (!image) {
-        set_last_error(L"Invalid handle");
+XamlUIElementHandle xaml_listview_as_uielement(XamlListViewHandle listview) {
+    count_bridge_call();
+    if (!listview) {
+        return nullptr;
+    }
+
+    try {
+        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+        UIElement ui_element = *lv_ptr;
+        return reinterpret_cast<XamlUIElementHandle>(new std::shared_ptr<UIElement>(std::make_shared<UIElement>(ui_element)));
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+// ============================================================================
+// Collection Change Batch Implementation
+// ============================================================================
+
+// Batches touching more items than this are applied as one collection reset
+// instead of one notification per item.
+constexpr int64_t kIncrementalChangeLimit = 16;
+
+// Check every record against the running collection size. Returns how many
+// items the batch touches (capped just above kIncrementalChangeLimit, and at
+// the cap for any RESET), or -1 if a record is invalid.
+int64_t validate_collection_changes(const XamlCollectionChange* changes, int change_count, size_t size) {
+    int64_t touched = 0;
+    for (int i = 0; i < change_count; ++i) {
+        const auto& change = changes[i];
+        if (change.index < 0 || change.count < 0) {
+            return -1;
+        }
+        const size_t index = static_cast<size_t>(change.index);
+        const size_t count = static_cast<size_t>(change.count);
+
+        const bool has_items = change.kind == XAML_CHANGE_INSERT || change.kind == XAML_CHANGE_REPLACE ||
+                               change.kind == XAML_CHANGE_RESET;
+        if (has_items && count > 0) {
+            if (!change.items) {
+                return -1;
+            }
+            for (size_t k = 0; k < count; ++k) {
+                if (!change.items[k]) {
+                    return -1;
+                }
+            }
+        }
+
+        size_t affected = count;
+        switch (change.kind) {
+            case XAML_CHANGE_INSERT:
+                if (index > size) {
+                    return -1;
+                }
+                size += count;
+                break;
+            case XAML_CHANGE_REMOVE:
+                if (index + count > size) {
+                    return -1;
+                }
+                size -= count;
+                break;
+            case XAML_CHANGE_REPLACE:
+                if (index + count > size) {
+                    return -1;
+                }
+                break;
+            case XAML_CHANGE_MOVE:
+                if (index >= size || change.new_index < 0 || static_cast<size_t>(change.new_index) >= size) {
+                    return -1;
+                }
+                affected = 1;
+                break;
+            case XAML_CHANGE_RESET:
+                size = count;
+                affected = kIncrementalChangeLimit + 1;
+                break;
+            default:
+                return -1;
+        }
+        touched = std::min<int64_t>(touched + static_cast<int64_t>(affected), kIncrementalChangeLimit + 1);
+    }
+    return touched;
+}
+
+// Apply one validated record to `values`, creating new entries with make(text).
+template <class T, class Make>
+void apply_collection_change(std::vector<T>& values, XamlCollectionChange const& change, Make&& make) {
+    const size_t index = static_cast<size_t>(change.index);
+    const size_t count = static_cast<size_t>(change.count);
+    switch (change.kind) {
+        case XAML_CHANGE_INSERT: {
+            std::vector<T> added;
+            added.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                added.push_back(make(change.items[i]));
+            }
+            values.insert(values.begin() + index,
+                          std::make_move_iterator(added.begin()), std::make_move_iterator(added.end()));
+            break;
+        }
+        case XAML_CHANGE_REMOVE:
+            values.erase(values.begin() + index, values.begin() + index + count);
+            break;
+        case XAML_CHANGE_REPLACE:
+            for (size_t i = 0; i < count; ++i) {
+                values[index + i] = make(change.items[i]);
+            }
+            break;
+        case XAML_CHANGE_MOVE: {
+            T moved = std::move(values[index]);
+            values.erase(values.begin() + index);
+            values.insert(values.begin() + change.new_index, std::move(moved));
+            break;
+        }
+        case XAML_CHANGE_RESET:
+            values.clear();
+            values.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                values.push_back(make(change.items[i]));
+            }
+            break;
+    }
+}
+
+// Mirror a record onto a XAML items collection. `values` already holds the
+// collection after the record. RESET never takes this path.
+void apply_collection_change(Collections::IVector<IInspectable> const& items, XamlCollectionChange const& change,
+                             std::vector<IInspectable> const& values) {
+    const uint32_t index = static_cast<uint32_t>(change.index);
+    const uint32_t count = static_cast<uint32_t>(change.count);
+    switch (change.kind) {
+        case XAML_CHANGE_INSERT:
+            for (uint32_t i = 0; i < count; ++i) {
+                items.InsertAt(index + i, values[index + i]);
+            }
+            break;
+        case XAML_CHANGE_REMOVE:
+            for (uint32_t i = 0; i < count; ++i) {
+                items.RemoveAt(index);
+            }
+            break;
+        case XAML_CHANGE_REPLACE:
+            for (uint32_t i = 0; i < count; ++i) {
+                items.SetAt(index + i, values[index + i]);
+            }
+            break;
+        case XAML_CHANGE_MOVE: {
+            const uint32_t to = static_cast<uint32_t>(change.new_index);
+            items.RemoveAt(index);
+            items.InsertAt(to, values[to]);
+            break;
+        }
+    }
+}
+
+void apply_model_change(xaml_bridge::ListModel& model, XamlCollectionChange const& change) {
+    const size_t index = static_cast<size_t>(change.index);
+    const size_t count = static_cast<size_t>(change.count);
+    std::vector<std::u16string> texts;
+    if (change.kind == XAML_CHANGE_INSERT || change.kind == XAML_CHANGE_RESET) {
+        texts.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            texts.push_back(to_u16string(change.items[i]));
+        }
+    }
+
+    switch (change.kind) {
+        case XAML_CHANGE_INSERT:
+            model.insert_at(index, std::move(texts));
+            break;
+        case XAML_CHANGE_REMOVE:
+            model.remove_range(index, count);
+            break;
+        case XAML_CHANGE_REPLACE:
+            for (size_t i = 0; i < count; ++i) {
+                model.replace_at(index + i, to_u16string(change.items[i]));
+            }
+            break;
+        case XAML_CHANGE_MOVE:
+            model.move_item(index, static_cast<size_t>(change.new_index));
+            break;
+        case XAML_CHANGE_RESET:
+            model.assign(std::move(texts));
+            break;
+    }
+}
+
+int xaml_listview_apply_changes(XamlListViewHandle listview, const XamlCollectionChange* changes, int change_count) {
+    count_bridge_call();
+    if (!listview || change_count < 0 || (change_count > 0 && !changes)) {
+        set_last_error(L"Invalid parameters in xaml_listview_apply_changes");
         return -1;
     }
 
     try {
-        auto& img_ptr = *reinterpret_cast<std::shared_ptr<Image>*>(image);
-        img_ptr->Stretch(static_cast<Stretch>(stretch_mode));
+        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+        auto state = list_view_state(listview);
+        auto& model = state->model;
+        if (state->grouped || model.is_sorted() || model.is_filtered()) {
+            set_last_error(L"xaml_listview_apply_changes needs an unsorted, unfiltered, ungrouped ListView");
+            return -1;
+        }
+
+        const int64_t touched = validate_collection_changes(changes, change_count, model.size());
+        if (touched < 0) {
+            set_last_error(L"Invalid change record in xaml_listview_apply_changes");
+            return -1;
+        }
+
+        const bool incremental = touched <= kIncrementalChangeLimit;
+        auto items = lv_ptr->Items();
+        for (int i = 0; i < change_count; ++i) {
+            apply_collection_change(state->boxed, changes[i],
+                [](const wchar_t* text) -> IInspectable { return box_value(hstring(text)); });
+            apply_model_change(model, changes[i]);
+            if (incremental) {
+                apply_collection_change(items, changes[i], state->boxed);
+            }
+        }
+        if (!incremental) {
+            list_view_apply_view(*lv_ptr, *state);
+        }
         return 0;
     }
     catch (const hresult_error& e) {
@@ -2473,21 +6465,52 @@ int xaml_image_set_stretch(XamlImageHandle image, int stretch_mode) {
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_image_set_stretch");
+        set_last_error(L"Unknown error in xaml_listview_apply_changes");
         return -1;
     }
 }
 
-int xaml_image_set_size(XamlImageHandle image, double width, double height) {
-    if (!image) {
-        set_last_error(L"Invalid handle");
+int xaml_combobox_apply_changes(XamlComboBoxHandle combobox, const XamlCollectionChange* changes, int change_count) {
+    count_bridge_call();
+    if (!combobox || change_count < 0 || (change_count > 0 && !changes)) {
+        set_last_error(L"Invalid parameters in xaml_combobox_apply_changes");
         return -1;
     }
 
     try {
-        auto& img_ptr = *reinterpret_cast<std::shared_ptr<Image>*>(image);
-        img_ptr->Width(width);
-        img_ptr->Height(height);
+        auto& cb_ptr = *reinterpret_cast<std::shared_ptr<ComboBox>*>(combobox);
+        auto items = cb_ptr->Items();
+        std::vector<IInspectable> values(items.Size());
+        items.GetMany(0, values);
+
+        const int64_t touched = validate_collection_changes(changes, change_count, values.size());
+        if (touched < 0) {
+            set_last_error(L"Invalid change record in xaml_combobox_apply_changes");
+            return -1;
+        }
+
+        const bool incremental = touched <= kIncrementalChangeLimit;
+        const IInspectable selected = incremental ? nullptr : cb_ptr->SelectedItem();
+        for (int i = 0; i < change_count; ++i) {
+            apply_collection_change(values, changes[i], [](const wchar_t* text) -> IInspectable {
+                ComboBoxItem item;
+                item.Content(box_value(hstring(text)));
+                return item;
+            });
+            if (incremental) {
+                apply_collection_change(items, changes[i], values);
+            }
+        }
+
+        if (!incremental) {
+            items.ReplaceAll(values);
+            if (selected) {
+                auto found = std::find(values.begin(), values.end(), selected);
+                if (found != values.end()) {
+                    cb_ptr->SelectedIndex(static_cast<int32_t>(found - values.begin()));
+                }
+            }
+        }
         return 0;
     }
     catch (const hresult_error& e) {
@@ -2495,69 +6518,266 @@ int xaml_image_set_size(XamlImageHandle image, double width, double height) {
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_image_set_size");
+        set_last_error(L"Unknown error in xaml_combobox_apply_changes");
         return -1;
     }
 }
 
-XamlUIElementHandle xaml_image_as_uielement(XamlImageHandle image) {
-    return reinterpret_cast<XamlUIElementHandle>(image);
-}
-
 // ============================================================================
-// Grid Row/Column Definition Implementation
+// Log View Implementation
 // ============================================================================
 
-int xaml_grid_add_row_definition(XamlGridHandle grid, double height, int is_auto, int is_star) {
-    if (!grid) {
-        set_last_error(L"Invalid handle");
-        return -1;
+constexpr double kLogFontSize = 13.0;
+constexpr double kLogLineHeight = 18.0;
+constexpr int64_t kLogWheelLines = 3;     // Per 120-unit wheel notch
+// Idle frames before the view stops listening for Rendering. Rendering keeps
+// XAML drawing every frame, but re-subscribing on every burst is wasteful.
+constexpr uint32_t kLogIdleFrames = 30;
+constexpr uint64_t kNoLogLine = UINT64_MAX;
+
+// One log pane. Appends may run on any thread; everything else runs on the
+// UI thread that created it.
+struct LogViewState {
+    explicit LogViewState(size_t capacity) : view(capacity) {}
+
+    std::mutex mutex;                      // Guards everything up to `armed`
+    xaml_bridge::LogView view;
+    uint64_t appends = 0;
+    uint64_t redraws = 0;
+    uint32_t idle_frames = 0;
+    bool armed = false;                    // Rendering is subscribed or queued
+
+    // UI thread only.
+    Grid root{nullptr};
+    StackPanel rows_panel{nullptr};
+    Primitives::ScrollBar scrollbar{nullptr};
+    std::vector<TextBlock> rows;
+    std::vector<uint64_t> row_lines;       // Line shown by each row, kNoLogLine if blank
+    std::vector<uint64_t> next_lines;      // Lines for the rows after this frame
+    std::vector<std::u16string> row_text;  // Changed rows, copied out under the lock
+    Windows::System::DispatcherQueue queue{nullptr};
+    event_token rendering{};
+    bool setting_scrollbar = false;
+};
+
+void redraw_log(LogViewState& log);
+
+// Caller holds log->mutex. Subscribes the redraw to Rendering unless it
+// already is; off the UI thread the subscription is queued to it.
+void arm_log_redraw(const std::shared_ptr<LogViewState>& log) {
+    log->idle_frames = 0;
+    if (log->armed) {
+        return;
+    }
+    log->armed = true;
+    std::weak_ptr<LogViewState> weak = log;
+    auto subscribe = [weak] {
+        auto state = weak.lock();
+        if (!state || state->rendering) {
+            return;
+        }
+        state->rendering = CompositionTarget::Rendering([weak](const IInspectable&, const IInspectable&) {
+            if (auto state = weak.lock()) {
+                redraw_log(*state);
+            }
+        });
+    };
+    if (Windows::System::DispatcherQueue::GetForCurrentThread() == log->queue) {
+        subscribe();
+    } else if (!log->queue.TryEnqueue(subscribe)) {
+        // The queue is shutting down; let the next append try again rather
+        // than leaving the view armed with no subscription.
+        log->armed = false;
+    }
+}
+
+// Rendering handler. Copies the changed rows under the lock and updates XAML
+// after releasing it: ScrollBar changes raise ValueChanged synchronously.
+void redraw_log(LogViewState& log) {
+    uint32_t changes = 0;
+    uint64_t first = 0;
+    uint64_t top = 0;
+    uint64_t max_top = 0;
+    {
+        std::lock_guard<std::mutex> lock(log.mutex);
+        changes = log.view.take_changes();
+        if (changes == 0) {
+            if (++log.idle_frames >= kLogIdleFrames) {
+                CompositionTarget::Rendering(log.rendering);
+                log.rendering = {};
+                log.armed = false;
+            }
+            return;
+        }
+        log.idle_frames = 0;
+        const xaml_bridge::LogBuffer& buffer = log.view.buffer();
+        first = buffer.first_line();
+        top = log.view.top();
+        max_top = log.view.max_top();
+        if (changes & xaml_bridge::kLogRowsChanged) {
+            ++log.redraws;
+            // Lines never change once appended, so a row that still shows the
+            // same line index keeps its text.
+            const uint64_t end = log.view.visible_end();
+            for (size_t row = 0; row < log.rows.size(); ++row) {
+                const uint64_t line = top + row < end ? top + row : kNoLogLine;
+                log.next_lines[row] = line;
+                if (line != log.row_lines[row]) {
+                    log.row_text[row].assign(line == kNoLogLine ? std::u16string_view() : buffer.line(line));
+                }
+            }
+        }
     }
 
-    try {
-        auto& grid_ptr = *reinterpret_cast<std::shared_ptr<Grid>*>(grid);
-        auto rowDef = RowDefinition();
+    if (changes & xaml_bridge::kLogRowsChanged) {
+        for (size_t row = 0; row < log.rows.size(); ++row) {
+            if (log.next_lines[row] != log.row_lines[row]) {
+                log.rows[row].Text(reinterpret_cast<const wchar_t*>(log.row_text[row].c_str()));
+                log.row_lines[row] = log.next_lines[row];
+            }
+        }
+    }
+    const double page = static_cast<double>(log.rows.size());
+    log.setting_scrollbar = true;
+    log.scrollbar.Maximum(static_cast<double>(max_top - first));
+    log.scrollbar.Value(static_cast<double>(top - first));
+    log.scrollbar.ViewportSize(page);
+    log.scrollbar.LargeChange(std::max(page, 1.0));
+    log.setting_scrollbar = false;
+}
+
+// UI thread. Keeps one TextBlock per whole line that fits.
+void resize_log_rows(const std::shared_ptr<LogViewState>& log, double height) {
+    const size_t rows = static_cast<size_t>(std::max(0.0, std::floor(height / kLogLineHeight)));
+    while (log->rows.size() < rows) {
+        TextBlock row;
+        row.FontFamily(Media::FontFamily(L"Consolas"));
+        row.FontSize(kLogFontSize);
+        row.Height(kLogLineHeight);
+        row.TextWrapping(TextWrapping::NoWrap);
+        log->rows_panel.Children().Append(row);
+        log->rows.push_back(row);
+    }
+    while (log->rows.size() > rows) {
+        log->rows_panel.Children().RemoveAtEnd();
+        log->rows.pop_back();
+    }
+    log->row_lines.resize(rows, kNoLogLine);
+    log->next_lines.resize(rows, kNoLogLine);
+    log->row_text.resize(rows);
+
+    std::lock_guard<std::mutex> lock(log->mutex);
+    log->view.set_rows(rows);
+    arm_log_redraw(log);
+}
+
+XamlLogViewHandle xaml_logview_create(int capacity) {
+    count_bridge_call();
+    if (capacity <= 0) {
+        set_last_error(L"Log capacity must be positive");
+        return nullptr;
+    }
 
-        if (is_auto) {
-            rowDef.Height(GridLengthHelper::Auto());
-        } else if (is_star) {
-            rowDef.Height(GridLengthHelper::FromValueAndType(height, GridUnitType::Star));
-        } else {
-            rowDef.Height(GridLengthHelper::FromPixels(height));
+    try {
+        auto log = std::make_shared<LogViewState>(static_cast<size_t>(capacity));
+        log->queue = Windows::System::DispatcherQueue::GetForCurrentThread();
+        if (!log->queue) {
+            set_last_error(L"xaml_logview_create must run on a UI thread");
+            return nullptr;
         }
 
-        grid_ptr->RowDefinitions().Append(rowDef);
-        return 0;
+        log->root = Grid();
+        ColumnDefinition text_column;
+        text_column.Width(GridLengthHelper::FromValueAndType(1.0, GridUnitType::Star));
+        ColumnDefinition bar_column;
+        bar_column.Width(GridLengthHelper::Auto());
+        log->root.ColumnDefinitions().Append(text_column);
+        log->root.ColumnDefinitions().Append(bar_column);
+        // A transparent background so wheel input anywhere in the pane hits it.
+        log->root.Background(create_solid_brush(0x00000000));
+
+        log->rows_panel = StackPanel();
+        log->scrollbar = Primitives::ScrollBar();
+        log->scrollbar.Orientation(Orientation::Vertical);
+        log->scrollbar.IndicatorMode(Primitives::ScrollingIndicatorMode::MouseIndicator);
+        log->scrollbar.SmallChange(1.0);
+        Grid::SetColumn(log->scrollbar, 1);
+        log->root.Children().Append(log->rows_panel);
+        log->root.Children().Append(log->scrollbar);
+
+        // Handlers hold the state weakly; the handle owns it.
+        std::weak_ptr<LogViewState> weak = log;
+        log->root.SizeChanged([weak](const IInspectable&, const SizeChangedEventArgs& args) {
+            if (auto state = weak.lock()) {
+                resize_log_rows(state, args.NewSize().Height);
+            }
+        });
+        log->root.PointerWheelChanged([weak](const IInspectable&, const Windows::UI::Xaml::Input::PointerRoutedEventArgs& args) {
+            auto state = weak.lock();
+            if (!state) {
+                return;
+            }
+            const int64_t delta = args.GetCurrentPoint(state->root).Properties().MouseWheelDelta();
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->view.scroll_by(-delta * kLogWheelLines / 120);
+            arm_log_redraw(state);
+            args.Handled(true);
+        });
+        log->scrollbar.ValueChanged([weak](const IInspectable&, const Primitives::RangeBaseValueChangedEventArgs& args) {
+            auto state = weak.lock();
+            if (!state || state->setting_scrollbar) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(state->mutex);
+            const uint64_t offset = static_cast<uint64_t>(std::llround(std::max(0.0, args.NewValue())));
+            state->view.scroll_to(state->view.buffer().first_line() + offset);
+            arm_log_redraw(state);
+        });
+
+        return reinterpret_cast<XamlLogViewHandle>(new std::shared_ptr<LogViewState>(log));
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return nullptr;
+    }
+    catch (...) {
+        set_last_error(L"Unknown error in xaml_logview_create");
+        return nullptr;
+    }
+}
+
+void xaml_logview_destroy(XamlLogViewHandle log) {
+    count_bridge_call();
+    if (!log) {
+        return;
     }
-    catch (const hresult_error& e) {
-        set_last_error(e.message().c_str());
-        return -1;
+    auto* handle = reinterpret_cast<std::shared_ptr<LogViewState>*>(log);
+    try {
+        if ((*handle)->rendering) {
+            CompositionTarget::Rendering((*handle)->rendering);
+        }
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_grid_add_row_definition");
-        return -1;
+        // The handler holds the state weakly, so a missed revoke is harmless
     }
+    delete handle;
 }
 
-int xaml_grid_add_column_definition(XamlGridHandle grid, double width, int is_auto, int is_star) {
-    if (!grid) {
-        set_last_error(L"Invalid handle");
+int xaml_logview_append(XamlLogViewHandle log, const wchar_t* text, int length) {
+    count_bridge_call();
+    if (!log || !text || length < -1) {
+        set_last_error(L"Invalid log view, text or length");
         return -1;
     }
 
     try {
-        auto& grid_ptr = *reinterpret_cast<std::shared_ptr<Grid>*>(grid);
-        auto colDef = ColumnDefinition();
-
-        if (is_auto) {
-            colDef.Width(GridLengthHelper::Auto());
-        } else if (is_star) {
-            colDef.Width(GridLengthHelper::FromValueAndType(width, GridUnitType::Star));
-        } else {
-            colDef.Width(GridLengthHelper::FromPixels(width));
+        auto& state = *reinterpret_cast<std::shared_ptr<LogViewState>*>(log);
+        const std::wstring_view wide = length < 0 ? std::wstring_view(text) : std::wstring_view(text, static_cast<size_t>(length));
+        std::lock_guard<std::mutex> lock(state->mutex);
+        ++state->appends;
+        if (state->view.append(std::u16string_view(reinterpret_cast<const char16_t*>(wide.data()), wide.size())) > 0) {
+            arm_log_redraw(state);
         }
-
-        grid_ptr->ColumnDefinitions().Append(colDef);
         return 0;
     }
     catch (const hresult_error& e) {
@@ -2565,21 +6785,23 @@ int xaml_grid_add_column_definition(XamlGridHandle grid, double width, int is_au
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_grid_add_column_definition");
+        set_last_error(L"Unknown error in xaml_logview_append");
         return -1;
     }
 }
 
-int xaml_grid_set_child_row(XamlUIElementHandle child, int row) {
-    if (!child) {
-        set_last_error(L"Invalid handle");
+int xaml_logview_clear(XamlLogViewHandle log) {
+    count_bridge_call();
+    if (!log) {
+        set_last_error(L"Invalid log view");
         return -1;
     }
 
     try {
-        auto& child_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(child);
-        auto frameworkElement = child_ptr->as<FrameworkElement>();
-        Grid::SetRow(frameworkElement, row);
+        auto& state = *reinterpret_cast<std::shared_ptr<LogViewState>*>(log);
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->view.clear();
+        arm_log_redraw(state);
         return 0;
     }
     catch (const hresult_error& e) {
@@ -2587,21 +6809,23 @@ int xaml_grid_set_child_row(XamlUIElementHandle child, int row) {
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_grid_set_child_row");
+        set_last_error(L"Unknown error in xaml_logview_clear");
         return -1;
     }
 }
 
-int xaml_grid_set_child_column(XamlUIElementHandle child, int column) {
-    if (!child) {
-        set_last_error(L"Invalid handle");
+int xaml_logview_set_follow_tail(XamlLogViewHandle log, int follow) {
+    count_bridge_call();
+    if (!log) {
+        set_last_error(L"Invalid log view");
         return -1;
     }
 
     try {
-        auto& child_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(child);
-        auto frameworkElement = child_ptr->as<FrameworkElement>();
-        Grid::SetColumn(frameworkElement, column);
+        auto& state = *reinterpret_cast<std::shared_ptr<LogViewState>*>(log);
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->view.set_follow_tail(follow != 0);
+        arm_log_redraw(state);
         return 0;
     }
     catch (const hresult_error& e) {
@@ -2609,21 +6833,23 @@ int xaml_grid_set_child_column(XamlUIElementHandle child, int column) {
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_grid_set_child_column");
+        set_last_error(L"Unknown error in xaml_logview_set_follow_tail");
         return -1;
     }
 }
 
-int xaml_grid_set_child_row_span(XamlUIElementHandle child, int row_span) {
-    if (!child) {
-        set_last_error(L"Invalid handle");
+int xaml_logview_scroll_to(XamlLogViewHandle log, uint64_t line) {
+    count_bridge_call();
+    if (!log) {
+        set_last_error(L"Invalid log view");
         return -1;
     }
 
     try {
-        auto& child_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(child);
-        auto frameworkElement = child_ptr->as<FrameworkElement>();
-        Grid::SetRowSpan(frameworkElement, row_span);
+        auto& state = *reinterpret_cast<std::shared_ptr<LogViewState>*>(log);
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->view.scroll_to(line);
+        arm_log_redraw(state);
         return 0;
     }
     catch (const hresult_error& e) {
@@ -2631,96 +6857,424 @@ int xaml_grid_set_child_row_span(XamlUIElementHandle child, int row_span) {
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_grid_set_child_row_span");
+        set_last_error(L"Unknown error in xaml_logview_scroll_to");
         return -1;
     }
 }
 
-int xaml_grid_set_child_column_span(XamlUIElementHandle child, int column_span) {
-    if (!child) {
-        set_last_error(L"Invalid handle");
+int xaml_logview_get_stats(XamlLogViewHandle log, XamlLogViewStats* stats_out) {
+    count_bridge_call();
+    if (!log || !stats_out) {
+        set_last_error(L"Invalid log view or stats pointer");
         return -1;
     }
 
+    auto& state = *reinterpret_cast<std::shared_ptr<LogViewState>*>(log);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    const xaml_bridge::LogBuffer& buffer = state->view.buffer();
+    stats_out->first_line = buffer.first_line();
+    stats_out->end_line = buffer.end_line();
+    stats_out->dropped_lines = buffer.dropped();
+    stats_out->top_line = state->view.top();
+    stats_out->visible_rows = static_cast<uint32_t>(state->view.rows());
+    stats_out->follow_tail = state->view.follows_tail() ? 1 : 0;
+    stats_out->appends = state->appends;
+    stats_out->redraws = state->redraws;
+    return 0;
+}
+
+XamlUIElementHandle xaml_logview_as_uielement(XamlLogViewHandle log) {
+    count_bridge_call();
+    if (!log) return nullptr;
+
     try {
-        auto& child_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(child);
-        auto frameworkElement = child_ptr->as<FrameworkElement>();
-        Grid::SetColumnSpan(frameworkElement, column_span);
-        return 0;
-    }
-    catch (const hresult_error& e) {
-        set_last_error(e.message().c_str());
-        return -1;
+        auto& state = *reinterpret_cast<std::shared_ptr<LogViewState>*>(log);
+        auto* handle = new std::shared_ptr<UIElement>(
+            std::make_shared<UIElement>(state->root.as<UIElement>())
+        );
+        return reinterpret_cast<XamlUIElementHandle>(handle);
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_grid_set_child_column_span");
-        return -1;
+        set_last_error(L"Error converting log view to UIElement");
+        return nullptr;
     }
 }
 
 // ============================================================================
-// ListView Implementation
+// View Model Implementation
 // ============================================================================
 
-XamlListViewHandle xaml_listview_create() {
-    try {
-        auto listview = std::make_shared<ListView>();
-        return reinterpret_cast<XamlListViewHandle>(new std::shared_ptr<ListView>(listview));
+constexpr uint32_t kViewModelIdleFrames = 30;
+
+// One slot as XAML sees it. UI thread only.
+struct ViewModelSlot {
+    hstring name;
+    IInspectable value{nullptr};                          // What bindings read
+    Data::PropertyChangedEventArgs changed{nullptr};      // Reused for every change
+    Data::ICustomProperty property{nullptr};
+};
+
+// The object bindings use as their Source. XAML resolves a binding path
+// through ICustomPropertyProvider, so slots need no compiled metadata.
+struct ViewModelObject : implements<ViewModelObject, Data::ICustomPropertyProvider, Data::INotifyPropertyChanged> {
+    std::vector<ViewModelSlot> slots;
+    std::unordered_map<hstring, uint32_t> slot_by_name;
+
+    Data::ICustomProperty GetCustomProperty(hstring const& name) {
+        auto it = slot_by_name.find(name);
+        if (it == slot_by_name.end()) {
+            return nullptr;
+        }
+        return slots[it->second].property;
+    }
+    Data::ICustomProperty GetIndexedProperty(hstring const&, Interop::TypeName const&) { return nullptr; }
+    hstring GetStringRepresentation() { return L"XamlViewModel"; }
+    Interop::TypeName Type() { return Interop::TypeName{L"XamlViewModel", Interop::TypeKind::Custom}; }
+
+    event_token PropertyChanged(Data::PropertyChangedEventHandler const& handler) { return m_property_changed.add(handler); }
+    void PropertyChanged(event_token const& token) noexcept { m_property_changed.remove(token); }
+
+    void raise(const ViewModelSlot& slot) { m_property_changed(*this, slot.changed); }
+
+private:
+    event<Data::PropertyChangedEventHandler> m_property_changed;
+};
+
+struct ViewModelProperty : implements<ViewModelProperty, Data::ICustomProperty> {
+    ViewModelProperty(hstring name, Interop::TypeName type, uint32_t slot)
+        : m_name(std::move(name)), m_type(std::move(type)), m_slot(slot) {}
+
+    Interop::TypeName Type() { return m_type; }
+    hstring Name() { return m_name; }
+    IInspectable GetValue(IInspectable const& target) {
+        return get_self<ViewModelObject>(target.as<Data::ICustomPropertyProvider>())->slots[m_slot].value;
+    }
+    void SetValue(IInspectable const&, IInspectable const&) { throw hresult_not_implemented(); }
+    IInspectable GetIndexedValue(IInspectable const&, IInspectable const&) { return nullptr; }
+    void SetIndexedValue(IInspectable const&, IInspectable const&, IInspectable const&) { throw hresult_not_implemented(); }
+    bool CanWrite() { return false; }
+    bool CanRead() { return true; }
+
+private:
+    hstring m_name;
+    Interop::TypeName m_type;
+    uint32_t m_slot;
+};
+
+// A value copied out of the table under the lock.
+struct PendingSlotValue {
+    uint32_t slot = 0;
+    double number = 0.0;
+    std::u16string text;
+};
+
+struct ViewModelState {
+    std::mutex mutex;                      // Guards everything up to `armed`
+    xaml_bridge::SlotTable table;
+    uint64_t writes = 0;
+    uint64_t changes = 0;
+    uint64_t notifications = 0;
+    uint64_t flushes = 0;
+    XamlViewModelFrameCallback frame_callback = nullptr;
+    void* frame_user_data = nullptr;
+    bool frame_requested = false;
+    uint32_t idle_frames = 0;
+    bool armed = false;                    // Rendering is subscribed or queued
+
+    // UI thread only.
+    com_ptr<ViewModelObject> object;
+    std::vector<uint32_t> changed;
+    std::vector<PendingSlotValue> pending;
+    Windows::System::DispatcherQueue queue{nullptr};
+    event_token rendering{};
+};
+
+void flush_view_model(ViewModelState& vm);
+
+// Caller holds vm->mutex. Same pacing as the log view: subscribe to
+// Rendering on the UI thread and drop it after a run of idle frames.
+void arm_view_model_flush(const std::shared_ptr<ViewModelState>& vm) {
+    vm->idle_frames = 0;
+    if (vm->armed) {
+        return;
+    }
+    vm->armed = true;
+    std::weak_ptr<ViewModelState> weak = vm;
+    auto subscribe = [weak] {
+        auto state = weak.lock();
+        if (!state || state->rendering) {
+            return;
+        }
+        state->rendering = CompositionTarget::Rendering([weak](const IInspectable&, const IInspectable&) {
+            if (auto state = weak.lock()) {
+                flush_view_model(*state);
+            }
+        });
+    };
+    if (Windows::System::DispatcherQueue::GetForCurrentThread() == vm->queue) {
+        subscribe();
+    } else if (!vm->queue.TryEnqueue(subscribe)) {
+        // Let the next write try again instead of staying armed without a
+        // subscription.
+        vm->armed = false;
+    }
+}
+
+IInspectable box_slot_value(xaml_bridge::SlotKind kind, const PendingSlotValue& value) {
+    switch (kind) {
+    case xaml_bridge::SlotKind::Integer: return box_value(static_cast<int32_t>(value.number));
+    case xaml_bridge::SlotKind::Boolean: return box_value(value.number != 0.0);
+    case xaml_bridge::SlotKind::Text:
+        return box_value(hstring(std::wstring_view(reinterpret_cast<const wchar_t*>(value.text.data()), value.text.size())));
+    default: return box_value(value.number);
+    }
+}
+
+// Rendering handler. Copies the changed values under the lock and raises
+// PropertyChanged after releasing it, since bindings update synchronously.
+void flush_view_model(ViewModelState& vm) {
+    XamlViewModelFrameCallback frame_callback = nullptr;
+    void* frame_user_data = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(vm.mutex);
+        if (vm.frame_requested) {
+            vm.frame_requested = false;
+            frame_callback = vm.frame_callback;
+            frame_user_data = vm.frame_user_data;
+        }
+    }
+    // Unlocked: the callback writes slots.
+    if (frame_callback) {
+        frame_callback(frame_user_data);
+    }
+
+    vm.changed.clear();
+    {
+        std::lock_guard<std::mutex> lock(vm.mutex);
+        if (!vm.table.has_changes()) {
+            if (++vm.idle_frames >= kViewModelIdleFrames) {
+                CompositionTarget::Rendering(vm.rendering);
+                vm.rendering = {};
+                vm.armed = false;
+            }
+            return;
+        }
+        vm.idle_frames = 0;
+        vm.table.take_changes(vm.changed);
+        if (vm.pending.size() < vm.changed.size()) {
+            vm.pending.resize(vm.changed.size());
+        }
+        for (size_t i = 0; i < vm.changed.size(); ++i) {
+            const uint32_t slot = vm.changed[i];
+            PendingSlotValue& value = vm.pending[i];
+            value.slot = slot;
+            value.number = vm.table.number(slot);
+            if (vm.table.kind(slot) == xaml_bridge::SlotKind::Text) {
+                value.text.assign(vm.table.text(slot));
+            }
+        }
+        vm.notifications += vm.changed.size();
+        ++vm.flushes;
+    }
+
+    ViewModelObject& object = *vm.object;
+    for (size_t i = 0; i < vm.changed.size(); ++i) {
+        const PendingSlotValue& value = vm.pending[i];
+        ViewModelSlot& slot = object.slots[value.slot];
+        // Slot kinds never change, and only this thread adds slots.
+        slot.value = box_slot_value(vm.table.kind(value.slot), value);
+        object.raise(slot);
+    }
+}
+
+Interop::TypeName slot_type_name(xaml_bridge::SlotKind kind) {
+    switch (kind) {
+    case xaml_bridge::SlotKind::Integer: return xaml_typename<int32_t>();
+    case xaml_bridge::SlotKind::Boolean: return xaml_typename<bool>();
+    case xaml_bridge::SlotKind::Text: return xaml_typename<hstring>();
+    default: return xaml_typename<double>();
+    }
+}
+
+// Returns nullptr when the element has no such property.
+DependencyProperty element_property(const UIElement& element, int property) {
+    switch (property) {
+    case XAML_PROP_TEXT:
+        if (element.try_as<TextBlock>()) return TextBlock::TextProperty();
+        if (element.try_as<TextBox>()) return TextBox::TextProperty();
+        break;
+    case XAML_PROP_CONTENT:
+        if (element.try_as<ContentControl>()) return ContentControl::ContentProperty();
+        break;
+    case XAML_PROP_VALUE:
+        if (element.try_as<Primitives::RangeBase>()) return Primitives::RangeBase::ValueProperty();
+        break;
+    case XAML_PROP_IS_CHECKED:
+        if (element.try_as<Primitives::ToggleButton>()) return Primitives::ToggleButton::IsCheckedProperty();
+        break;
+    case XAML_PROP_SELECTED_INDEX:
+        if (element.try_as<Primitives::Selector>()) return Primitives::Selector::SelectedIndexProperty();
+        break;
+    case XAML_PROP_IS_ENABLED:
+        if (element.try_as<Control>()) return Control::IsEnabledProperty();
+        break;
+    case XAML_PROP_OPACITY: return UIElement::OpacityProperty();
+    case XAML_PROP_WIDTH: return FrameworkElement::WidthProperty();
+    case XAML_PROP_HEIGHT: return FrameworkElement::HeightProperty();
+    case XAML_PROP_IS_ON:
+        if (element.try_as<ToggleSwitch>()) return ToggleSwitch::IsOnProperty();
+        break;
+    case XAML_PROP_HORIZONTAL_OFFSET:
+        if (element.try_as<ScrollViewer>()) return ScrollViewer::HorizontalOffsetProperty();
+        break;
+    case XAML_PROP_VERTICAL_OFFSET:
+        if (element.try_as<ScrollViewer>()) return ScrollViewer::VerticalOffsetProperty();
+        break;
+    }
+    return nullptr;
+}
+
+// The slot kind a property takes, or -1 for any.
+int element_property_kind(int property) {
+    switch (property) {
+    case XAML_PROP_TEXT: return XAML_SLOT_TEXT;
+    case XAML_PROP_CONTENT: return -1;
+    case XAML_PROP_IS_CHECKED:
+    case XAML_PROP_IS_ENABLED:
+    case XAML_PROP_IS_ON: return XAML_SLOT_BOOLEAN;
+    case XAML_PROP_SELECTED_INDEX: return XAML_SLOT_INTEGER;
+    default: return XAML_SLOT_NUMBER;
+    }
+}
+
+XamlViewModelHandle xaml_viewmodel_create() {
+    count_bridge_call();
+    try {
+        auto vm = std::make_shared<ViewModelState>();
+        vm->queue = Windows::System::DispatcherQueue::GetForCurrentThread();
+        if (!vm->queue) {
+            set_last_error(L"xaml_viewmodel_create must run on a UI thread");
+            return nullptr;
+        }
+        vm->object = make_self<ViewModelObject>();
+        return reinterpret_cast<XamlViewModelHandle>(new std::shared_ptr<ViewModelState>(vm));
     }
     catch (const hresult_error& e) {
         set_last_error(e.message().c_str());
         return nullptr;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_listview_create");
+        set_last_error(L"Unknown error in xaml_viewmodel_create");
         return nullptr;
     }
 }
 
-void xaml_listview_destroy(XamlListViewHandle listview) {
-    if (listview) {
-        delete reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+void xaml_viewmodel_destroy(XamlViewModelHandle vm) {
+    count_bridge_call();
+    if (!vm) {
+        return;
+    }
+    auto* handle = reinterpret_cast<std::shared_ptr<ViewModelState>*>(vm);
+    std::shared_ptr<ViewModelState> state = std::move(*handle);
+    delete handle;
+    try {
+        // Rendering belongs to the UI thread; off it, the revoke is queued
+        // there and keeps the state alive until it runs.
+        auto revoke = [state] {
+            if (state->rendering) {
+                CompositionTarget::Rendering(state->rendering);
+                state->rendering = {};
+            }
+        };
+        if (Windows::System::DispatcherQueue::GetForCurrentThread() == state->queue) {
+            revoke();
+        } else {
+            state->queue.TryEnqueue(revoke);
+        }
+    }
+    catch (...) {
+        // The handler holds the state weakly, so a missed revoke is harmless
     }
 }
 
-int xaml_listview_add_item(XamlListViewHandle listview, const wchar_t* item) {
-    if (!listview || !item) {
-        set_last_error(L"Invalid parameters in xaml_listview_add_item");
+int xaml_viewmodel_add_slot(XamlViewModelHandle vm, const wchar_t* name, int kind) {
+    count_bridge_call();
+    if (!vm || !name || !*name || kind < XAML_SLOT_NUMBER || kind > XAML_SLOT_TEXT) {
+        set_last_error(L"Invalid view model, slot name or slot kind");
         return -1;
     }
 
     try {
-        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
-        auto items = lv_ptr->Items();
-        items.Append(box_value(hstring(item)));
-        return 0;
+        auto& state = *reinterpret_cast<std::shared_ptr<ViewModelState>*>(vm);
+        ViewModelObject& object = *state->object;
+        hstring slot_name(name);
+        if (object.slot_by_name.count(slot_name)) {
+            set_last_error(L"The view model already has a slot named " + std::wstring(name));
+            return -1;
+        }
+
+        const auto slot_kind = static_cast<xaml_bridge::SlotKind>(kind);
+        uint32_t slot = 0;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            slot = state->table.add(slot_kind);
+        }
+        ViewModelSlot entry;
+        entry.name = slot_name;
+        entry.value = box_slot_value(slot_kind, PendingSlotValue{});
+        entry.changed = Data::PropertyChangedEventArgs(slot_name);
+        entry.property = make<ViewModelProperty>(slot_name, slot_type_name(slot_kind), slot);
+        object.slots.push_back(std::move(entry));
+        object.slot_by_name.emplace(slot_name, slot);
+        return static_cast<int>(slot);
     }
     catch (const hresult_error& e) {
         set_last_error(e.message().c_str());
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_listview_add_item");
+        set_last_error(L"Unknown error in xaml_viewmodel_add_slot");
         return -1;
     }
 }
 
-int xaml_listview_remove_item(XamlListViewHandle listview, int index) {
-    if (!listview || index < 0) {
-        set_last_error(L"Invalid parameters in xaml_listview_remove_item");
+int xaml_viewmodel_write(XamlViewModelHandle vm, const XamlSlotWrite* writes, int count) {
+    count_bridge_call();
+    if (!vm || count < 0 || (count > 0 && !writes)) {
+        set_last_error(L"Invalid view model or writes");
         return -1;
     }
 
     try {
-        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
-        auto items = lv_ptr->Items();
-
-        if (index >= static_cast<int>(items.Size())) {
-            set_last_error(L"Index out of range in xaml_listview_remove_item");
-            return -1;
+        auto& state = *reinterpret_cast<std::shared_ptr<ViewModelState>*>(vm);
+        std::lock_guard<std::mutex> lock(state->mutex);
+        const uint32_t slots = state->table.size();
+        for (int i = 0; i < count; ++i) {
+            if (writes[i].slot >= slots || writes[i].text_length < -1) {
+                set_last_error(L"Slot write " + std::to_wstring(i) + L" has an invalid slot or text length");
+                return -1;
+            }
         }
 
-        items.RemoveAt(index);
+        uint64_t changes = 0;
+        for (int i = 0; i < count; ++i) {
+            const XamlSlotWrite& write = writes[i];
+            if (state->table.kind(write.slot) != xaml_bridge::SlotKind::Text) {
+                changes += state->table.set_number(write.slot, write.number);
+                continue;
+            }
+            std::wstring_view text;
+            if (write.text) {
+                text = write.text_length < 0 ? std::wstring_view(write.text)
+                                             : std::wstring_view(write.text, static_cast<size_t>(write.text_length));
+            }
+            changes += state->table.set_text(write.slot, std::u16string_view(reinterpret_cast<const char16_t*>(text.data()), text.size()));
+        }
+        state->writes += static_cast<uint64_t>(count);
+        state->changes += changes;
+        if (changes > 0) {
+            arm_view_model_flush(state);
+        }
         return 0;
     }
     catch (const hresult_error& e) {
@@ -2728,20 +7282,53 @@ int xaml_listview_remove_item(XamlListViewHandle listview, int index) {
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_listview_remove_item");
+        set_last_error(L"Unknown error in xaml_viewmodel_write");
         return -1;
     }
 }
 
-int xaml_listview_clear_items(XamlListViewHandle listview) {
-    if (!listview) {
-        set_last_error(L"Invalid parameters in xaml_listview_clear_items");
+int xaml_viewmodel_bind(XamlViewModelHandle vm, uint32_t slot, XamlUIElementHandle element, int property) {
+    count_bridge_call();
+    if (!vm || !element) {
+        set_last_error(L"Invalid view model or element");
         return -1;
     }
 
     try {
-        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
-        lv_ptr->Items().Clear();
+        auto& state = *reinterpret_cast<std::shared_ptr<ViewModelState>*>(vm);
+        auto& elem_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(element);
+        ViewModelObject& object = *state->object;
+        if (slot >= object.slots.size()) {
+            set_last_error(L"Invalid slot");
+            return -1;
+        }
+        DependencyProperty dp = element_property(*elem_ptr, property);
+        if (!dp) {
+            set_last_error(L"The element does not have this property");
+            return -1;
+        }
+        if (property == XAML_PROP_HORIZONTAL_OFFSET || property == XAML_PROP_VERTICAL_OFFSET) {
+            set_last_error(L"ScrollViewer offsets are read-only");
+            return -1;
+        }
+        const int kind = element_property_kind(property);
+        if (kind >= 0 && kind != static_cast<int>(state->table.kind(slot))) {
+            set_last_error(L"The slot kind does not match the property");
+            return -1;
+        }
+
+        Data::Binding binding;
+        binding.Source(*state->object);
+        binding.Path(PropertyPath(object.slots[slot].name));
+        binding.Mode(Data::BindingMode::OneWay);
+        elem_ptr->as<FrameworkElement>().SetBinding(dp, binding);
+        // The binding owns the element's text now. A string table reload
+        // would replace it with a local value, and cached number text would
+        // suppress a later set_number that matches it.
+        forget_label_binding(*elem_ptr);
+        if (auto textblock = elem_ptr->try_as<TextBlock>()) {
+            forget_number_text(textblock);
+        }
         return 0;
     }
     catch (const hresult_error& e) {
@@ -2749,60 +7336,62 @@ int xaml_listview_clear_items(XamlListViewHandle listview) {
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_listview_clear_items");
+        set_last_error(L"Unknown error in xaml_viewmodel_bind");
         return -1;
     }
 }
 
-int xaml_listview_get_item_count(XamlListViewHandle listview) {
-    if (!listview) {
-        set_last_error(L"Invalid parameters in xaml_listview_get_item_count");
+int xaml_viewmodel_set_data_context(XamlViewModelHandle vm, XamlUIElementHandle element) {
+    count_bridge_call();
+    if (!vm || !element) {
+        set_last_error(L"Invalid view model or element");
         return -1;
     }
 
     try {
-        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
-        return static_cast<int>(lv_ptr->Items().Size());
+        auto& state = *reinterpret_cast<std::shared_ptr<ViewModelState>*>(vm);
+        auto& elem_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(element);
+        elem_ptr->as<FrameworkElement>().DataContext(*state->object);
+        return 0;
     }
     catch (const hresult_error& e) {
         set_last_error(e.message().c_str());
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_listview_get_item_count");
+        set_last_error(L"Unknown error in xaml_viewmodel_set_data_context");
         return -1;
     }
 }
 
-int xaml_listview_get_selected_index(XamlListViewHandle listview) {
-    if (!listview) {
-        set_last_error(L"Invalid parameters in xaml_listview_get_selected_index");
+int xaml_viewmodel_set_frame_callback(XamlViewModelHandle vm, XamlViewModelFrameCallback callback, void* user_data) {
+    count_bridge_call();
+    if (!vm) {
+        set_last_error(L"Invalid view model");
         return -1;
     }
 
-    try {
-        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
-        return lv_ptr->SelectedIndex();
-    }
-    catch (const hresult_error& e) {
-        set_last_error(e.message().c_str());
-        return -1;
-    }
-    catch (...) {
-        set_last_error(L"Unknown error in xaml_listview_get_selected_index");
-        return -1;
-    }
+    auto& state = *reinterpret_cast<std::shared_ptr<ViewModelState>*>(vm);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->frame_callback = callback;
+    state->frame_user_data = user_data;
+    return 0;
 }
 
-int xaml_listview_set_selected_index(XamlListViewHandle listview, int index) {
-    if (!listview) {
-        set_last_error(L"Invalid parameters in xaml_listview_set_selected_index");
+int xaml_viewmodel_request_frame(XamlViewModelHandle vm) {
+    count_bridge_call();
+    if (!vm) {
+        set_last_error(L"Invalid view model");
         return -1;
     }
 
     try {
-        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
-        lv_ptr->SelectedIndex(index);
+        auto& state = *reinterpret_cast<std::shared_ptr<ViewModelState>*>(vm);
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (!state->frame_requested) {
+            state->frame_requested = true;
+            arm_view_model_flush(state);
+        }
         return 0;
     }
     catch (const hresult_error& e) {
@@ -2810,92 +7399,237 @@ int xaml_listview_set_selected_index(XamlListViewHandle listview, int index) {
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_listview_set_selected_index");
+        set_last_error(L"Unknown error in xaml_viewmodel_request_frame");
         return -1;
     }
 }
 
-int xaml_listview_get_item(XamlListViewHandle listview, int index, wchar_t* buffer, int buffer_size) {
-    if (!listview || !buffer || buffer_size <= 0 || index < 0) {
-        set_last_error(L"Invalid parameters in xaml_listview_get_item");
+int xaml_viewmodel_get_stats(XamlViewModelHandle vm, XamlViewModelStats* stats) {
+    count_bridge_call();
+    if (!vm || !stats) {
+        set_last_error(L"Invalid view model or stats pointer");
         return -1;
     }
 
-    try {
-        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
-        auto items = lv_ptr->Items();
-
-        if (index >= static_cast<int>(items.Size())) {
-            set_last_error(L"Index out of range in xaml_listview_get_item");
-            return -1;
-        }
-
-        auto item = items.GetAt(index);
-        hstring item_str = unbox_value<hstring>(item);
+    auto& state = *reinterpret_cast<std::shared_ptr<ViewModelState>*>(vm);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    stats->slots = state->table.size();
+    stats->writes = state->writes;
+    stats->changes = state->changes;
+    stats->notifications = state->notifications;
+    stats->flushes = state->flushes;
+    return 0;
+}
 
-        int len = static_cast<int>(item_str.size());
-        if (len >= buffer_size) {
-            len = buffer_size - 1;
-        }
+// ============================================================================
+// Property Observation Implementation
+// ============================================================================
 
-        wcsncpy_s(buffer, buffer_size, item_str.c_str(), len);
-        return len;
-    }
-    catch (const hresult_error& e) {
-        set_last_error(e.message().c_str());
-        return -1;
+constexpr uint32_t kObserverIdleFrames = 30;
+
+// One xaml_observe_property registration. Its index is the queue's
+// observer id.
+struct PropertyObservation {
+    bool active = false;
+    weak_ref<DependencyObject> element;
+    DependencyProperty dp{nullptr};
+    int property = 0;
+    int kind = XAML_SLOT_NUMBER;
+    uint64_t tag = 0;
+    int64_t token = 0;
+    double last_number = 0.0;              // Value after the last change seen
+    std::u16string last_text;
+};
+
+using ObservationKey = std::tuple<void*, int, uint64_t>;   // Identity, property, tag
+
+// Everything here belongs to one UI thread.
+struct PropertyObserverState {
+    XamlPropertyChangeCallback callback = nullptr;
+    void* user_data = nullptr;
+    std::vector<PropertyObservation> observations;
+    std::vector<uint32_t> free_ids;
+    std::map<ObservationKey, uint32_t> ids;
+    size_t sweep_at = 256;
+    xaml_bridge::PropertyChangeQueue queue;
+    std::vector<xaml_bridge::PropertyChange> taken;
+    std::vector<XamlPropertyChange> delivered;
+    event_token rendering{};
+    uint32_t idle_frames = 0;
+};
+
+thread_local PropertyObserverState g_property_observer;
+
+double observed_number(const IInspectable& value, int kind) {
+    if (kind == XAML_SLOT_BOOLEAN) {
+        // IsChecked is a nullable bool; null is the indeterminate state.
+        auto boolean = value.try_as<Windows::Foundation::IReference<bool>>();
+        return boolean ? (boolean.Value() ? 1.0 : 0.0) : std::nan("");
+    }
+    if (kind == XAML_SLOT_INTEGER) {
+        return static_cast<double>(unbox_value_or<int32_t>(value, 0));
+    }
+    return unbox_value_or<double>(value, std::nan(""));
+}
+
+std::u16string_view observed_text(const IInspectable& value, hstring& holder) {
+    holder = unbox_value_or<hstring>(value, hstring());
+    return std::u16string_view(reinterpret_cast<const char16_t*>(holder.c_str()), holder.size());
+}
+
+void deliver_property_changes();
+
+void on_observed_property_changed(uint32_t id, const DependencyObject& sender) {
+    PropertyObserverState& observer = g_property_observer;
+    if (id >= observer.observations.size() || !observer.observations[id].active) {
+        return;
     }
-    catch (...) {
-        set_last_error(L"Unknown error in xaml_listview_get_item");
-        return -1;
+    PropertyObservation& observation = observer.observations[id];
+    const IInspectable value = sender.GetValue(observation.dp);
+    if (observation.kind == XAML_SLOT_TEXT) {
+        hstring holder;
+        const std::u16string_view text = observed_text(value, holder);
+        observer.queue.record(id, observation.last_text, text);
+        observation.last_text.assign(text);
+    } else {
+        const double number = observed_number(value, observation.kind);
+        observer.queue.record(id, observation.last_number, number);
+        observation.last_number = number;
+    }
+
+    observer.idle_frames = 0;
+    if (!observer.rendering) {
+        observer.rendering = CompositionTarget::Rendering([](const IInspectable&, const IInspectable&) {
+            deliver_property_changes();
+        });
     }
 }
 
-void xaml_listview_on_selection_changed(XamlListViewHandle listview, void* callback_ptr) {
-    if (!listview || !callback_ptr) {
+// Rendering handler: hand the frame's net changes to the observer in one call.
+void deliver_property_changes() {
+    PropertyObserverState& observer = g_property_observer;
+    if (observer.queue.empty()) {
+        if (++observer.idle_frames >= kObserverIdleFrames) {
+            CompositionTarget::Rendering(observer.rendering);
+            observer.rendering = {};
+        }
         return;
     }
+    observer.idle_frames = 0;
 
-    try {
-        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
-        auto callback = reinterpret_cast<void(*)(int)>(callback_ptr);
+    const size_t count = observer.queue.take(observer.taken);
+    if (!observer.callback || count == 0) {
+        return;
+    }
+    observer.delivered.clear();
+    for (size_t i = 0; i < count; ++i) {
+        const xaml_bridge::PropertyChange& change = observer.taken[i];
+        const PropertyObservation& observation = observer.observations[change.observer];
+        XamlPropertyChange entry{};
+        entry.tag = observation.tag;
+        entry.property = observation.property;
+        entry.kind = observation.kind;
+        if (change.is_text) {
+            entry.old_text = reinterpret_cast<const wchar_t*>(change.old_text.c_str());
+            entry.new_text = reinterpret_cast<const wchar_t*>(change.new_text.c_str());
+        } else {
+            entry.old_number = change.old_number;
+            entry.new_number = change.new_number;
+        }
+        observer.delivered.push_back(entry);
+    }
+    // The callback may observe, unobserve or change observed properties;
+    // none of that touches `taken` or `delivered` until the next frame.
+    observer.callback(observer.delivered.data(), static_cast<int>(observer.delivered.size()), observer.user_data);
+}
 
-        lv_ptr->SelectionChanged([callback, lv_ptr](auto&&, auto&&) {
-            callback(lv_ptr->SelectedIndex());
-        });
+void release_observation(PropertyObserverState& observer, uint32_t id) {
+    PropertyObservation& observation = observer.observations[id];
+    if (auto element = observation.element.get()) {
+        element.UnregisterPropertyChangedCallback(observation.dp, observation.token);
     }
-    catch (...) {
-        // Silently ignore errors in event registration
+    observer.queue.forget(id);
+    observation = PropertyObservation{};
+    observer.free_ids.push_back(id);
+}
+
+// Drop observations of elements that no longer exist.
+void sweep_observations(PropertyObserverState& observer) {
+    for (auto it = observer.ids.begin(); it != observer.ids.end();) {
+        if (observer.observations[it->second].element.get()) {
+            ++it;
+            continue;
+        }
+        release_observation(observer, it->second);
+        it = observer.ids.erase(it);
     }
+    observer.sweep_at = std::max<size_t>(256, observer.ids.size() * 2);
 }
 
-int xaml_listview_set_selection_mode(XamlListViewHandle listview, int mode) {
-    if (!listview) {
-        set_last_error(L"Invalid parameters in xaml_listview_set_selection_mode");
+int xaml_set_property_observer(XamlPropertyChangeCallback callback, void* user_data) {
+    count_bridge_call();
+    g_property_observer.callback = callback;
+    g_property_observer.user_data = user_data;
+    return 0;
+}
+
+int xaml_observe_property(XamlUIElementHandle element, int property, uint64_t tag) {
+    count_bridge_call();
+    if (!element) {
+        set_last_error(L"Invalid element handle");
         return -1;
     }
 
     try {
-        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
+        auto& elem_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(element);
+        const int kind = element_property_kind(property);
+        DependencyProperty dp = element_property(*elem_ptr, property);
+        if (!dp || kind < 0) {
+            set_last_error(L"The element does not have this property, or it cannot be observed");
+            return -1;
+        }
 
-        switch (mode) {
-            case 0:
-                lv_ptr->SelectionMode(ListViewSelectionMode::None);
-                break;
-            case 1:
-                lv_ptr->SelectionMode(ListViewSelectionMode::Single);
-                break;
-            case 2:
-                lv_ptr->SelectionMode(ListViewSelectionMode::Multiple);
-                break;
-            case 3:
-                lv_ptr->SelectionMode(ListViewSelectionMode::Extended);
-                break;
-            default:
-                set_last_error(L"Invalid selection mode in xaml_listview_set_selection_mode");
-                return -1;
+        PropertyObserverState& observer = g_property_observer;
+        const ObservationKey key{object_identity(*elem_ptr), property, tag};
+        auto existing = observer.ids.find(key);
+        if (existing != observer.ids.end()) {
+            if (observer.observations[existing->second].element.get()) {
+                return 0;
+            }
+            // A dead element whose identity has been reused.
+            release_observation(observer, existing->second);
+            observer.ids.erase(existing);
+        }
+        if (observer.ids.size() >= observer.sweep_at) {
+            sweep_observations(observer);
         }
 
+        uint32_t id = 0;
+        if (!observer.free_ids.empty()) {
+            id = observer.free_ids.back();
+            observer.free_ids.pop_back();
+        } else {
+            id = static_cast<uint32_t>(observer.observations.size());
+            observer.observations.emplace_back();
+        }
+        PropertyObservation& observation = observer.observations[id];
+        observation.element = make_weak(elem_ptr->as<DependencyObject>());
+        observation.dp = dp;
+        observation.property = property;
+        observation.kind = kind;
+        observation.tag = tag;
+        const IInspectable value = elem_ptr->GetValue(dp);
+        if (kind == XAML_SLOT_TEXT) {
+            hstring holder;
+            observation.last_text.assign(observed_text(value, holder));
+        } else {
+            observation.last_number = observed_number(value, kind);
+        }
+        observation.token = elem_ptr->RegisterPropertyChangedCallback(dp, [id](const DependencyObject& sender, const DependencyProperty&) {
+            on_observed_property_changed(id, sender);
+        });
+        observation.active = true;
+        observer.ids.emplace(key, id);
         return 0;
     }
     catch (const hresult_error& e) {
@@ -2903,23 +7637,37 @@ int xaml_listview_set_selection_mode(XamlListViewHandle listview, int mode) {
         return -1;
     }
     catch (...) {
-        set_last_error(L"Unknown error in xaml_listview_set_selection_mode");
+        set_last_error(L"Unknown error in xaml_observe_property");
         return -1;
     }
 }
 
-XamlUIElementHandle xaml_listview_as_uielement(XamlListViewHandle listview) {
-    if (!listview) {
-        return nullptr;
+int xaml_unobserve_property(XamlUIElementHandle element, int property, uint64_t tag) {
+    count_bridge_call();
+    if (!element) {
+        set_last_error(L"Invalid element handle");
+        return -1;
     }
 
     try {
-        auto& lv_ptr = *reinterpret_cast<std::shared_ptr<ListView>*>(listview);
-        UIElement ui_element = *lv_ptr;
-        return reinterpret_cast<XamlUIElementHandle>(new std::shared_ptr<UIElement>(std::make_shared<UIElement>(ui_element)));
+        auto& elem_ptr = *reinterpret_cast<std::shared_ptr<UIElement>*>(element);
+        PropertyObserverState& observer = g_property_observer;
+        auto it = observer.ids.find(ObservationKey{object_identity(*elem_ptr), property, tag});
+        if (it == observer.ids.end()) {
+            set_last_error(L"The property is not observed under this tag");
+            return -1;
+        }
+        release_observation(observer, it->second);
+        observer.ids.erase(it);
+        return 0;
+    }
+    catch (const hresult_error& e) {
+        set_last_error(e.message().c_str());
+        return -1;
     }
     catch (...) {
-        return nullptr;
+        set_last_error(L"Unknown error in xaml_unobserve_property");
+        return -1;
     }
 }
 
@@ -2928,6 +7676,7 @@ XamlUIElementHandle xaml_listview_as_uielement(XamlListViewHandle listview) {
 // ============================================================================
 
 void xaml_textbox_on_text_changed(XamlTextBoxHandle textbox, void* callback_ptr) {
+    count_bridge_call();
     if (!textbox || !callback_ptr) {
         return;
     }
@@ -35,6 +35,11 @@ typedef void* XamlControlTemplateHandle;
 typedef void* XamlStoryboardHandle;
 typedef void* XamlDoubleAnimationHandle;
 typedef void* XamlColorAnimationHandle;
+typedef void* XamlKeyFrameAnimationHandle;
+typedef void* XamlStoryboardTemplateHandle;
+typedef void* XamlStyleHandle;
+typedef void* XamlLogViewHandle;
+typedef void* XamlViewModelHandle;
 
 // Initialize the XAML framework for the current thread
 // Returns a handle that must be kept alive
@@ -63,6 +68,53 @@ XAML_ISLANDS_API int xaml_source_set_size(
     int height
 );
 
+// Hidden islands. When the host window is minimized or hidden (XamlRoot
+// IsHostVisible), or the host marks the source invisible, for example for a
+// background tab or an occluded window, the bridge pauses the source's
+// running storyboards and turns off its indeterminate progress bars. They
+// restart when the source is visible again.
+typedef struct XamlSourceActivity {
+    int32_t visible;
+    int32_t suspended;
+    uint32_t paused_storyboards;
+    uint32_t paused_progress_bars;
+    uint64_t suspensions;              // Times the source was suspended
+    uint64_t hidden_ms;                // Total time suspended
+    uint64_t suspended_animation_ms;   // Sum of hidden time x paused animations
+} XamlSourceActivity;
+
+// Host-side visibility; the source is suspended while this or the host
+// window says it is hidden.
+XAML_ISLANDS_API int xaml_source_set_visible(XamlSourceHandle source, int visible);
+XAML_ISLANDS_API int xaml_source_get_activity(XamlSourceHandle source, XamlSourceActivity* activity);
+
+// Frame pacing, recorded from CompositionTarget.Rendering while enabled.
+// Interval bucket upper bounds (ms): 6, 9, 12.5, 18, 25, 34.5, 51, 67.5,
+// 100, 250, then open-ended. Work buckets count bridge calls made on the UI
+// thread between two frames: 0, 1, 2-3, 4-7, ... 512-1023, 1024 and more.
+#define XAML_FRAME_INTERVAL_BUCKETS 11
+#define XAML_FRAME_WORK_BUCKETS 12
+
+typedef struct XamlFrameStats {
+    uint64_t frames;
+    uint64_t missed_frames;            // Intervals over 1.5x the refresh interval
+    uint64_t bridge_calls;             // Total over all recorded frames
+    double refresh_ms;                 // Estimated display refresh interval
+    double mean_interval_ms;
+    double max_interval_ms;
+    uint64_t interval_buckets[XAML_FRAME_INTERVAL_BUCKETS];
+    uint64_t work_buckets[XAML_FRAME_WORK_BUCKETS];
+} XamlFrameStats;
+
+// Subscribing to Rendering makes XAML render every frame, so stats are off
+// until enabled. Enabling again resets them. Frames and bridge calls belong
+// to the source's UI thread, not to the island itself. Islands that share a
+// thread record the same ticks and calls, differing only in when they were
+// enabled and while they were hidden.
+XAML_ISLANDS_API int xaml_source_enable_frame_stats(XamlSourceHandle source, int enabled);
+// Safe to call from any thread.
+XAML_ISLANDS_API int xaml_source_get_frame_stats(XamlSourceHandle source, XamlFrameStats* stats);
+
 // Create a WinRT Button
 XAML_ISLANDS_API XamlButtonHandle xaml_button_create();
 
@@ -105,14 +157,72 @@ XAML_ISLANDS_API void xaml_textblock_destroy(XamlTextBlockHandle textblock);
 XAML_ISLANDS_API int xaml_textblock_set_text(XamlTextBlockHandle textblock, const wchar_t* text);
 XAML_ISLANDS_API int xaml_textblock_set_font_size(XamlTextBlockHandle textblock, double size);
 
+// Rich text in one TextBlock. Each run styles text[start, start + length)
+// (UTF-16 offsets); runs must be in order and must not overlap. Text outside
+// every run keeps the TextBlock's own style. Replaces the current text.
+typedef struct XamlRunSpec {
+    int32_t start;
+    int32_t length;
+    uint32_t foreground;               // ARGB; 0 keeps the TextBlock's foreground
+    int32_t weight;                    // 100-900; 0 keeps the TextBlock's weight
+    int32_t italic;                    // Non-zero for italic
+} XamlRunSpec;
+
+XAML_ISLANDS_API int xaml_textblock_set_runs(
+    XamlTextBlockHandle textblock,
+    const wchar_t* text,
+    const XamlRunSpec* runs,
+    int count
+);
+
+// Numeric text. Formats `value` natively, without a UTF-16 conversion in
+// the caller, and skips the update when the text would not change. Pass NULL
+// for the shortest round-trip form with '.' as the decimal point.
+#define XAML_NUMBER_GROUPING  0x1      // Separate thousands in the integer part
+#define XAML_NUMBER_PLUS_SIGN 0x2      // Prefix positive values with '+'
+
+typedef struct XamlNumberFormat {
+    int32_t precision;                 // Fraction digits (0-17); -1 for the shortest round-trip form
+    int32_t flags;                     // XAML_NUMBER_* flags
+    wchar_t decimal_point;             // 0 for '.'
+    wchar_t group_separator;           // 0 for ','
+    const wchar_t* prefix;             // Optional, e.g. L"$"
+    const wchar_t* suffix;             // Optional, e.g. L" ms"
+} XamlNumberFormat;
+
+XAML_ISLANDS_API int xaml_textblock_set_number(
+    XamlTextBlockHandle textblock,
+    double value,
+    const XamlNumberFormat* format
+);
+
 // ===== TextBox APIs =====
 XAML_ISLANDS_API XamlTextBoxHandle xaml_textbox_create();
 XAML_ISLANDS_API void xaml_textbox_destroy(XamlTextBoxHandle textbox);
 XAML_ISLANDS_API int xaml_textbox_set_text(XamlTextBoxHandle textbox, const wchar_t* text);
+// Copies at most buffer_size - 1 characters plus a terminator and returns the text's full
+// length, so a result >= buffer_size means the text was truncated. buffer may be NULL when
+// buffer_size is 0 to query the length.
 XAML_ISLANDS_API int xaml_textbox_get_text(XamlTextBoxHandle textbox, wchar_t* buffer, int buffer_size);
+XAML_ISLANDS_API int xaml_textbox_get_text_length(XamlTextBoxHandle textbox);
 XAML_ISLANDS_API int xaml_textbox_set_placeholder(XamlTextBoxHandle textbox, const wchar_t* placeholder);
 XAML_ISLANDS_API int xaml_textbox_set_size(XamlTextBoxHandle textbox, double width, double height);
 
+// Incremental edits. Only the new text crosses into XAML, which edits its
+// text store in place instead of replacing the whole string. Positions and
+// lengths are UTF-16 units of the TextBox's text, where every line break is
+// a single '\r'. text_length is -1 when `text` is NUL-terminated. The
+// selection is kept, shifted by the edit; a selection overlapping the
+// replaced range collapses to the end of the new text.
+XAML_ISLANDS_API int xaml_textbox_append(XamlTextBoxHandle textbox, const wchar_t* text, int text_length);
+XAML_ISLANDS_API int xaml_textbox_replace_range(
+    XamlTextBoxHandle textbox,
+    int start,
+    int length,
+    const wchar_t* text,
+    int text_length
+);
+
 // ===== StackPanel APIs =====
 XAML_ISLANDS_API XamlStackPanelHandle xaml_stackpanel_create();
 XAML_ISLANDS_API void xaml_stackpanel_destroy(XamlStackPanelHandle panel);
@@ -241,11 +351,299 @@ XAML_ISLANDS_API int xaml_listview_clear_items(XamlListViewHandle listview);
 XAML_ISLANDS_API int xaml_listview_get_item_count(XamlListViewHandle listview);
 XAML_ISLANDS_API int xaml_listview_get_selected_index(XamlListViewHandle listview);
 XAML_ISLANDS_API int xaml_listview_set_selected_index(XamlListViewHandle listview, int index);
+// Copies at most buffer_size - 1 characters plus a terminator and returns the item's full
+// length, so a result >= buffer_size means the text was truncated. buffer may be NULL when
+// buffer_size is 0 to query the length.
 XAML_ISLANDS_API int xaml_listview_get_item(XamlListViewHandle listview, int index, wchar_t* buffer, int buffer_size);
 XAML_ISLANDS_API void xaml_listview_on_selection_changed(XamlListViewHandle listview, void* callback_ptr);
 XAML_ISLANDS_API int xaml_listview_set_selection_mode(XamlListViewHandle listview, int mode); // 0: None, 1: Single, 2: Multiple, 3: Extended
 XAML_ISLANDS_API XamlUIElementHandle xaml_listview_as_uielement(XamlListViewHandle listview);
 
+// ----- Native sort and filter views -----
+// The bridge keeps the text of every item added to a ListView. Sorting and
+// filtering compute a view over that store natively (in parallel for large
+// lists) and replace the visible items in a single collection reset. Index
+// arguments to the other ListView APIs refer to positions in the current view.
+
+typedef enum XamlSortKind {
+    XAML_SORT_TEXT = 0,              // Ordinal text comparison
+    XAML_SORT_TEXT_IGNORE_CASE = 1,  // Case-insensitive text comparison
+    XAML_SORT_NUMERIC = 2,           // First number in the text; items without one sort last
+    XAML_SORT_COLUMN = 3             // Host-provided column (xaml_listview_set_column_values)
+} XamlSortKind;
+
+typedef struct XamlSortKey {
+    int32_t kind;        // XamlSortKind
+    int32_t column;      // Column index for XAML_SORT_COLUMN
+    int32_t descending;  // Non-zero for descending order
+} XamlSortKey;
+
+typedef enum XamlFilterKind {
+    XAML_FILTER_NONE = 0,
+    XAML_FILTER_CONTAINS = 1,
+    XAML_FILTER_PREFIX = 2,
+    XAML_FILTER_EQUALS = 3,
+    XAML_FILTER_NUMERIC_RANGE = 4,   // First number in the text within [min, max]
+    XAML_FILTER_COLUMN_RANGE = 5     // Column value within [min, max]
+} XamlFilterKind;
+
+#define XAML_FILTER_IGNORE_CASE 0x1
+
+typedef struct XamlFilterSpec {
+    int32_t kind;          // XamlFilterKind
+    int32_t flags;         // XAML_FILTER_IGNORE_CASE
+    const wchar_t* text;   // Text for CONTAINS / PREFIX / EQUALS
+    double min;
+    double max;
+    int32_t column;        // Column index for XAML_FILTER_COLUMN_RANGE
+} XamlFilterSpec;
+
+// Sort by up to key_count keys (0 restores insertion order). Returns the number of visible items.
+XAML_ISLANDS_API int xaml_listview_set_sort(XamlListViewHandle listview, const XamlSortKey* keys, int key_count);
+// Apply a filter (NULL removes it). Returns the number of visible items.
+XAML_ISLANDS_API int xaml_listview_set_filter(XamlListViewHandle listview, const XamlFilterSpec* filter);
+// Set a numeric column used by XAML_SORT_COLUMN / XAML_FILTER_COLUMN_RANGE.
+// values[i] belongs to the i-th stored item (insertion order); missing values read as 0.
+XAML_ISLANDS_API int xaml_listview_set_column_values(XamlListViewHandle listview, int column, const double* values, int count);
+
+// ----- Grouped lists -----
+// Items are grouped natively by a host-provided key and shown under group headers.
+// Groups appear in order of first use, and items keep insertion order within a group.
+// While grouped, item indices (get_item, remove_item, export_items, search and
+// the selection APIs) are insertion positions, and sort and filter are unavailable. Clearing the items
+// returns the ListView to flat mode.
+
+// Replace the items with `count` items grouped by group_keys[i]. Returns the number of groups.
+XAML_ISLANDS_API int xaml_listview_set_grouped_items(XamlListViewHandle listview, const wchar_t* const* items, const wchar_t* const* group_keys, int count);
+// Append an item to a grouped ListView. Returns its index.
+XAML_ISLANDS_API int xaml_listview_add_grouped_item(XamlListViewHandle listview, const wchar_t* item, const wchar_t* group_key);
+// Move an item to another group; only the affected groups are updated.
+XAML_ISLANDS_API int xaml_listview_set_item_group(XamlListViewHandle listview, int index, const wchar_t* group_key);
+
+// ----- Bulk reads -----
+
+// Copy the text of visible items [start, start + count) back to back into buffer (no
+// terminators). offsets, if not NULL, receives count + 1 entries: where each item starts
+// and the total length. Returns the number of characters required; the text is copied
+// only when buffer is not NULL and capacity is large enough, so call once with
+// buffer = NULL to size it.
+XAML_ISLANDS_API int xaml_listview_export_items(XamlListViewHandle listview, int start, int count, wchar_t* buffer, size_t capacity, uint32_t* offsets);
+// Write up to capacity selected indices (ascending) to out_indices. Returns the total number
+// of selected items. Works in every selection mode.
+XAML_ISLANDS_API int xaml_listview_get_selected_indices(XamlListViewHandle listview, int* out_indices, int capacity);
+
+// Substring search over the stored items. Matching is vectorized, and a query
+// that extends the previous query only rescans the previous matches, so
+// calling this on every keystroke stays cheap.
+
+#define XAML_SEARCH_IGNORE_CASE 0x1
+#define XAML_SEARCH_APPLY_FILTER 0x2   // Also show only the matching items (XAML_FILTER_CONTAINS)
+
+// Writes up to `capacity` matching item indices (insertion order) to out_indices,
+// which may be NULL when capacity is 0. Returns the total number of matches.
+XAML_ISLANDS_API int xaml_listview_search(XamlListViewHandle listview, const wchar_t* query, int flags, int* out_indices, int capacity);
+
+// ============================================================================
+// Collection Change Batches
+// ============================================================================
+// Apply a batch of collection-change records to a ListView or ComboBox in one
+// call. Records are applied in order, and each index refers to the collection as
+// left by the previous record. The whole batch is validated first, so an invalid
+// record changes nothing. Small batches update the items one by one. Larger
+// batches, and any RESET, replace the items in one collection reset. Selection
+// is kept when the selected item survives.
+//
+// A ListView must not be sorted, filtered or grouped. A RESET drops the numeric
+// columns from xaml_listview_set_column_values.
+
+typedef enum XamlCollectionChangeKind {
+    XAML_CHANGE_INSERT = 0,    // Insert `count` items before `index`
+    XAML_CHANGE_REMOVE = 1,    // Remove `count` items starting at `index`
+    XAML_CHANGE_REPLACE = 2,   // Replace `count` items starting at `index`
+    XAML_CHANGE_MOVE = 3,      // Move the item at `index` to `new_index`
+    XAML_CHANGE_RESET = 4      // Replace all items with `count` items
+} XamlCollectionChangeKind;
+
+typedef struct XamlCollectionChange {
+    int32_t kind;                  // XamlCollectionChangeKind
+    int32_t index;
+    int32_t count;
+    int32_t new_index;             // XAML_CHANGE_MOVE only
+    const wchar_t* const* items;   // `count` strings for INSERT / REPLACE / RESET
+} XamlCollectionChange;
+
+XAML_ISLANDS_API int xaml_listview_apply_changes(XamlListViewHandle listview, const XamlCollectionChange* changes, int change_count);
+XAML_ISLANDS_API int xaml_combobox_apply_changes(XamlComboBoxHandle combobox, const XamlCollectionChange* changes, int change_count);
+
+// ============================================================================
+// Log View APIs
+// ============================================================================
+// An append-only log pane for thousands of lines per second. The newest
+// `capacity` lines live in a ring buffer, and only the lines that fit are
+// shown, in a pool of TextBlocks next to a ScrollBar. Appends may come from
+// any thread. They only store the lines; the view redraws at most once per
+// frame on its UI thread, and stops listening for frames while idle. The
+// view follows the tail by default. Scrolling up stops following, and
+// scrolling back to the last line resumes it.
+//
+// Line numbers count every line ever appended, so they stay valid as old
+// lines drop out of the ring.
+
+typedef struct XamlLogViewStats {
+    uint64_t first_line;               // Oldest stored line
+    uint64_t end_line;                 // One past the newest line (lines appended)
+    uint64_t dropped_lines;            // Lines pushed out of the ring
+    uint64_t top_line;                 // First visible line
+    uint32_t visible_rows;
+    int32_t follow_tail;
+    uint64_t appends;                  // xaml_logview_append calls
+    uint64_t redraws;                  // Frames that updated the rows
+} XamlLogViewStats;
+
+// Create on the UI thread.
+XAML_ISLANDS_API XamlLogViewHandle xaml_logview_create(int capacity);
+XAML_ISLANDS_API void xaml_logview_destroy(XamlLogViewHandle log);
+// `text` holds one or more '\n'-separated lines; length is in UTF-16 units,
+// or -1 when `text` is NUL-terminated. Lines over 4096 characters are cut.
+XAML_ISLANDS_API int xaml_logview_append(XamlLogViewHandle log, const wchar_t* text, int length);
+XAML_ISLANDS_API int xaml_logview_clear(XamlLogViewHandle log);
+XAML_ISLANDS_API int xaml_logview_set_follow_tail(XamlLogViewHandle log, int follow);
+// Scroll so `line` is the first visible line.
+XAML_ISLANDS_API int xaml_logview_scroll_to(XamlLogViewHandle log, uint64_t line);
+XAML_ISLANDS_API int xaml_logview_get_stats(XamlLogViewHandle log, XamlLogViewStats* stats);
+XAML_ISLANDS_API XamlUIElementHandle xaml_logview_as_uielement(XamlLogViewHandle log);
+
+// ============================================================================
+// String Tables
+// ============================================================================
+// Localized labels from a precompiled UTF-16 string table (file layout in
+// src/xaml_string_table.h). The bridge maps the file read-only, and each UI
+// thread caches one hstring per id it shows, so repeated labels are neither
+// transcoded nor copied. Loading another table, for example on a locale
+// change, relabels every live element the calling thread labelled by id.
+// Setting an element's text or content any other way drops its binding.
+
+typedef struct XamlStringTableInfo {
+    uint32_t count;                    // Ids in the active table; 0 when none is loaded
+    uint32_t bound_elements;           // Elements on this thread labelled by id
+    uint64_t generation;               // Incremented by every load and unload
+    uint64_t cache_hits;               // *_id calls served from a thread's cache
+    uint64_t cache_misses;             // *_id calls that built an hstring from the table
+    wchar_t locale[32];                // NUL-terminated; truncated if longer
+} XamlStringTableInfo;
+
+XAML_ISLANDS_API int xaml_string_table_load(const wchar_t* path);
+XAML_ISLANDS_API int xaml_string_table_unload();
+XAML_ISLANDS_API int xaml_string_table_get_info(XamlStringTableInfo* info);
+XAML_ISLANDS_API int xaml_button_set_content_id(XamlButtonHandle button, uint32_t id);
+XAML_ISLANDS_API int xaml_textblock_set_text_id(XamlTextBlockHandle textblock, uint32_t id);
+
+// ============================================================================
+// View Model APIs
+// ============================================================================
+// A view model is a native object with typed, named slots that XAML binds to.
+// The host writes any number of slots in one call from any thread; on the
+// next frame the bridge raises PropertyChanged once for each slot whose value
+// changed, and XAML's binding engine updates every element bound to it.
+// Bindings are one-way, from slot to element.
+
+typedef enum XamlSlotKind {
+    XAML_SLOT_NUMBER = 0,                // double
+    XAML_SLOT_INTEGER = 1,               // int32; written numbers are rounded
+    XAML_SLOT_BOOLEAN = 2,               // Written numbers other than 0 and NaN are true
+    XAML_SLOT_TEXT = 3
+} XamlSlotKind;
+
+// Element properties that slots bind to and that can be observed. The slot
+// kind of each is given in brackets; Content takes any kind and cannot be
+// observed. The ScrollViewer offsets are read-only, so they cannot be bound.
+typedef enum XamlElementProperty {
+    XAML_PROP_TEXT = 0,                  // [text] TextBlock, TextBox
+    XAML_PROP_CONTENT = 1,               // [any] Button, CheckBox, RadioButton
+    XAML_PROP_VALUE = 2,                 // [number] Slider, ProgressBar
+    XAML_PROP_IS_CHECKED = 3,            // [boolean] CheckBox, RadioButton
+    XAML_PROP_SELECTED_INDEX = 4,        // [integer] ComboBox, ListView
+    XAML_PROP_IS_ENABLED = 5,            // [boolean] Controls
+    XAML_PROP_OPACITY = 6,               // [number] Any element
+    XAML_PROP_WIDTH = 7,                 // [number] Any element
+    XAML_PROP_HEIGHT = 8,                // [number] Any element
+    XAML_PROP_IS_ON = 9,                 // [boolean] ToggleSwitch
+    XAML_PROP_HORIZONTAL_OFFSET = 10,    // [number] ScrollViewer
+    XAML_PROP_VERTICAL_OFFSET = 11       // [number] ScrollViewer
+} XamlElementProperty;
+
+typedef struct XamlSlotWrite {
+    uint32_t slot;
+    int32_t text_length;                 // UTF-16 units in `text`, or -1 if NUL-terminated
+    double number;                       // Number, integer and boolean slots
+    const wchar_t* text;                 // Text slots; NULL writes the empty string
+} XamlSlotWrite;
+
+typedef struct XamlViewModelStats {
+    uint32_t slots;
+    uint64_t writes;                     // Slot writes received
+    uint64_t changes;                    // Writes that changed a slot's value
+    uint64_t notifications;              // PropertyChanged events raised
+    uint64_t flushes;                    // Frames that raised any
+} XamlViewModelStats;
+
+// Create on a UI thread. Slots start at 0, false or the empty string.
+XAML_ISLANDS_API XamlViewModelHandle xaml_viewmodel_create();
+// Any thread. Bound elements keep showing the last values.
+XAML_ISLANDS_API void xaml_viewmodel_destroy(XamlViewModelHandle vm);
+// UI thread. Returns the new slot's index, or -1. Markup bindings refer to
+// the slot by `name` when the view model is an element's DataContext.
+XAML_ISLANDS_API int xaml_viewmodel_add_slot(XamlViewModelHandle vm, const wchar_t* name, int kind);
+// Any thread. All writes are checked before any is applied.
+XAML_ISLANDS_API int xaml_viewmodel_write(XamlViewModelHandle vm, const XamlSlotWrite* writes, int count);
+// UI thread. Replaces any binding or local value of the property.
+XAML_ISLANDS_API int xaml_viewmodel_bind(XamlViewModelHandle vm, uint32_t slot, XamlUIElementHandle element, int property);
+// UI thread. Lets `{Binding SlotName}` in markup loaded under `element` read
+// the view model.
+XAML_ISLANDS_API int xaml_viewmodel_set_data_context(XamlViewModelHandle vm, XamlUIElementHandle element);
+XAML_ISLANDS_API int xaml_viewmodel_get_stats(XamlViewModelHandle vm, XamlViewModelStats* stats);
+
+// Frame hook for hosts that stage their own writes, so that any number of
+// model changes per frame cost one write call. After
+// xaml_viewmodel_request_frame, the next frame calls `callback(user_data)` on
+// the UI thread before changed slots notify; writes made from it show in
+// that frame. NULL removes the callback. A call already under way is not
+// waited for, so change or remove the callback on the UI thread before
+// freeing `user_data`.
+typedef void (*XamlViewModelFrameCallback)(void* user_data);
+XAML_ISLANDS_API int xaml_viewmodel_set_frame_callback(XamlViewModelHandle vm, XamlViewModelFrameCallback callback, void* user_data);
+// Any thread. Requests after the first in a frame do nothing.
+XAML_ISLANDS_API int xaml_viewmodel_request_frame(XamlViewModelHandle vm);
+
+// ============================================================================
+// Property Observation APIs
+// ============================================================================
+// Report user-driven changes of properties that have no dedicated event, such
+// as ComboBox.SelectedIndex or ScrollViewer offsets. Observations belong to
+// the UI thread that made them. Changes are coalesced per frame: the
+// thread's observer is called at most once per frame with one entry per
+// observed property whose value differs from the previous frame.
+
+typedef struct XamlPropertyChange {
+    uint64_t tag;                        // As passed to xaml_observe_property
+    int32_t property;                    // XamlElementProperty
+    int32_t kind;                        // XamlSlotKind of the values
+    double old_number;                   // Non-text kinds. Booleans are 0 or 1,
+    double new_number;                   // or NaN for an indeterminate CheckBox
+    const wchar_t* old_text;             // Text kind, NUL-terminated; NULL otherwise.
+    const wchar_t* new_text;             // Valid only during the callback.
+} XamlPropertyChange;
+
+typedef void (*XamlPropertyChangeCallback)(const XamlPropertyChange* changes, int count, void* user_data);
+
+// Set the calling UI thread's observer; NULL stops delivery. Changes that
+// happen while no observer is set are dropped.
+XAML_ISLANDS_API int xaml_set_property_observer(XamlPropertyChangeCallback callback, void* user_data);
+// Observing the same element, property and tag again does nothing. One
+// property can be observed under several tags.
+XAML_ISLANDS_API int xaml_observe_property(XamlUIElementHandle element, int property, uint64_t tag);
+XAML_ISLANDS_API int xaml_unobserve_property(XamlUIElementHandle element, int property, uint64_t tag);
+
 // ============================================================================
 // Resource Dictionary APIs
 // ============================================================================
@@ -297,15 +695,98 @@ XAML_ISLANDS_API int xaml_uielement_set_resources(
 
 XAML_ISLANDS_API XamlControlTemplateHandle xaml_control_template_create();
 XAML_ISLANDS_API void xaml_control_template_destroy(XamlControlTemplateHandle template_handle);
+// Always fails: XAML templates can only be built from markup. Use
+// xaml_control_template_from_markup.
 XAML_ISLANDS_API int xaml_control_template_set_content(
     XamlControlTemplateHandle template_handle,
     XamlUIElementHandle content
 );
+// Parse a <ControlTemplate> with XamlReader. Markup without an xmlns gets the
+// default XAML namespaces. Parsed templates are cached per UI thread by their
+// markup, so every handle for the same markup shares one template; destroying
+// a handle leaves the cached template in place. The cache holds up to 256
+// templates and evicts the least recently used.
+XAML_ISLANDS_API XamlControlTemplateHandle xaml_control_template_from_markup(const wchar_t* markup);
 XAML_ISLANDS_API int xaml_button_set_template(
     XamlButtonHandle button,
     XamlControlTemplateHandle template_handle
 );
 
+// Every count is the calling thread's, like the cache itself.
+typedef struct XamlTemplateCacheStats {
+    uint64_t hits;                     // from_markup calls served from the cache
+    uint64_t misses;                   // from_markup calls that parsed markup
+    uint32_t cached_templates;         // Templates cached on the calling thread
+} XamlTemplateCacheStats;
+
+XAML_ISLANDS_API int xaml_control_template_get_cache_stats(XamlTemplateCacheStats* stats);
+// Drop the calling thread's cached templates; buttons keep theirs.
+XAML_ISLANDS_API int xaml_control_template_clear_cache();
+
+// ============================================================================
+// Style APIs
+// ============================================================================
+
+// A Style holds property values that any number of elements share. Styling
+// thousands of elements with one Style costs one call per element instead of
+// one per property, and XAML keeps a single copy of each value instead of a
+// local value per element. Local values set with the per-control setters
+// still take precedence over the style.
+
+typedef enum XamlStyleTarget {
+    XAML_STYLE_BUTTON = 0,
+    XAML_STYLE_TEXTBLOCK = 1,
+    XAML_STYLE_TEXTBOX = 2,
+    XAML_STYLE_STACKPANEL = 3,
+    XAML_STYLE_GRID = 4,
+    XAML_STYLE_CHECKBOX = 5,
+    XAML_STYLE_COMBOBOX = 6,
+    XAML_STYLE_SLIDER = 7,
+    XAML_STYLE_PROGRESSBAR = 8,
+    XAML_STYLE_RADIOBUTTON = 9,
+    XAML_STYLE_LISTVIEW = 10,
+    XAML_STYLE_SCROLLVIEWER = 11,
+    XAML_STYLE_IMAGE = 12
+} XamlStyleTarget;
+
+// The XamlStyleValue field each property reads is given in brackets.
+typedef enum XamlStyleProperty {
+    XAML_STYLE_BACKGROUND = 0,           // [color] Controls and panels
+    XAML_STYLE_FOREGROUND = 1,           // [color] Controls and TextBlock
+    XAML_STYLE_BORDER_BRUSH = 2,         // [color] Controls and panels
+    XAML_STYLE_BORDER_THICKNESS = 3,     // [left, top, right, bottom] Controls and panels
+    XAML_STYLE_CORNER_RADIUS = 4,        // [number] Controls and panels
+    XAML_STYLE_PADDING = 5,              // [left, top, right, bottom] Controls, panels and TextBlock
+    XAML_STYLE_MARGIN = 6,               // [left, top, right, bottom]
+    XAML_STYLE_WIDTH = 7,                // [number]
+    XAML_STYLE_HEIGHT = 8,               // [number]
+    XAML_STYLE_OPACITY = 9,              // [number]
+    XAML_STYLE_FONT_SIZE = 10,           // [number] Controls and TextBlock
+    XAML_STYLE_FONT_WEIGHT = 11,         // [number] 400=Normal, 700=Bold; controls and TextBlock
+    XAML_STYLE_HORIZONTAL_ALIGNMENT = 12, // [number] 0: Left, 1: Center, 2: Right, 3: Stretch
+    XAML_STYLE_VERTICAL_ALIGNMENT = 13   // [number] 0: Top, 1: Center, 2: Bottom, 3: Stretch
+} XamlStyleProperty;
+
+typedef struct XamlStyleValue {
+    uint32_t color;                      // ARGB
+    double number;
+    double left;
+    double top;
+    double right;
+    double bottom;
+} XamlStyleValue;
+
+XAML_ISLANDS_API XamlStyleHandle xaml_style_create(int target_type);
+XAML_ISLANDS_API void xaml_style_destroy(XamlStyleHandle style);
+// Fails for properties the target type does not have, and once the style has
+// been applied: XAML seals a style on first use.
+XAML_ISLANDS_API int xaml_style_add_setter(XamlStyleHandle style, int property, const XamlStyleValue* value);
+// The element must be of the style's target type. A NULL style clears it.
+XAML_ISLANDS_API int xaml_element_set_style(XamlUIElementHandle element, XamlStyleHandle style);
+// Style every element in one call. All handles are checked before any
+// element is styled.
+XAML_ISLANDS_API int xaml_apply_style(XamlStyleHandle style, const XamlUIElementHandle* elements, int count);
+
 // ============================================================================
 // Animation APIs
 // ============================================================================
@@ -330,6 +811,15 @@ XAML_ISLANDS_API int xaml_storyboard_set_target(
     XamlUIElementHandle target
 );
 
+// Call `callback(user_data)` on the UI thread each time the storyboard runs to
+// completion (not when it is stopped). Callbacks run after the storyboard has
+// left the running counts, so they may begin, recycle or restart it.
+XAML_ISLANDS_API int xaml_storyboard_on_completed(
+    XamlStoryboardHandle storyboard,
+    void (*callback)(void* user_data),
+    void* user_data
+);
+
 // DoubleAnimation APIs
 XAML_ISLANDS_API XamlDoubleAnimationHandle xaml_double_animation_create();
 XAML_ISLANDS_API void xaml_double_animation_destroy(XamlDoubleAnimationHandle animation);
@@ -354,6 +844,224 @@ XAML_ISLANDS_API int xaml_color_animation_set_target_property(
     const wchar_t* property_path
 );
 
+// Keyframe animations (DoubleAnimationUsingKeyFrames / ColorAnimationUsingKeyFrames)
+//
+// Each key eases from the previous key's value with its XamlKeyFrameKind. Eased
+// kinds become KeySpline keyframes (InOut curves between two keys are split
+// into In and Out halves for a closer fit); BACK, ELASTIC and BOUNCE overshoot,
+// so they keep an easing function instead.
+typedef enum XamlKeyFrameKind {
+    XAML_KEYFRAME_LINEAR = 0,
+    XAML_KEYFRAME_DISCRETE = 1,
+    XAML_KEYFRAME_EASE_IN_SINE = 2,
+    XAML_KEYFRAME_EASE_OUT_SINE = 3,
+    XAML_KEYFRAME_EASE_IN_OUT_SINE = 4,
+    XAML_KEYFRAME_EASE_IN_QUAD = 5,
+    XAML_KEYFRAME_EASE_OUT_QUAD = 6,
+    XAML_KEYFRAME_EASE_IN_OUT_QUAD = 7,
+    XAML_KEYFRAME_EASE_IN_CUBIC = 8,
+    XAML_KEYFRAME_EASE_OUT_CUBIC = 9,
+    XAML_KEYFRAME_EASE_IN_OUT_CUBIC = 10,
+    XAML_KEYFRAME_EASE_IN_QUART = 11,
+    XAML_KEYFRAME_EASE_OUT_QUART = 12,
+    XAML_KEYFRAME_EASE_IN_OUT_QUART = 13,
+    XAML_KEYFRAME_EASE_IN_QUINT = 14,
+    XAML_KEYFRAME_EASE_OUT_QUINT = 15,
+    XAML_KEYFRAME_EASE_IN_OUT_QUINT = 16,
+    XAML_KEYFRAME_EASE_IN_EXPO = 17,
+    XAML_KEYFRAME_EASE_OUT_EXPO = 18,
+    XAML_KEYFRAME_EASE_IN_OUT_EXPO = 19,
+    XAML_KEYFRAME_EASE_IN_CIRC = 20,
+    XAML_KEYFRAME_EASE_OUT_CIRC = 21,
+    XAML_KEYFRAME_EASE_IN_OUT_CIRC = 22,
+    XAML_KEYFRAME_EASE_IN_BACK = 23,
+    XAML_KEYFRAME_EASE_OUT_BACK = 24,
+    XAML_KEYFRAME_EASE_IN_OUT_BACK = 25,
+    XAML_KEYFRAME_EASE_IN_ELASTIC = 26,
+    XAML_KEYFRAME_EASE_OUT_ELASTIC = 27,
+    XAML_KEYFRAME_EASE_IN_OUT_ELASTIC = 28,
+    XAML_KEYFRAME_EASE_IN_BOUNCE = 29,
+    XAML_KEYFRAME_EASE_OUT_BOUNCE = 30,
+    XAML_KEYFRAME_EASE_IN_OUT_BOUNCE = 31
+} XamlKeyFrameKind;
+
+XAML_ISLANDS_API XamlKeyFrameAnimationHandle xaml_double_keyframe_animation_create();
+XAML_ISLANDS_API XamlKeyFrameAnimationHandle xaml_color_keyframe_animation_create();
+XAML_ISLANDS_API void xaml_keyframe_animation_destroy(XamlKeyFrameAnimationHandle animation);
+// Replace all keyframes in one call. `times` are milliseconds from the start.
+// `values` holds one value per key for double animations, or four (A, R, G, B
+// from 0 to 255) for color animations. `kinds` may be NULL for linear keys.
+XAML_ISLANDS_API int xaml_keyframes_set(
+    XamlKeyFrameAnimationHandle animation,
+    const float* times,
+    const float* values,
+    const uint8_t* kinds,
+    int count
+);
+XAML_ISLANDS_API int xaml_keyframe_animation_set_target_property(
+    XamlKeyFrameAnimationHandle animation,
+    XamlUIElementHandle target,
+    const wchar_t* property_path
+);
+XAML_ISLANDS_API int xaml_storyboard_add_keyframe_animation(
+    XamlStoryboardHandle storyboard,
+    XamlKeyFrameAnimationHandle animation
+);
+
+// Storyboard templates
+//
+// A template holds the description of a storyboard's animations. Instantiating
+// it for a target builds the whole storyboard natively in one call, reusing a
+// recycled storyboard from the template's pool when one is available.
+
+typedef enum XamlAnimKind {
+    XAML_ANIM_DOUBLE = 0,
+    XAML_ANIM_COLOR = 1
+} XamlAnimKind;
+
+#define XAML_ANIM_HAS_FROM 0x1   // Otherwise the animation starts from the current value
+
+typedef struct XamlAnimSpec {
+    int32_t kind;                  // XamlAnimKind
+    int32_t flags;                 // XAML_ANIM_* flags
+    const wchar_t* property_path;  // Storyboard.TargetProperty syntax
+    double from;                   // XAML_ANIM_DOUBLE
+    double to;
+    uint32_t from_color;           // XAML_ANIM_COLOR, ARGB
+    uint32_t to_color;
+    int32_t duration_ms;
+    int32_t begin_ms;              // Start offset within the storyboard
+    int32_t easing;                // XamlKeyFrameKind other than DISCRETE; LINEAR for none
+} XamlAnimSpec;
+
+XAML_ISLANDS_API XamlStoryboardTemplateHandle xaml_storyboard_template_create(const XamlAnimSpec* animations, int count);
+XAML_ISLANDS_API void xaml_storyboard_template_destroy(XamlStoryboardTemplateHandle template_handle);
+// Returns a storyboard targeting `target`. Destroy it with xaml_storyboard_destroy
+// or hand it back with xaml_storyboard_template_recycle.
+XAML_ISLANDS_API XamlStoryboardHandle xaml_storyboard_instantiate(
+    XamlStoryboardTemplateHandle template_handle,
+    XamlUIElementHandle target
+);
+// Stop the storyboard and keep it for the next instantiate call. Takes
+// ownership of the handle. The pool keeps up to 32 storyboards per template.
+// Fails for storyboards this template did not instantiate or that were
+// already recycled.
+XAML_ISLANDS_API int xaml_storyboard_template_recycle(
+    XamlStoryboardTemplateHandle template_handle,
+    XamlStoryboardHandle storyboard
+);
+// Number of storyboards waiting in the pool
+XAML_ISLANDS_API int xaml_storyboard_template_pooled_count(XamlStoryboardTemplateHandle template_handle);
+
+// Build one storyboard that applies every animation to every target. Target i
+// starts i * stagger_ms after the animation's own begin_ms. The storyboard is
+// not started; destroy it with xaml_storyboard_destroy.
+XAML_ISLANDS_API XamlStoryboardHandle xaml_animate_staggered(
+    const XamlUIElementHandle* targets,
+    int target_count,
+    const XamlAnimSpec* animations,
+    int animation_count,
+    int stagger_ms
+);
+
+// Storyboard animations on Opacity, RenderTransform, Projection, Clip,
+// Canvas.Left/Top or a SolidColorBrush color run on the compositor thread.
+// Any other target, such as Width, Height or Margin, is a dependent animation
+// that runs on the UI thread. Returns how many of the storyboard's animations
+// are dependent and writes up to `capacity` of their child indices.
+XAML_ISLANDS_API int xaml_storyboard_get_dependent_animations(
+    XamlStoryboardHandle storyboard,
+    int* out_indices,
+    int capacity
+);
+
+// ============================================================================
+// Composition Animations
+// ============================================================================
+// Keyframe animations on an element's composition Visual. They run on the
+// compositor thread, so they stay smooth while the UI thread is busy. OFFSET
+// animates the visual's Translation, which leaves the layout position alone.
+// SCALE and ROTATION pivot around the element's center.
+
+typedef enum XamlVisualProperty {
+    XAML_VISUAL_OFFSET = 0,    // value[0..2]: x, y, z in pixels
+    XAML_VISUAL_SCALE = 1,     // value[0..2]: x, y, z factors
+    XAML_VISUAL_OPACITY = 2,   // value[0]: 0.0 to 1.0
+    XAML_VISUAL_ROTATION = 3,  // value[0]: degrees, clockwise
+    XAML_VISUAL_CLIP = 4       // value[0..3]: left, top, right, bottom insets in pixels
+} XamlVisualProperty;
+
+typedef struct XamlVisualKeyFrame {
+    float progress;            // 0.0 to 1.0 through the duration
+    float value[4];
+} XamlVisualKeyFrame;
+
+typedef struct XamlVisualAnimation {
+    int32_t property;                      // XamlVisualProperty
+    int32_t duration_ms;
+    int32_t delay_ms;
+    int32_t iterations;                    // 0 repeats forever
+    const XamlVisualKeyFrame* keyframes;
+    int32_t keyframe_count;
+} XamlVisualAnimation;
+
+// Start an animation, replacing any running animation of the same property.
+XAML_ISLANDS_API int xaml_element_start_animation(XamlUIElementHandle element, const XamlVisualAnimation* animation);
+XAML_ISLANDS_API int xaml_element_stop_animation(XamlUIElementHandle element, int property);
+// Start the same animation on each element, delaying element i by i * stagger_ms.
+XAML_ISLANDS_API int xaml_element_animate_staggered(
+    const XamlUIElementHandle* elements,
+    int element_count,
+    const XamlVisualAnimation* animation,
+    int stagger_ms
+);
+
+// Drive a visual property of `target` from the scroll position of
+// `scrollviewer` with a composition ExpressionAnimation. The expression can
+// read the viewer's manipulation property set as "scroll"; scroll.Translation
+// is the negated scroll offset. OFFSET and SCALE expressions produce a
+// Vector3, OPACITY and ROTATION a scalar; CLIP is not supported. The binding
+// runs on the compositor thread until xaml_element_stop_animation removes it.
+// Example parallax: L"Vector3(0, -scroll.Translation.Y * 0.5, 0)".
+XAML_ISLANDS_API int xaml_bind_scroll_expression(
+    XamlScrollViewerHandle scrollviewer,
+    XamlUIElementHandle target,
+    int property,
+    const wchar_t* expression
+);
+
+// Implicit animations run whenever layout or visibility changes the element,
+// with no further bridge calls. OFFSET and SIZE ease the element's visual to
+// the position and size that layout gives it; SHOW and HIDE fade it in and out
+// when its Visibility changes or it enters or leaves the tree.
+#define XAML_IMPLICIT_OFFSET 0x1
+#define XAML_IMPLICIT_SIZE   0x2
+#define XAML_IMPLICIT_SHOW   0x4
+#define XAML_IMPLICIT_HIDE   0x8
+
+// Replace the element's implicit animations; flags 0 removes them.
+// duration_ms <= 0 uses 250 ms.
+XAML_ISLANDS_API int xaml_element_set_implicit_animations(XamlUIElementHandle element, int flags, int duration_ms);
+
+// Counts since the bridge was loaded. Storyboard animations are classified
+// when xaml_storyboard_begin runs. The active_* fields and running_storyboards
+// cover storyboards between xaml_storyboard_begin and completion or stop.
+typedef struct XamlAnimationStats {
+    uint64_t composition_started;      // xaml_element_start_animation calls
+    uint64_t storyboard_independent;   // Storyboard animations on the compositor thread
+    uint64_t storyboard_dependent;     // Storyboard animations on the UI thread
+    uint64_t storyboards_completed;    // Storyboards that ran to completion
+    uint64_t running_storyboards;      // Storyboards currently running
+    uint64_t active_animations;        // Animations in running storyboards
+    uint64_t active_dependent;         // ... of which run on the UI thread
+} XamlAnimationStats;
+
+XAML_ISLANDS_API int xaml_animation_get_stats(XamlAnimationStats* stats);
+
+// Cap the animations running in storyboards at once; 0 removes the cap.
+// xaml_storyboard_begin fails instead of exceeding it.
+XAML_ISLANDS_API int xaml_animation_set_active_limit(int max_active_animations);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,371 @@
+#include "xaml_list_model.h"
+#include "xaml_parallel.h"
+#include "xaml_text.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <numeric>
+
+namespace xaml_bridge {
+
+namespace {
+
+// Three-way compare where NaN (no number) sorts after every real value.
+int compare_numbers(double a, double b) noexcept {
+    const bool a_nan = std::isnan(a);
+    const bool b_nan = std::isnan(b);
+    if (a_nan || b_nan) {
+        return a_nan == b_nan ? 0 : (a_nan ? 1 : -1);
+    }
+    return a < b ? -1 : (b < a ? 1 : 0);
+}
+
+bool folded_equals(std::u16string_view text, std::u16string_view folded_needle) noexcept {
+    if (text.size() != folded_needle.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < text.size(); ++i) {
+        if (fold_case(text[i]) != folded_needle[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+size_t ListModel::append(std::u16string text) {
+    const size_t index = m_items.size();
+    m_items.push_back(std::move(text));
+    m_search_valid = false;
+    for (auto& column : m_columns) {
+        if (column.size() == index) {
+            column.push_back(0.0);
+        }
+    }
+    append_key_cache(index);
+
+    if (!passes_filter(index)) {
+        return npos;
+    }
+
+    const uint32_t store = static_cast<uint32_t>(index);
+    if (!is_sorted()) {
+        m_view.push_back(store);
+        return m_view.size() - 1;
+    }
+
+    auto pos = std::lower_bound(m_view.begin(), m_view.end(), store,
+        [this](uint32_t a, uint32_t b) { return less(a, b); });
+    pos = m_view.insert(pos, store);
+    return static_cast<size_t>(pos - m_view.begin());
+}
+
+size_t ListModel::remove_at_view(size_t view_index) {
+    const uint32_t store = m_view[view_index];
+    m_view.erase(m_view.begin() + view_index);
+    for (auto& entry : m_view) {
+        if (entry > store) {
+            --entry;
+        }
+    }
+
+    m_items.erase(m_items.begin() + store);
+    m_search_valid = false;
+    for (auto& column : m_columns) {
+        if (store < column.size()) {
+            column.erase(column.begin() + store);
+        }
+    }
+    for (auto& cache : m_key_cache) {
+        if (!cache.numbers.empty()) {
+            cache.numbers.erase(cache.numbers.begin() + store);
+        }
+        if (!cache.folded.empty()) {
+            cache.folded.erase(cache.folded.begin() + store);
+        }
+    }
+    return store;
+}
+
+void ListModel::clear() {
+    m_items.clear();
+    m_search_valid = false;
+    m_columns.clear();
+    for (auto& cache : m_key_cache) {
+        cache.numbers.clear();
+        cache.folded.clear();
+    }
+    m_view.clear();
+}
+
+void ListModel::insert_at(size_t store_index, std::vector<std::u16string> texts) {
+    const size_t count = texts.size();
+    m_items.insert(m_items.begin() + store_index,
+                   std::make_move_iterator(texts.begin()), std::make_move_iterator(texts.end()));
+    m_search_valid = false;
+    for (auto& column : m_columns) {
+        if (store_index <= column.size()) {
+            column.insert(column.begin() + store_index, count, 0.0);
+        }
+    }
+    const size_t old_size = m_view.size();
+    m_view.resize(old_size + count);
+    std::iota(m_view.begin() + old_size, m_view.end(), static_cast<uint32_t>(old_size));
+}
+
+void ListModel::remove_range(size_t store_index, size_t count) {
+    m_items.erase(m_items.begin() + store_index, m_items.begin() + store_index + count);
+    m_search_valid = false;
+    for (auto& column : m_columns) {
+        if (store_index < column.size()) {
+            column.erase(column.begin() + store_index,
+                         column.begin() + std::min(column.size(), store_index + count));
+        }
+    }
+    m_view.resize(m_items.size());
+}
+
+void ListModel::replace_at(size_t store_index, std::u16string text) {
+    m_items[store_index] = std::move(text);
+    m_search_valid = false;
+}
+
+void ListModel::move_item(size_t from, size_t to) {
+    auto shift = [from, to](auto& values) {
+        if (from < to) {
+            std::rotate(values.begin() + from, values.begin() + from + 1, values.begin() + to + 1);
+        } else if (to < from) {
+            std::rotate(values.begin() + to, values.begin() + from, values.begin() + from + 1);
+        }
+    };
+    shift(m_items);
+    m_search_valid = false;
+    for (auto& column : m_columns) {
+        if (std::max(from, to) < column.size()) {
+            shift(column);
+        }
+    }
+}
+
+void ListModel::assign(std::vector<std::u16string> items) {
+    m_items = std::move(items);
+    m_search_valid = false;
+    m_columns.clear();
+    build_key_cache();
+    rebuild_view();
+}
+
+void ListModel::set_column(size_t column, const double* values, size_t count) {
+    if (m_columns.size() <= column) {
+        m_columns.resize(column + 1);
+    }
+    auto& dest = m_columns[column];
+    dest.assign(m_items.size(), 0.0);
+    std::copy(values, values + std::min(count, dest.size()), dest.begin());
+
+    bool used = m_filter.kind == FilterKind::ColumnRange && m_filter.column == static_cast<int32_t>(column);
+    for (const auto& key : m_sort) {
+        used = used || (key.kind == SortKind::Column && key.column == static_cast<int32_t>(column));
+    }
+    if (used) {
+        rebuild_view();
+    }
+}
+
+void ListModel::set_sort(std::vector<SortKey> keys) {
+    m_sort = std::move(keys);
+    build_key_cache();
+    rebuild_view();
+}
+
+void ListModel::set_filter(FilterSpec filter) {
+    const bool was_contains = m_filter.kind == FilterKind::Contains;
+    TextSearcher previous = std::move(m_filter_searcher);
+
+    m_filter = std::move(filter);
+    m_filter_folded = m_filter.ignore_case ? fold_case(m_filter.text) : std::u16string();
+    m_filter_searcher = m_filter.kind == FilterKind::Contains
+        ? TextSearcher(m_filter.text, m_filter.ignore_case)
+        : TextSearcher();
+
+    // Type-to-filter: a longer query only ever hides items, and filtering the
+    // current view keeps its sort order, so skip the full rebuild.
+    if (was_contains && m_filter.kind == FilterKind::Contains && m_filter_searcher.refines(previous)) {
+        const std::vector<uint32_t> current = std::move(m_view);
+        const auto kept = parallel_filter(current.size(), [&](size_t v) {
+            return m_filter_searcher.matches(m_items[current[v]]);
+        });
+        m_view.resize(kept.size());
+        for (size_t i = 0; i < kept.size(); ++i) {
+            m_view[i] = current[kept[i]];
+        }
+        return;
+    }
+    rebuild_view();
+}
+
+const std::vector<uint32_t>& ListModel::search(std::u16string_view query, bool ignore_case) {
+    TextSearcher searcher(query, ignore_case);
+    if (m_search_valid && searcher.refines(m_search)) {
+        const std::vector<uint32_t> previous = std::move(m_search_matches);
+        const auto kept = parallel_filter(previous.size(), [&](size_t i) {
+            return searcher.matches(m_items[previous[i]]);
+        });
+        m_search_matches.resize(kept.size());
+        for (size_t i = 0; i < kept.size(); ++i) {
+            m_search_matches[i] = previous[kept[i]];
+        }
+    } else {
+        m_search_matches = parallel_filter(m_items.size(), [&](size_t i) {
+            return searcher.matches(m_items[i]);
+        });
+    }
+    m_search = std::move(searcher);
+    m_search_valid = true;
+    return m_search_matches;
+}
+
+size_t ListModel::export_view(size_t start, size_t count, char16_t* buffer, size_t capacity,
+                              uint32_t* offsets) const {
+    size_t required = 0;
+    for (size_t v = start; v < start + count; ++v) {
+        if (offsets) {
+            offsets[v - start] = static_cast<uint32_t>(required);
+        }
+        required += m_items[m_view[v]].size();
+    }
+    if (offsets) {
+        offsets[count] = static_cast<uint32_t>(required);
+    }
+
+    if (buffer && required <= capacity) {
+        char16_t* out = buffer;
+        for (size_t v = start; v < start + count; ++v) {
+            const std::u16string& text = m_items[m_view[v]];
+            out = std::copy(text.begin(), text.end(), out);
+        }
+    }
+    return required;
+}
+
+bool ListModel::passes_filter(size_t store_index) const {
+    const std::u16string_view text = m_items[store_index];
+    const std::u16string_view needle = m_filter.ignore_case ? m_filter_folded : m_filter.text;
+
+    switch (m_filter.kind) {
+        case FilterKind::None:
+            return true;
+        case FilterKind::Contains:
+            return m_filter_searcher.matches(text);
+        case FilterKind::Prefix:
+            if (text.size() < needle.size()) {
+                return false;
+            }
+            return m_filter.ignore_case ? folded_equals(text.substr(0, needle.size()), needle)
+                                        : text.compare(0, needle.size(), needle) == 0;
+        case FilterKind::Equals:
+            return m_filter.ignore_case ? folded_equals(text, needle) : text == needle;
+        case FilterKind::NumericRange: {
+            const double value = parse_leading_number(text);
+            return value >= m_filter.min && value <= m_filter.max;
+        }
+        case FilterKind::ColumnRange: {
+            const double value = column_value(static_cast<size_t>(m_filter.column), store_index);
+            return value >= m_filter.min && value <= m_filter.max;
+        }
+    }
+    return true;
+}
+
+bool ListModel::less(uint32_t a, uint32_t b) const {
+    for (size_t k = 0; k < m_sort.size(); ++k) {
+        const SortKey& key = m_sort[k];
+        int order = 0;
+        switch (key.kind) {
+            case SortKind::Text:
+                order = m_items[a].compare(m_items[b]);
+                break;
+            case SortKind::TextIgnoreCase:
+                order = m_key_cache[k].folded[a].compare(m_key_cache[k].folded[b]);
+                break;
+            case SortKind::Numeric: {
+                const auto& numbers = m_key_cache[k].numbers;
+                order = compare_numbers(numbers[a], numbers[b]);
+                // Missing numbers stay last in both directions.
+                if (order != 0 && key.descending && !std::isnan(numbers[a]) && !std::isnan(numbers[b])) {
+                    order = -order;
+                }
+                if (order != 0) {
+                    return order < 0;
+                }
+                continue;
+            }
+            case SortKind::Column:
+                order = compare_numbers(column_value(key.column, a), column_value(key.column, b));
+                break;
+        }
+        if (order != 0) {
+            return key.descending ? order > 0 : order < 0;
+        }
+    }
+    return a < b;
+}
+
+double ListModel::column_value(size_t column, size_t store_index) const {
+    if (column >= m_columns.size() || store_index >= m_columns[column].size()) {
+        return 0.0;
+    }
+    return m_columns[column][store_index];
+}
+
+void ListModel::build_key_cache() {
+    m_key_cache.assign(m_sort.size(), KeyCache{});
+    const size_t count = m_items.size();
+    for (size_t k = 0; k < m_sort.size(); ++k) {
+        KeyCache& cache = m_key_cache[k];
+        if (m_sort[k].kind == SortKind::Numeric) {
+            cache.numbers.resize(count);
+            parallel_chunks(count, 16384, [&](size_t begin, size_t end, size_t) {
+                for (size_t i = begin; i < end; ++i) {
+                    cache.numbers[i] = parse_leading_number(m_items[i]);
+                }
+            });
+        } else if (m_sort[k].kind == SortKind::TextIgnoreCase) {
+            cache.folded.resize(count);
+            parallel_chunks(count, 16384, [&](size_t begin, size_t end, size_t) {
+                for (size_t i = begin; i < end; ++i) {
+                    cache.folded[i] = fold_case(m_items[i]);
+                }
+            });
+        }
+    }
+}
+
+void ListModel::append_key_cache(size_t store_index) {
+    for (size_t k = 0; k < m_sort.size(); ++k) {
+        if (m_sort[k].kind == SortKind::Numeric) {
+            m_key_cache[k].numbers.push_back(parse_leading_number(m_items[store_index]));
+        } else if (m_sort[k].kind == SortKind::TextIgnoreCase) {
+            m_key_cache[k].folded.push_back(fold_case(m_items[store_index]));
+        }
+    }
+}
+
+void ListModel::rebuild_view() {
+    const size_t count = m_items.size();
+    if (is_filtered()) {
+        m_view = parallel_filter(count, [this](size_t i) { return passes_filter(i); });
+    } else {
+        m_view.resize(count);
+        std::iota(m_view.begin(), m_view.end(), 0u);
+    }
+
+    if (is_sorted()) {
+        parallel_sort(m_view.data(), m_view.data() + m_view.size(),
+            [this](uint32_t a, uint32_t b) { return less(a, b); });
+    }
+}
+
+} // namespace xaml_bridge
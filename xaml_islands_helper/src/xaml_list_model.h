@@ -0,0 +1,136 @@
+#pragma once
+
+// Native backing store for ListView items.
+//
+// The bridge keeps every item's text here so sorting and filtering can be
+// computed without the host re-sending the data. A view is a permutation of
+// store indices (optionally a subset); the XAML Items collection always
+// mirrors the current view.
+
+#include "xaml_search.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace xaml_bridge {
+
+// Values match XAML_SORT_* in xaml_islands_bridge.h.
+enum class SortKind : int32_t {
+    Text = 0,            // Ordinal UTF-16 comparison
+    TextIgnoreCase = 1,  // Ordinal comparison of case-folded text
+    Numeric = 2,         // First number found in the text; items without one sort last
+    Column = 3,          // Host-provided numeric column
+};
+
+struct SortKey {
+    SortKind kind = SortKind::Text;
+    int32_t column = 0;
+    bool descending = false;
+};
+
+// Values match XAML_FILTER_* in xaml_islands_bridge.h.
+enum class FilterKind : int32_t {
+    None = 0,
+    Contains = 1,
+    Prefix = 2,
+    Equals = 3,
+    NumericRange = 4,    // Number parsed from the text within [min, max]
+    ColumnRange = 5,     // Host-provided column value within [min, max]
+};
+
+struct FilterSpec {
+    FilterKind kind = FilterKind::None;
+    bool ignore_case = false;
+    std::u16string text;
+    double min = 0.0;
+    double max = 0.0;
+    int32_t column = 0;
+};
+
+class ListModel {
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    size_t size() const noexcept { return m_items.size(); }
+    const std::u16string& item(size_t store_index) const { return m_items[store_index]; }
+
+    // Append an item to the store. Returns the view position it occupies, or
+    // npos when the active filter hides it.
+    size_t append(std::u16string text);
+
+    // Remove the item shown at `view_index`. Returns its store index.
+    size_t remove_at_view(size_t view_index);
+
+    void clear();
+
+    // Store-order edits for hosts that mirror their own collection. These
+    // require an unsorted, unfiltered model, where view and store coincide.
+    void insert_at(size_t store_index, std::vector<std::u16string> texts);
+    void remove_range(size_t store_index, size_t count);
+    void replace_at(size_t store_index, std::u16string text);
+    void move_item(size_t from, size_t to);
+
+    // Replace every item. Column values no longer line up and are dropped.
+    void assign(std::vector<std::u16string> items);
+
+    // Provide values for a numeric column, indexed by store position. Items
+    // beyond `count` read as 0. Re-sorts/filters if the column is in use.
+    void set_column(size_t column, const double* values, size_t count);
+
+    // Replace the sort keys (empty keeps store order) and rebuild the view.
+    void set_sort(std::vector<SortKey> keys);
+
+    // Replace the filter (FilterKind::None shows everything) and rebuild the view.
+    // A Contains filter that narrows the previous Contains filter only rescans
+    // the visible items.
+    void set_filter(FilterSpec filter);
+
+    // Store indices (ascending) of every item containing `query`, ignoring the
+    // view. When the query narrows the previous search and the store has not
+    // changed, only the previous matches are rescanned.
+    const std::vector<uint32_t>& search(std::u16string_view query, bool ignore_case);
+
+    // Concatenate the text of view items [start, start + count) into `buffer`
+    // without separators. offsets (count + 1 entries, may be null) receives the
+    // start of each item and the total length. Returns the number of characters
+    // needed; nothing is copied unless buffer is non-null and capacity suffices.
+    size_t export_view(size_t start, size_t count, char16_t* buffer, size_t capacity, uint32_t* offsets) const;
+
+    bool is_sorted() const noexcept { return !m_sort.empty(); }
+    bool is_filtered() const noexcept { return m_filter.kind != FilterKind::None; }
+
+    size_t view_size() const noexcept { return m_view.size(); }
+    uint32_t store_index(size_t view_index) const { return m_view[view_index]; }
+    const std::vector<uint32_t>& view() const noexcept { return m_view; }
+
+private:
+    struct KeyCache {
+        std::vector<double> numbers;          // Numeric keys
+        std::vector<std::u16string> folded;   // TextIgnoreCase keys
+    };
+
+    bool passes_filter(size_t store_index) const;
+    bool less(uint32_t a, uint32_t b) const;
+    double column_value(size_t column, size_t store_index) const;
+    void build_key_cache();
+    void append_key_cache(size_t store_index);
+    void rebuild_view();
+
+    std::vector<std::u16string> m_items;
+    std::vector<std::vector<double>> m_columns;
+    std::vector<SortKey> m_sort;
+    std::vector<KeyCache> m_key_cache;        // One entry per sort key
+    FilterSpec m_filter;
+    std::u16string m_filter_folded;
+    TextSearcher m_filter_searcher;
+    std::vector<uint32_t> m_view;
+
+    TextSearcher m_search;
+    std::vector<uint32_t> m_search_matches;
+    bool m_search_valid = false;              // Cleared whenever the store changes
+};
+
+} // namespace xaml_bridge
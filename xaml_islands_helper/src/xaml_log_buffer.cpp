@@ -0,0 +1,148 @@
+#include "xaml_log_buffer.h"
+
+#include <algorithm>
+
+namespace xaml_bridge {
+
+LogBuffer::LogBuffer(size_t capacity) : m_lines(std::max<size_t>(capacity, 1)) {}
+
+std::u16string& LogBuffer::push_slot() {
+    if (size() == m_lines.size()) {
+        ++m_first;
+        ++m_dropped;
+    }
+    return m_lines[static_cast<size_t>(m_end++ % m_lines.size())];
+}
+
+void LogBuffer::append_line(std::u16string_view line) {
+    if (!line.empty() && line.back() == u'\r') {
+        line.remove_suffix(1);
+    }
+    // assign() keeps the slot's capacity from the line it replaces.
+    push_slot().assign(line.substr(0, kMaxLogLineLength));
+}
+
+size_t LogBuffer::append(std::u16string_view text) {
+    if (text.empty()) {
+        return 0;
+    }
+    if (text.back() == u'\n') {
+        text.remove_suffix(1);
+    }
+
+    // Lines that would be overwritten within this batch are never copied.
+    // Only a batch with at least `capacity` characters can hold that many.
+    size_t lines = 0;
+    size_t start = 0;
+    if (text.size() >= m_lines.size()) {
+        const size_t total = static_cast<size_t>(std::count(text.begin(), text.end(), u'\n')) + 1;
+        if (total > m_lines.size()) {
+            const size_t skip = total - m_lines.size();
+            m_dropped += size() + skip;
+            m_end += skip;
+            m_first = m_end;
+            for (; lines < skip; ++lines) {
+                start = text.find(u'\n', start) + 1;
+            }
+        }
+    }
+    while (true) {
+        ++lines;
+        const size_t newline = text.find(u'\n', start);
+        if (newline == std::u16string_view::npos) {
+            append_line(text.substr(start));
+            return lines;
+        }
+        append_line(text.substr(start, newline - start));
+        start = newline + 1;
+    }
+}
+
+void LogBuffer::clear() {
+    m_first = m_end;
+}
+
+LogView::LogView(size_t capacity, size_t rows) : m_buffer(capacity), m_rows(rows) {}
+
+uint64_t LogView::max_top() const noexcept {
+    const uint64_t end = m_buffer.end_line();
+    return std::max(m_buffer.first_line(), end - std::min<uint64_t>(end, m_rows));
+}
+
+uint64_t LogView::top() const noexcept {
+    if (m_follow) {
+        return max_top();
+    }
+    return std::clamp(m_top, m_buffer.first_line(), max_top());
+}
+
+uint64_t LogView::visible_end() const noexcept {
+    return std::min(top() + m_rows, m_buffer.end_line());
+}
+
+void LogView::note_rows(uint64_t top_before, uint64_t end_before) noexcept {
+    if (top() != top_before || visible_end() != end_before) {
+        m_changes |= kLogRowsChanged;
+    }
+}
+
+size_t LogView::append(std::u16string_view text) {
+    const uint64_t top_before = top();
+    const uint64_t end_before = visible_end();
+    const size_t lines = m_buffer.append(text);
+    if (lines > 0) {
+        m_changes |= kLogExtentChanged;
+        note_rows(top_before, end_before);
+    }
+    return lines;
+}
+
+void LogView::clear() {
+    m_buffer.clear();
+    m_changes |= kLogRowsChanged | kLogExtentChanged;
+}
+
+void LogView::set_rows(size_t rows) {
+    if (rows == m_rows) {
+        return;
+    }
+    const uint64_t top_before = top();
+    const uint64_t end_before = visible_end();
+    m_top = top_before;
+    m_rows = rows;
+    note_rows(top_before, end_before);
+}
+
+void LogView::scroll_to(uint64_t top) {
+    const uint64_t top_before = this->top();
+    const uint64_t end_before = visible_end();
+    m_follow = top >= max_top();
+    m_top = std::max(top, m_buffer.first_line());
+    note_rows(top_before, end_before);
+}
+
+void LogView::scroll_by(int64_t lines) {
+    const uint64_t current = top();
+    if (lines < 0) {
+        const uint64_t up = static_cast<uint64_t>(-(lines + 1)) + 1;
+        scroll_to(current - std::min(current, up));
+    } else {
+        scroll_to(current + static_cast<uint64_t>(lines));
+    }
+}
+
+void LogView::set_follow_tail(bool follow) {
+    const uint64_t top_before = top();
+    const uint64_t end_before = visible_end();
+    m_top = top_before;
+    m_follow = follow;
+    note_rows(top_before, end_before);
+}
+
+uint32_t LogView::take_changes() noexcept {
+    const uint32_t changes = m_changes;
+    m_changes = 0;
+    return changes;
+}
+
+} // namespace xaml_bridge
@@ -0,0 +1,104 @@
+#pragma once
+
+// Storage and viewport for the bridge's log view.
+//
+// LogBuffer keeps the newest `capacity` lines in a ring of UTF-16 strings.
+// Slots are reused as the ring wraps, so a steady stream of similar lines
+// stops allocating once every slot has held a line. Every line has an index
+// that keeps counting across wraps, so a viewport can refer to lines that
+// may since have been dropped.
+//
+// LogView adds the viewport: which lines fill the visible rows, whether it
+// follows the tail, and what changed since the UI last drew. Neither class
+// is thread-safe; the bridge serializes appends and frame ticks.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace xaml_bridge {
+
+// Longer lines are truncated so the ring's memory stays bounded.
+constexpr size_t kMaxLogLineLength = 4096;
+
+class LogBuffer {
+public:
+    explicit LogBuffer(size_t capacity);
+
+    // Append every '\n'-separated line of `text`. A '\r' before the newline
+    // is dropped, and a trailing newline does not start an empty line. When
+    // the batch holds more lines than the ring, only the last `capacity` are
+    // copied. Returns the number of lines in the batch.
+    size_t append(std::u16string_view text);
+    void append_line(std::u16string_view line);
+
+    // Drops every line; indexes keep counting.
+    void clear();
+
+    size_t capacity() const noexcept { return m_lines.size(); }
+    size_t size() const noexcept { return static_cast<size_t>(m_end - m_first); }
+    uint64_t first_line() const noexcept { return m_first; }
+    uint64_t end_line() const noexcept { return m_end; }
+    // Lines pushed out of the ring by newer ones.
+    uint64_t dropped() const noexcept { return m_dropped; }
+
+    // `index` must be in [first_line(), end_line()).
+    std::u16string_view line(uint64_t index) const noexcept {
+        return m_lines[static_cast<size_t>(index % m_lines.size())];
+    }
+
+private:
+    std::u16string& push_slot();
+
+    std::vector<std::u16string> m_lines;
+    uint64_t m_first = 0;
+    uint64_t m_end = 0;
+    uint64_t m_dropped = 0;
+};
+
+// Bits returned by LogView::take_changes.
+constexpr uint32_t kLogRowsChanged = 0x1;     // The visible lines differ
+constexpr uint32_t kLogExtentChanged = 0x2;   // The stored range differs
+
+class LogView {
+public:
+    explicit LogView(size_t capacity, size_t rows = 0);
+
+    size_t append(std::u16string_view text);
+    void clear();
+
+    void set_rows(size_t rows);
+    size_t rows() const noexcept { return m_rows; }
+
+    // Scrolling above the last page stops following the tail; scrolling to
+    // the last page resumes it.
+    void scroll_to(uint64_t top);
+    void scroll_by(int64_t lines);
+    void set_follow_tail(bool follow);
+    bool follows_tail() const noexcept { return m_follow; }
+
+    // Visible lines are [top(), visible_end()).
+    uint64_t top() const noexcept;
+    uint64_t visible_end() const noexcept;
+    // Largest top(): the first line of the last page.
+    uint64_t max_top() const noexcept;
+
+    // kLog* bits describing what changed since the previous call.
+    uint32_t take_changes() noexcept;
+
+    const LogBuffer& buffer() const noexcept { return m_buffer; }
+
+private:
+    // Records kLogRowsChanged when the visible range moved since `before`.
+    void note_rows(uint64_t top_before, uint64_t end_before) noexcept;
+
+    LogBuffer m_buffer;
+    size_t m_rows;
+    uint64_t m_top = 0;           // Used while not following
+    bool m_follow = true;
+    uint32_t m_changes = kLogRowsChanged | kLogExtentChanged;
+};
+
+} // namespace xaml_bridge
@@ -0,0 +1,84 @@
+#include "xaml_number_format.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+
+namespace xaml_bridge {
+
+namespace {
+
+// Fixed notation of the largest double (309 integer digits) plus the
+// largest precision, a sign and a decimal point.
+constexpr size_t kFormatBufferSize = 309 + kMaxNumberPrecision + 8;
+
+bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+} // namespace
+
+void format_number(double value, const NumberFormat& format, std::u16string& out) {
+    out.clear();
+    out.append(format.prefix);
+
+    if (std::isnan(value)) {
+        out.append(u"NaN");
+        out.append(format.suffix);
+        return;
+    }
+    if (std::isinf(value)) {
+        if (value < 0) {
+            out.push_back(u'-');
+        } else if (format.plus_sign) {
+            out.push_back(u'+');
+        }
+        out.push_back(u'\u221E');
+        out.append(format.suffix);
+        return;
+    }
+
+    char buffer[kFormatBufferSize];
+    const double magnitude = std::abs(value);
+    std::to_chars_result result =
+        format.precision < 0
+            ? std::to_chars(buffer, buffer + sizeof(buffer), magnitude)
+            : std::to_chars(buffer, buffer + sizeof(buffer), magnitude, std::chars_format::fixed,
+                            std::min(format.precision, kMaxNumberPrecision));
+    const char* const begin = buffer;
+    const char* const end = result.ptr;
+
+    // Format the magnitude and add the sign afterwards so values like
+    // -0.001 at two digits read "0.00" rather than "-0.00".
+    const char* mantissa_end = std::find_if(begin, end, [](char c) { return c == 'e'; });
+    const bool zero = std::all_of(begin, mantissa_end, [](char c) { return !is_digit(c) || c == '0'; });
+    if (value < 0 && !zero) {
+        out.push_back(u'-');
+    } else if (format.plus_sign && !zero) {
+        out.push_back(u'+');
+    }
+
+    const char* integer_end = std::find_if(begin, end, [](char c) { return !is_digit(c); });
+    const size_t integer_digits = static_cast<size_t>(integer_end - begin);
+    for (size_t i = 0; i < integer_digits; ++i) {
+        if (format.grouping && i > 0 && (integer_digits - i) % 3 == 0) {
+            out.push_back(format.group_separator);
+        }
+        out.push_back(static_cast<char16_t>(buffer[i]));
+    }
+    for (const char* p = integer_end; p != end; ++p) {
+        out.push_back(*p == '.' ? format.decimal_point : static_cast<char16_t>(*p));
+    }
+    out.append(format.suffix);
+}
+
+bool NumberTextCache::update(const void* key, double value, const NumberFormat& format) {
+    format_number(value, format, m_text);
+    auto [it, inserted] = m_last.try_emplace(key);
+    if (!inserted && it->second == m_text) {
+        return false;
+    }
+    // assign() reuses the entry's capacity once the text length settles.
+    it->second.assign(m_text);
+    return true;
+}
+
+} // namespace xaml_bridge
@@ -0,0 +1,67 @@
+#pragma once
+
+// Number-to-text formatting for TextBlocks that show live values.
+//
+// Telemetry panels rewrite hundreds of numbers per second. format_number
+// writes straight into a caller-owned UTF-16 buffer with std::to_chars, so
+// steady-state updates allocate nothing, and NumberTextCache remembers the
+// last text per target so unchanged values never reach XAML.
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace xaml_bridge {
+
+// Largest fixed-point precision honoured; doubles carry at most 17
+// significant digits.
+constexpr int kMaxNumberPrecision = 17;
+
+struct NumberFormat {
+    int precision = -1;               // Fraction digits; negative for the shortest round-trip form
+    bool grouping = false;            // Separate thousands in the integer part
+    bool plus_sign = false;           // Prefix positive values with '+'
+    char16_t decimal_point = u'.';
+    char16_t group_separator = u',';
+    std::u16string_view prefix;       // Written before the sign, e.g. u"$"
+    std::u16string_view suffix;       // e.g. u" ms"
+};
+
+// Replace `out` with `value` formatted per `format`. Reuses out's capacity.
+// NaN formats as "NaN" and infinities as "∞" with their sign. Values that
+// round to zero never show a minus sign.
+void format_number(double value, const NumberFormat& format, std::u16string& out);
+
+// Last text shown per target (the bridge keys it by TextBlock handle).
+// Not thread-safe.
+class NumberTextCache {
+public:
+    // Format `value` into text() and record it for `key`. Returns false when
+    // the text equals the one recorded before, so the caller can skip the
+    // update.
+    bool update(const void* key, double value, const NumberFormat& format);
+    const std::u16string& text() const noexcept { return m_text; }
+
+    // Call when the target's text changes by other means, or the update
+    // returned true but could not be applied.
+    void forget(const void* key) { m_last.erase(key); }
+    // Forget every key for which `pred(key)` holds.
+    template <class Pred>
+    void forget_if(Pred pred) {
+        for (auto it = m_last.begin(); it != m_last.end();) {
+            if (pred(it->first)) {
+                it = m_last.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    size_t size() const noexcept { return m_last.size(); }
+
+private:
+    std::u16string m_text;
+    std::unordered_map<const void*, std::u16string> m_last;
+};
+
+} // namespace xaml_bridge
@@ -0,0 +1,146 @@
+#pragma once
+
+// Minimal fork/join helpers for the bridge kernels.
+//
+// std::execution policies are not usable with every toolchain we build with
+// (libstdc++ needs TBB for them), so the kernels use plain std::thread
+// fan-out. Small inputs always run on the calling thread.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace xaml_bridge {
+
+// Number of workers to use for `count` elements when each worker should get
+// at least `min_per_worker` of them.
+inline size_t worker_count(size_t count, size_t min_per_worker) noexcept {
+    size_t hw = std::thread::hardware_concurrency();
+    if (hw == 0) {
+        hw = 1;
+    }
+    size_t by_size = min_per_worker ? count / min_per_worker : count;
+    return std::max<size_t>(1, std::min(hw, by_size));
+}
+
+// Invoke fn(begin, end) over [0, count) split into contiguous chunks.
+// Chunk i always covers a lower range than chunk i + 1.
+template <class Fn>
+void parallel_chunks(size_t count, size_t min_per_worker, Fn&& fn) {
+    const size_t workers = worker_count(count, min_per_worker);
+    if (workers <= 1) {
+        fn(size_t{0}, count, size_t{0});
+        return;
+    }
+
+    const size_t chunk = (count + workers - 1) / workers;
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (size_t w = 1; w < workers; ++w) {
+        const size_t begin = std::min(count, w * chunk);
+        const size_t end = std::min(count, begin + chunk);
+        threads.emplace_back([&fn, begin, end, w] { fn(begin, end, w); });
+    }
+    fn(size_t{0}, std::min(count, chunk), size_t{0});
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+// Sort [first, last) with `less`, which must be a strict total order (break
+// ties on the element itself) so the result does not depend on the split.
+// Chunks are sorted concurrently and then merged pairwise in parallel.
+template <class T, class Less>
+void parallel_sort(T* first, T* last, Less less, size_t min_per_worker = 16384) {
+    const size_t count = static_cast<size_t>(last - first);
+    const size_t workers = worker_count(count, min_per_worker);
+    if (workers <= 1) {
+        std::sort(first, last, less);
+        return;
+    }
+
+    // Round the run count down to a power of two so every merge pass pairs up.
+    size_t runs = 1;
+    while (runs * 2 <= workers) {
+        runs *= 2;
+    }
+    std::vector<size_t> bounds(runs + 1);
+    for (size_t r = 0; r <= runs; ++r) {
+        bounds[r] = count * r / runs;
+    }
+
+    {
+        std::vector<std::thread> threads;
+        for (size_t r = 1; r < runs; ++r) {
+            threads.emplace_back([=] { std::sort(first + bounds[r], first + bounds[r + 1], less); });
+        }
+        std::sort(first + bounds[0], first + bounds[1], less);
+        for (auto& t : threads) {
+            t.join();
+        }
+    }
+
+    std::vector<T> scratch(count);
+    T* src = first;
+    T* dst = scratch.data();
+    while (runs > 1) {
+        std::vector<std::thread> threads;
+        for (size_t r = 2; r < runs; r += 2) {
+            threads.emplace_back([=] {
+                std::merge(src + bounds[r], src + bounds[r + 1],
+                           src + bounds[r + 1], src + bounds[r + 2],
+                           dst + bounds[r], less);
+            });
+        }
+        std::merge(src + bounds[0], src + bounds[1], src + bounds[1], src + bounds[2],
+                   dst + bounds[0], less);
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        for (size_t r = 0; r * 2 <= runs; ++r) {
+            bounds[r] = bounds[r * 2];
+        }
+        bounds.resize(runs / 2 + 1);
+        runs /= 2;
+        std::swap(src, dst);
+    }
+
+    if (src != first) {
+        std::copy(src, src + count, first);
+    }
+}
+
+// Collect the indices in [0, count) for which keep(i) is true, in ascending
+// order. Chunks are scanned concurrently and concatenated afterwards.
+template <class Keep>
+std::vector<uint32_t> parallel_filter(size_t count, Keep keep, size_t min_per_worker = 16384) {
+    const size_t workers = worker_count(count, min_per_worker);
+    std::vector<std::vector<uint32_t>> parts(workers);
+    parallel_chunks(count, min_per_worker, [&](size_t begin, size_t end, size_t w) {
+        auto& out = parts[w];
+        for (size_t i = begin; i < end; ++i) {
+            if (keep(i)) {
+                out.push_back(static_cast<uint32_t>(i));
+            }
+        }
+    });
+
+    if (workers == 1) {
+        return std::move(parts[0]);
+    }
+    size_t total = 0;
+    for (const auto& p : parts) {
+        total += p.size();
+    }
+    std::vector<uint32_t> result;
+    result.reserve(total);
+    for (const auto& p : parts) {
+        result.insert(result.end(), p.begin(), p.end());
+    }
+    return result;
+}
+
+} // namespace xaml_bridge
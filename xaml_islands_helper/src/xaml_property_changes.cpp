@@ -0,0 +1,89 @@
+#include "xaml_property_changes.h"
+
+#include <climits>
+#include <cmath>
+#include <utility>
+
+namespace xaml_bridge {
+
+namespace {
+
+constexpr uint32_t kNotPending = UINT32_MAX;
+
+bool same_number(double a, double b) {
+    return a == b || (std::isnan(a) && std::isnan(b));
+}
+
+} // namespace
+
+PropertyChange& PropertyChangeQueue::pending(uint32_t observer, bool& first) {
+    ++m_recorded;
+    if (observer >= m_index.size()) {
+        m_index.resize(static_cast<size_t>(observer) + 1, kNotPending);
+    }
+    first = m_index[observer] == kNotPending;
+    if (first) {
+        if (m_pending.size() == m_count) {
+            m_pending.emplace_back();
+        }
+        m_index[observer] = static_cast<uint32_t>(m_count++);
+    }
+    return m_pending[m_index[observer]];
+}
+
+void PropertyChangeQueue::record(uint32_t observer, double old_value, double new_value) {
+    bool first = false;
+    PropertyChange& change = pending(observer, first);
+    if (first) {
+        change.observer = observer;
+        change.is_text = false;
+        change.old_number = old_value;
+    }
+    change.new_number = new_value;
+}
+
+void PropertyChangeQueue::record(uint32_t observer, std::u16string_view old_value, std::u16string_view new_value) {
+    bool first = false;
+    PropertyChange& change = pending(observer, first);
+    if (first) {
+        change.observer = observer;
+        change.is_text = true;
+        change.old_text.assign(old_value);
+    }
+    change.new_text.assign(new_value);
+}
+
+void PropertyChangeQueue::forget(uint32_t observer) {
+    if (observer >= m_index.size() || m_index[observer] == kNotPending) {
+        return;
+    }
+    // Keep first-recorded order: shift the later entries down.
+    const size_t at = m_index[observer];
+    m_index[observer] = kNotPending;
+    for (size_t i = at + 1; i < m_count; ++i) {
+        std::swap(m_pending[i - 1], m_pending[i]);
+        m_index[m_pending[i - 1].observer] = static_cast<uint32_t>(i - 1);
+    }
+    --m_count;
+}
+
+size_t PropertyChangeQueue::take(std::vector<PropertyChange>& out) {
+    size_t count = 0;
+    for (size_t i = 0; i < m_count; ++i) {
+        PropertyChange& change = m_pending[i];
+        m_index[change.observer] = kNotPending;
+        const bool changed = change.is_text ? change.old_text != change.new_text
+                                            : !same_number(change.old_number, change.new_number);
+        if (!changed) {
+            continue;
+        }
+        if (out.size() == count) {
+            out.emplace_back();
+        }
+        std::swap(out[count++], change);
+    }
+    m_count = 0;
+    return count;
+}
+
+} // namespace xaml_bridge
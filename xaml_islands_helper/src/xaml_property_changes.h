@@ -0,0 +1,57 @@
+#pragma once
+
+// Per-frame coalescing of observed XAML property changes.
+//
+// A dragged Slider or a scrolling ScrollViewer changes its property many
+// times between frames. PropertyChangeQueue keeps one pending change per
+// observer, from the value before the first change to the latest one, so the
+// host gets at most one notification per observed property per frame.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace xaml_bridge {
+
+struct PropertyChange {
+    uint32_t observer = 0;
+    bool is_text = false;
+    double old_number = 0.0;
+    double new_number = 0.0;
+    std::u16string old_text;
+    std::u16string new_text;
+};
+
+// Observer ids index a flat table, so keep them small and dense (the bridge
+// reuses the ids of removed observations). Not thread-safe.
+class PropertyChangeQueue {
+public:
+    // Record that `observer`'s property went from `old_value` to `new_value`.
+    // A later record for the same observer before take() only replaces the
+    // new value. NaN equals NaN.
+    void record(uint32_t observer, double old_value, double new_value);
+    void record(uint32_t observer, std::u16string_view old_value, std::u16string_view new_value);
+
+    bool empty() const noexcept { return m_count == 0; }
+    uint64_t recorded() const noexcept { return m_recorded; }
+
+    // Drop the pending change of an observer that is going away.
+    void forget(uint32_t observer);
+
+    // Move the net changes, in the order they were first recorded, into the
+    // front of `out` and return how many there are. Changes that ended where
+    // they started are dropped. Entries past the count are left for reuse.
+    size_t take(std::vector<PropertyChange>& out);
+
+private:
+    PropertyChange& pending(uint32_t observer, bool& first);
+
+    std::vector<PropertyChange> m_pending;            // First m_count entries are live
+    size_t m_count = 0;
+    std::vector<uint32_t> m_index;                    // Observer to entry, kNotPending if none
+    uint64_t m_recorded = 0;
+};
+
+} // namespace xaml_bridge
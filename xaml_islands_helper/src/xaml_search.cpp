@@ -0,0 +1,133 @@
+#include "xaml_search.h"
+#include "xaml_text.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define XAML_SEARCH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace xaml_bridge {
+
+namespace {
+
+inline unsigned lowest_set_bit(unsigned mask) noexcept {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+} // namespace
+
+TextSearcher::TextSearcher(std::u16string_view query, bool ignore_case)
+    : m_needle(ignore_case ? fold_case(query) : std::u16string(query)),
+      m_ignore_case(ignore_case) {
+    if (m_needle.empty()) {
+        return;
+    }
+    const char16_t first = m_needle.front();
+    const char16_t last = m_needle.back();
+    m_first[0] = m_first[1] = first;
+    m_last[0] = m_last[1] = last;
+    if (ignore_case) {
+        m_first[1] = upper_variant(first);
+        m_last[1] = upper_variant(last);
+    }
+}
+
+bool TextSearcher::refines(const TextSearcher& other) const noexcept {
+    // A text containing this needle also contains any substring of it.
+    return m_ignore_case == other.m_ignore_case &&
+           m_needle.find(other.m_needle) != std::u16string::npos;
+}
+
+bool TextSearcher::verify(const char16_t* at) const noexcept {
+    const size_t m = m_needle.size();
+    if (m_ignore_case) {
+        for (size_t k = 1; k + 1 < m; ++k) {
+            if (fold_case(at[k]) != m_needle[k]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    return std::u16string_view(at + 1, m > 2 ? m - 2 : 0) ==
+           std::u16string_view(m_needle).substr(1, m > 2 ? m - 2 : 0);
+}
+
+size_t TextSearcher::find_scalar(std::u16string_view text, size_t from) const noexcept {
+    const size_t m = m_needle.size();
+    for (size_t i = from; i + m <= text.size(); ++i) {
+        const char16_t a = text[i];
+        const char16_t b = text[i + m - 1];
+        if ((a == m_first[0] || a == m_first[1]) && (b == m_last[0] || b == m_last[1]) &&
+            verify(text.data() + i)) {
+            return i;
+        }
+    }
+    return std::u16string_view::npos;
+}
+
+size_t TextSearcher::find(std::u16string_view text) const noexcept {
+    const size_t m = m_needle.size();
+    if (m == 0) {
+        return 0;
+    }
+    if (m > text.size()) {
+        return std::u16string_view::npos;
+    }
+
+    size_t i = 0;
+#if XAML_SEARCH_SSE2
+    const __m128i first_lo = _mm_set1_epi16(static_cast<short>(m_first[0]));
+    const __m128i first_up = _mm_set1_epi16(static_cast<short>(m_first[1]));
+    const __m128i last_lo = _mm_set1_epi16(static_cast<short>(m_last[0]));
+    const __m128i last_up = _mm_set1_epi16(static_cast<short>(m_last[1]));
+    const char16_t* data = text.data();
+
+    // Each step tests candidate starts i..i+7; the last-character load reads
+    // up to data[i + m - 1 + 7], so stop while that stays in bounds.
+    for (; i + m - 1 + 8 <= text.size(); i += 8) {
+        const __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + m - 1));
+        const __m128i eq_first = _mm_or_si128(_mm_cmpeq_epi16(head, first_lo), _mm_cmpeq_epi16(head, first_up));
+        const __m128i eq_last = _mm_or_si128(_mm_cmpeq_epi16(tail, last_lo), _mm_cmpeq_epi16(tail, last_up));
+        // Two mask bits per 16-bit lane; keep one of them.
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_and_si128(eq_first, eq_last))) & 0x5555u;
+        while (mask != 0) {
+            const size_t candidate = i + lowest_set_bit(mask) / 2;
+            if (verify(data + candidate)) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+    return find_scalar(text, i);
+}
+
+size_t find_text_naive(std::u16string_view text, std::u16string_view query, bool ignore_case) noexcept {
+    if (!ignore_case) {
+        return text.find(query);
+    }
+    const std::u16string needle = fold_case(query);
+    for (size_t i = 0; i + needle.size() <= text.size(); ++i) {
+        size_t k = 0;
+        while (k < needle.size() && fold_case(text[i + k]) == needle[k]) {
+            ++k;
+        }
+        if (k == needle.size()) {
+            return i;
+        }
+    }
+    return std::u16string_view::npos;
+}
+
+} // namespace xaml_bridge
@@ -0,0 +1,51 @@
+#pragma once
+
+// Vectorized UTF-16 substring search used by ListView filtering and
+// xaml_listview_search.
+//
+// The kernel compares the first and last needle characters against eight
+// haystack positions at once (SSE2) and only verifies the middle of the
+// needle at candidate positions. Case-insensitive search folds with
+// fold_case(); each folded character has a single upper-case variant, so a
+// lane matches when it equals either one.
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace xaml_bridge {
+
+class TextSearcher {
+public:
+    TextSearcher() = default;
+    TextSearcher(std::u16string_view query, bool ignore_case);
+
+    // True when `text` contains the query. An empty query matches everything.
+    bool matches(std::u16string_view text) const noexcept { return find(text) != std::u16string_view::npos; }
+
+    // Position of the first occurrence of the query in `text`, or npos.
+    size_t find(std::u16string_view text) const noexcept;
+
+    const std::u16string& query() const noexcept { return m_needle; }
+    bool ignore_case() const noexcept { return m_ignore_case; }
+
+    // True when every text matching this searcher also matches `other`, i.e.
+    // this query's results can be found by narrowing `other`'s results
+    // instead of rescanning.
+    bool refines(const TextSearcher& other) const noexcept;
+
+private:
+    size_t find_scalar(std::u16string_view text, size_t from) const noexcept;
+    bool verify(const char16_t* at) const noexcept;
+
+    std::u16string m_needle;  // Folded when m_ignore_case
+    bool m_ignore_case = false;
+    char16_t m_first[2] = {0, 0};  // Lower/upper variants of the first character
+    char16_t m_last[2] = {0, 0};   // Lower/upper variants of the last character
+};
+
+// Reference implementation (fold and compare at every position); used by the
+// benchmarks as a baseline.
+size_t find_text_naive(std::u16string_view text, std::u16string_view query, bool ignore_case) noexcept;
+
+} // namespace xaml_bridge
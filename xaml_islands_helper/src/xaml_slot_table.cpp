@@ -0,0 +1,70 @@
+#include "xaml_slot_table.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+namespace xaml_bridge {
+
+namespace {
+
+double to_kind(SlotKind kind, double value) {
+    switch (kind) {
+    case SlotKind::Integer:
+        if (std::isnan(value)) {
+            return 0.0;
+        }
+        return std::round(std::clamp(value, static_cast<double>(INT32_MIN), static_cast<double>(INT32_MAX)));
+    case SlotKind::Boolean:
+        return value != 0.0 && !std::isnan(value) ? 1.0 : 0.0;
+    default:
+        return value;
+    }
+}
+
+} // namespace
+
+uint32_t SlotTable::add(SlotKind kind) {
+    Slot slot;
+    slot.kind = kind;
+    m_slots.push_back(std::move(slot));
+    return size() - 1;
+}
+
+bool SlotTable::set_number(uint32_t slot, double value) {
+    Slot& s = m_slots[slot];
+    value = to_kind(s.kind, value);
+    if (value == s.number || (std::isnan(value) && std::isnan(s.number))) {
+        return false;
+    }
+    s.number = value;
+    queue(slot);
+    return true;
+}
+
+bool SlotTable::set_text(uint32_t slot, std::u16string_view text) {
+    Slot& s = m_slots[slot];
+    if (s.text == text) {
+        return false;
+    }
+    s.text.assign(text);
+    queue(slot);
+    return true;
+}
+
+void SlotTable::queue(uint32_t slot) {
+    if (!m_slots[slot].queued) {
+        m_slots[slot].queued = true;
+        m_changed.push_back(slot);
+    }
+}
+
+void SlotTable::take_changes(std::vector<uint32_t>& out) {
+    for (uint32_t slot : m_changed) {
+        m_slots[slot].queued = false;
+    }
+    out.insert(out.end(), m_changed.begin(), m_changed.end());
+    m_changed.clear();
+}
+
+} // namespace xaml_bridge
@@ -0,0 +1,62 @@
+#pragma once
+
+// Typed value slots behind the bridge's bindable view models.
+//
+// The host writes many slots per call from any thread. A write that leaves
+// the value unchanged is dropped, and a slot written several times before the
+// UI thread takes the changes is reported once, so XAML sees one
+// PropertyChanged per changed slot per frame.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace xaml_bridge {
+
+enum class SlotKind : uint8_t {
+    Number,   // double
+    Integer,  // int32; written values are rounded and clamped
+    Boolean,  // nonzero, non-NaN written values are true
+    Text,     // UTF-16
+};
+
+// Not thread-safe.
+class SlotTable {
+public:
+    // Add a slot holding 0, false or the empty string. Returns its index.
+    uint32_t add(SlotKind kind);
+    uint32_t size() const noexcept { return static_cast<uint32_t>(m_slots.size()); }
+    SlotKind kind(uint32_t slot) const { return m_slots[slot].kind; }
+
+    // Store a value in a Number, Integer or Boolean slot, converted to its
+    // kind. NaN equals NaN. Returns true, and queues the slot for
+    // take_changes, when the stored value changed.
+    bool set_number(uint32_t slot, double value);
+    // Store the text of a Text slot. Returns true when it changed.
+    bool set_text(uint32_t slot, std::u16string_view text);
+
+    double number(uint32_t slot) const { return m_slots[slot].number; }
+    const std::u16string& text(uint32_t slot) const { return m_slots[slot].text; }
+
+    bool has_changes() const noexcept { return !m_changed.empty(); }
+    // Append the changed slots to `out`, in the order they first changed,
+    // and clear them.
+    void take_changes(std::vector<uint32_t>& out);
+
+private:
+    struct Slot {
+        SlotKind kind;
+        bool queued = false;
+        double number = 0.0;
+        std::u16string text;
+    };
+
+    void queue(uint32_t slot);
+
+    std::vector<Slot> m_slots;
+    std::vector<uint32_t> m_changed;
+};
+
+} // namespace xaml_bridge
@@ -0,0 +1,261 @@
+#include "xaml_storyboard_sim.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace xaml_bridge {
+
+namespace {
+
+uint32_t lerp_color(uint32_t from, uint32_t to, double progress) {
+    uint32_t result = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        const double a = (from >> shift) & 0xFF;
+        const double b = (to >> shift) & 0xFF;
+        const double channel = std::clamp(std::round(a + (b - a) * progress), 0.0, 255.0);
+        result |= static_cast<uint32_t>(channel) << shift;
+    }
+    return result;
+}
+
+} // namespace
+
+std::u16string StoryboardSimulator::property_key(uint32_t target, std::u16string_view path) {
+    std::u16string key;
+    key.reserve(path.size() + 2);
+    key.push_back(static_cast<char16_t>(target >> 16));
+    key.push_back(static_cast<char16_t>(target & 0xFFFF));
+    key.append(path);
+    return key;
+}
+
+uint32_t StoryboardSimulator::property_slot(uint32_t target, std::u16string_view path) {
+    auto found = m_property_lookup.try_emplace(property_key(target, path), static_cast<uint32_t>(m_properties.size()));
+    if (found.second) {
+        m_properties.emplace_back();
+    }
+    return found.first->second;
+}
+
+const StoryboardSimulator::Property* StoryboardSimulator::find_property(
+    uint32_t target, std::u16string_view path) const {
+    const auto it = m_property_lookup.find(property_key(target, path));
+    return it == m_property_lookup.end() ? nullptr : &m_properties[it->second];
+}
+
+StoryboardSimulator::Storyboard* StoryboardSimulator::find(StoryboardId id) {
+    return id < m_storyboards.size() && m_storyboards[id].alive ? &m_storyboards[id] : nullptr;
+}
+
+const StoryboardSimulator::Storyboard* StoryboardSimulator::find(StoryboardId id) const {
+    return id < m_storyboards.size() && m_storyboards[id].alive ? &m_storyboards[id] : nullptr;
+}
+
+StoryboardSimulator::StoryboardId StoryboardSimulator::create(std::vector<SimAnimation> animations) {
+    StoryboardId id;
+    if (m_free.empty()) {
+        id = static_cast<StoryboardId>(m_storyboards.size());
+        m_storyboards.emplace_back();
+    } else {
+        id = m_free.back();
+        m_free.pop_back();
+        m_storyboards[id] = Storyboard{};
+    }
+
+    Storyboard& storyboard = m_storyboards[id];
+    storyboard.tracks.reserve(animations.size());
+    for (auto& spec : animations) {
+        Track track;
+        track.property = property_slot(spec.target, spec.property_path);
+        storyboard.length_ms = std::max(storyboard.length_ms, spec.begin_ms + std::max(spec.duration_ms, 0.0));
+        track.spec = std::move(spec);
+        storyboard.tracks.push_back(std::move(track));
+    }
+    return id;
+}
+
+void StoryboardSimulator::destroy(StoryboardId id) {
+    Storyboard* storyboard = find(id);
+    if (!storyboard) {
+        return;
+    }
+    // A destroyed XAML storyboard leaves its last values in place.
+    if (storyboard->state == SimClockState::Active) {
+        remove_running(id);
+    }
+    storyboard->alive = false;
+    storyboard->tracks.clear();
+    m_free.push_back(id);
+}
+
+void StoryboardSimulator::begin(StoryboardId id) {
+    Storyboard* storyboard = find(id);
+    if (!storyboard) {
+        return;
+    }
+    const bool restarting = storyboard->state != SimClockState::Stopped;
+    const bool was_active = storyboard->state == SimClockState::Active;
+    storyboard->run = m_next_run++;
+    for (Track& track : storyboard->tracks) {
+        const Property& property = m_properties[track.property];
+        track.start = property.value;
+        track.start_color = property.color;
+        if (!restarting) {
+            track.base = property.value;
+            track.base_color = property.color;
+        }
+    }
+    storyboard->state = SimClockState::Active;
+    storyboard->paused = false;
+    storyboard->start_ms = m_now_ms;
+
+    // Later Begins are applied later, so they win shared properties.
+    if (was_active) {
+        remove_running(id);
+    }
+    m_running.push_back(id);
+    size_t writes = 0;
+    apply(*storyboard, 0.0, writes);
+}
+
+void StoryboardSimulator::stop(StoryboardId id) {
+    Storyboard* storyboard = find(id);
+    if (!storyboard || storyboard->state == SimClockState::Stopped) {
+        return;
+    }
+    if (storyboard->state == SimClockState::Active) {
+        remove_running(id);
+    }
+    release(*storyboard);
+    storyboard->state = SimClockState::Stopped;
+    storyboard->paused = false;
+}
+
+void StoryboardSimulator::pause(StoryboardId id) {
+    Storyboard* storyboard = find(id);
+    if (storyboard && storyboard->state == SimClockState::Active && !storyboard->paused) {
+        storyboard->paused = true;
+        storyboard->paused_at = m_now_ms - storyboard->start_ms;
+    }
+}
+
+void StoryboardSimulator::resume(StoryboardId id) {
+    Storyboard* storyboard = find(id);
+    if (storyboard && storyboard->paused) {
+        storyboard->paused = false;
+        storyboard->start_ms = m_now_ms - storyboard->paused_at;
+    }
+}
+
+SimClockState StoryboardSimulator::state(StoryboardId id) const {
+    const Storyboard* storyboard = find(id);
+    return storyboard ? storyboard->state : SimClockState::Stopped;
+}
+
+bool StoryboardSimulator::is_paused(StoryboardId id) const {
+    const Storyboard* storyboard = find(id);
+    return storyboard && storyboard->paused;
+}
+
+size_t StoryboardSimulator::advance(double elapsed_ms) {
+    m_now_ms += std::max(elapsed_ms, 0.0);
+    size_t writes = 0;
+    size_t kept = 0;
+    for (size_t i = 0; i < m_running.size(); ++i) {
+        const StoryboardId id = m_running[i];
+        Storyboard& storyboard = m_storyboards[id];
+        if (!storyboard.paused) {
+            const double elapsed = m_now_ms - storyboard.start_ms;
+            apply(storyboard, std::min(elapsed, storyboard.length_ms), writes);
+            if (elapsed >= storyboard.length_ms) {
+                storyboard.state = SimClockState::Filling;
+                m_completed.push_back(id);
+                continue;
+            }
+        }
+        m_running[kept++] = id;
+    }
+    m_running.resize(kept);
+    return writes;
+}
+
+std::vector<StoryboardSimulator::StoryboardId> StoryboardSimulator::take_completed() {
+    std::vector<StoryboardId> completed;
+    completed.swap(m_completed);
+    return completed;
+}
+
+size_t StoryboardSimulator::active_animations() const noexcept {
+    size_t count = 0;
+    for (StoryboardId id : m_running) {
+        count += m_storyboards[id].tracks.size();
+    }
+    return count;
+}
+
+void StoryboardSimulator::set_value(uint32_t target, std::u16string_view path, double value) {
+    Property& property = m_properties[property_slot(target, path)];
+    property.value = value;
+    property.writer = 0;
+}
+
+void StoryboardSimulator::set_color(uint32_t target, std::u16string_view path, uint32_t argb) {
+    Property& property = m_properties[property_slot(target, path)];
+    property.color = argb;
+    property.writer = 0;
+}
+
+double StoryboardSimulator::value(uint32_t target, std::u16string_view path) const {
+    const Property* property = find_property(target, path);
+    return property ? property->value : 0.0;
+}
+
+uint32_t StoryboardSimulator::color(uint32_t target, std::u16string_view path) const {
+    const Property* property = find_property(target, path);
+    return property ? property->color : 0;
+}
+
+void StoryboardSimulator::apply(Storyboard& storyboard, double elapsed_ms, size_t& writes) {
+    for (const Track& track : storyboard.tracks) {
+        const SimAnimation& spec = track.spec;
+        if (elapsed_ms < spec.begin_ms) {
+            continue;
+        }
+        const double local = elapsed_ms - spec.begin_ms;
+        const double x = spec.duration_ms > 0.0 ? std::min(local / spec.duration_ms, 1.0) : 1.0;
+        const double progress = ease(spec.easing, x);
+
+        Property& property = m_properties[track.property];
+        if (spec.kind == SimAnimationKind::Color) {
+            const uint32_t from = spec.has_from ? spec.from_color : track.start_color;
+            property.color = lerp_color(from, spec.to_color, progress);
+        } else {
+            const double from = spec.has_from ? spec.from : track.start;
+            property.value = from + (spec.to - from) * progress;
+        }
+        property.writer = storyboard.run;
+        ++writes;
+    }
+}
+
+void StoryboardSimulator::release(Storyboard& storyboard) {
+    // Only properties this run still owns go back to their base values.
+    for (const Track& track : storyboard.tracks) {
+        Property& property = m_properties[track.property];
+        if (property.writer != storyboard.run) {
+            continue;
+        }
+        if (track.spec.kind == SimAnimationKind::Color) {
+            property.color = track.base_color;
+        } else {
+            property.value = track.base;
+        }
+        property.writer = 0;
+    }
+}
+
+void StoryboardSimulator::remove_running(StoryboardId id) {
+    m_running.erase(std::remove(m_running.begin(), m_running.end(), id), m_running.end());
+}
+
+} // namespace xaml_bridge
@@ -0,0 +1,123 @@
+#pragma once
+
+// Headless storyboard engine driven by a simulated clock.
+//
+// Follows XAML's rules for From/To animations closely enough to test and
+// benchmark animation-heavy flows without a compositor. Animations without
+// a From start from the property's value when the storyboard begins. A
+// finished storyboard holds its end values (FillBehavior HoldEnd), Stop
+// restores the values from before Begin, and when two running animations
+// write the same property the later Begin wins. Time only moves when
+// advance() is called, so runs are deterministic.
+
+#include "xaml_animation.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace xaml_bridge {
+
+enum class SimAnimationKind : uint8_t { Double, Color };
+
+struct SimAnimation {
+    SimAnimationKind kind = SimAnimationKind::Double;
+    uint32_t target = 0;               // Host-defined element id
+    std::u16string property_path;      // Storyboard.TargetProperty syntax
+    bool has_from = false;
+    double from = 0.0;                 // Double animations
+    double to = 0.0;
+    uint32_t from_color = 0;           // Color animations, ARGB
+    uint32_t to_color = 0;
+    double begin_ms = 0.0;
+    double duration_ms = 1000.0;
+    uint8_t easing = kKeyFrameLinear;  // XamlKeyFrameKind; see ease()
+};
+
+// Values match Windows.UI.Xaml.Media.Animation.ClockState.
+enum class SimClockState : uint8_t { Active, Filling, Stopped };
+
+class StoryboardSimulator {
+public:
+    using StoryboardId = uint32_t;
+
+    StoryboardId create(std::vector<SimAnimation> animations);
+    void destroy(StoryboardId id);
+
+    // Begin restarts a storyboard that is already running or filling.
+    void begin(StoryboardId id);
+    void stop(StoryboardId id);
+    void pause(StoryboardId id);
+    void resume(StoryboardId id);
+
+    SimClockState state(StoryboardId id) const;
+    bool is_paused(StoryboardId id) const;
+
+    // Move the clock forward and apply every running animation. Returns the
+    // number of property writes.
+    size_t advance(double elapsed_ms);
+    double now_ms() const noexcept { return m_now_ms; }
+
+    // Storyboards that completed since the last call, in completion order.
+    std::vector<StoryboardId> take_completed();
+
+    size_t running_storyboards() const noexcept { return m_running.size(); }
+    size_t active_animations() const noexcept;
+
+    // Property values. Unset doubles read as 0 and colors as transparent.
+    void set_value(uint32_t target, std::u16string_view path, double value);
+    void set_color(uint32_t target, std::u16string_view path, uint32_t argb);
+    double value(uint32_t target, std::u16string_view path) const;
+    uint32_t color(uint32_t target, std::u16string_view path) const;
+
+private:
+    struct Property {
+        double value = 0.0;
+        uint32_t color = 0;
+        uint64_t writer = 0;     // Run that last wrote it, or 0
+    };
+
+    struct Track {
+        SimAnimation spec;
+        uint32_t property = 0;
+        double base = 0.0;       // Value Stop restores
+        uint32_t base_color = 0;
+        double start = 0.0;      // Value at the latest Begin, used without From
+        uint32_t start_color = 0;
+    };
+
+    struct Storyboard {
+        std::vector<Track> tracks;
+        SimClockState state = SimClockState::Stopped;
+        bool paused = false;
+        bool alive = true;
+        double start_ms = 0.0;   // Clock time at elapsed 0
+        double paused_at = 0.0;  // Elapsed time when paused
+        double length_ms = 0.0;  // Latest begin + duration
+        uint64_t run = 0;        // Distinguishes each Begin
+    };
+
+    uint32_t property_slot(uint32_t target, std::u16string_view path);
+    const Property* find_property(uint32_t target, std::u16string_view path) const;
+    Storyboard* find(StoryboardId id);
+    const Storyboard* find(StoryboardId id) const;
+    void apply(Storyboard& storyboard, double elapsed_ms, size_t& writes);
+    void release(Storyboard& storyboard);
+    void remove_running(StoryboardId id);
+
+    static std::u16string property_key(uint32_t target, std::u16string_view path);
+
+    std::vector<Storyboard> m_storyboards;
+    std::vector<StoryboardId> m_free;
+    std::vector<StoryboardId> m_running;   // Active storyboards, paused or not
+    std::vector<StoryboardId> m_completed;
+    std::vector<Property> m_properties;
+    std::unordered_map<std::u16string, uint32_t> m_property_lookup;
+    double m_now_ms = 0.0;
+    uint64_t m_next_run = 1;
+};
+
+} // namespace xaml_bridge
@@ -0,0 +1,205 @@
+#include "xaml_string_table.h"
+
+#include <cstring>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace xaml_bridge {
+
+namespace {
+
+constexpr size_t kHeaderWords = 4;
+
+uint32_t read_u32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+void write_u32(std::vector<uint8_t>& out, uint32_t value) {
+    const size_t at = out.size();
+    out.resize(at + sizeof(value));
+    std::memcpy(out.data() + at, &value, sizeof(value));
+}
+
+} // namespace
+
+StringTable::~StringTable() {
+    close();
+}
+
+void StringTable::close() {
+    unmap();
+    m_base = nullptr;
+    m_size = 0;
+    m_count = 0;
+    m_offsets = nullptr;
+    m_data = nullptr;
+    m_locale = {};
+}
+
+void StringTable::unmap() noexcept {
+    if (!m_mapped) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(m_base);
+#else
+    munmap(const_cast<uint8_t*>(m_base), m_size);
+#endif
+    m_mapped = false;
+}
+
+#ifdef _WIN32
+bool StringTable::open(const wchar_t* path, std::string& error) {
+    close();
+    HANDLE file = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        error = "cannot open the string table file";
+        return false;
+    }
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        error = "string table file is empty";
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) {
+        error = "cannot map the string table file";
+        return false;
+    }
+    // The view keeps the mapping object alive.
+    const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view) {
+        error = "cannot map the string table file";
+        return false;
+    }
+    const size_t bytes = static_cast<size_t>(size.QuadPart);
+#else
+bool StringTable::open(const char* path, std::string& error) {
+    close();
+    const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        error = "cannot open the string table file";
+        return false;
+    }
+    struct stat info {};
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        error = "string table file is empty";
+        return false;
+    }
+    const size_t bytes = static_cast<size_t>(info.st_size);
+    void* view = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED) {
+        error = "cannot map the string table file";
+        return false;
+    }
+#endif
+    if (!attach(view, bytes, error)) {
+        m_base = static_cast<const uint8_t*>(view);
+        m_size = bytes;
+        m_mapped = true;
+        close();
+        return false;
+    }
+    m_mapped = true;
+    return true;
+}
+
+bool StringTable::attach(const void* data, size_t size, std::string& error) {
+    close();
+    const auto* base = static_cast<const uint8_t*>(data);
+    if (size < kHeaderWords * sizeof(uint32_t) || read_u32(base) != kStringTableMagic) {
+        error = "not a string table";
+        return false;
+    }
+    if (read_u32(base + 4) != kStringTableVersion) {
+        error = "unsupported string table version";
+        return false;
+    }
+    const uint64_t count = read_u32(base + 8);
+    const uint64_t data_start = (kHeaderWords + count + 1) * sizeof(uint32_t);
+    if (data_start > size || (size - data_start) % sizeof(char16_t) != 0) {
+        error = "string table is truncated";
+        return false;
+    }
+    const uint64_t units = (size - data_start) / sizeof(char16_t);
+    const auto* offsets = reinterpret_cast<const uint32_t*>(base + kHeaderWords * sizeof(uint32_t));
+    const auto* text = reinterpret_cast<const char16_t*>(base + data_start);
+
+    // Every string, and the locale, must end in a NUL inside the data area.
+    for (uint64_t id = 0; id < count; ++id) {
+        if (offsets[id + 1] < offsets[id] || offsets[id + 1] > units) {
+            error = "string table offsets are out of order or out of range";
+            return false;
+        }
+        if (offsets[id + 1] > offsets[id] && text[offsets[id + 1] - 1] != u'\0') {
+            error = "string table entry is not NUL-terminated";
+            return false;
+        }
+    }
+    const uint64_t locale_offset = read_u32(base + 12);
+    uint64_t locale_end = locale_offset;
+    while (locale_end < units && text[locale_end] != u'\0') {
+        ++locale_end;
+    }
+    if (locale_end >= units) {
+        error = "string table locale is not NUL-terminated";
+        return false;
+    }
+
+    m_base = base;
+    m_size = size;
+    m_count = static_cast<uint32_t>(count);
+    m_offsets = offsets;
+    m_data = text;
+    m_locale = std::u16string_view(text + locale_offset, static_cast<size_t>(locale_end - locale_offset));
+    return true;
+}
+
+std::vector<uint8_t> build_string_table(std::u16string_view locale, const std::vector<std::u16string>& strings) {
+    std::vector<uint8_t> out;
+    write_u32(out, kStringTableMagic);
+    write_u32(out, kStringTableVersion);
+    write_u32(out, static_cast<uint32_t>(strings.size()));
+
+    // The locale goes first in the data area, then the strings in id order.
+    write_u32(out, 0);
+    uint32_t offset = static_cast<uint32_t>(locale.size() + 1);
+    for (const auto& s : strings) {
+        write_u32(out, offset);
+        offset += static_cast<uint32_t>(s.size() + 1);
+    }
+    write_u32(out, offset);
+
+    auto append_text = [&](std::u16string_view s) {
+        const size_t at = out.size();
+        out.resize(at + (s.size() + 1) * sizeof(char16_t));
+        std::memcpy(out.data() + at, s.data(), s.size() * sizeof(char16_t));
+    };
+    append_text(locale);
+    for (const auto& s : strings) {
+        append_text(s);
+    }
+    return out;
+}
+
+} // namespace xaml_bridge
@@ -0,0 +1,83 @@
+#pragma once
+
+// Precompiled UTF-16 string tables for localized labels.
+//
+// A table file holds every string of one locale, addressed by 32-bit id.
+// StringTable maps it read-only, so opening a table costs one validation
+// pass and strings are read straight from the page cache, with no transcoding
+// or per-label copies.
+//
+// File layout (little-endian):
+//
+//     uint32 magic              kStringTableMagic ("XSTB")
+//     uint32 version            kStringTableVersion
+//     uint32 count              number of ids
+//     uint32 locale_offset      locale name, as a string in the data area
+//     uint32 offsets[count + 1] start of string `id` in the data area
+//     char16 data[]             strings, each followed by a NUL
+//
+// Offsets count UTF-16 units from the start of the data area. String `id`
+// spans [offsets[id], offsets[id + 1] - 1) and is followed by its NUL. Equal
+// offsets mark an id that has no string.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace xaml_bridge {
+
+constexpr uint32_t kStringTableMagic = 0x42545358;   // "XSTB"
+constexpr uint32_t kStringTableVersion = 1;
+
+class StringTable {
+public:
+    StringTable() = default;
+    ~StringTable();
+    StringTable(const StringTable&) = delete;
+    StringTable& operator=(const StringTable&) = delete;
+
+    // Map `path` and validate it. On failure the table is left empty and
+    // `error` describes the problem.
+#ifdef _WIN32
+    bool open(const wchar_t* path, std::string& error);
+#else
+    bool open(const char* path, std::string& error);
+#endif
+    // Validate a table already in memory. The memory is not copied and must
+    // outlive the table.
+    bool attach(const void* data, size_t size, std::string& error);
+    void close();
+
+    // Number of ids, including ids without a string.
+    uint32_t size() const noexcept { return m_count; }
+    bool contains(uint32_t id) const noexcept {
+        return id < m_count && m_offsets[id + 1] > m_offsets[id];
+    }
+    // Empty when the id has no string. The view is NUL-terminated.
+    std::u16string_view get(uint32_t id) const noexcept {
+        if (!contains(id)) {
+            return {};
+        }
+        return std::u16string_view(m_data + m_offsets[id], m_offsets[id + 1] - m_offsets[id] - 1);
+    }
+    std::u16string_view locale() const noexcept { return m_locale; }
+    size_t byte_size() const noexcept { return m_size; }
+
+private:
+    void unmap() noexcept;
+
+    const uint8_t* m_base = nullptr;
+    size_t m_size = 0;
+    bool m_mapped = false;
+    uint32_t m_count = 0;
+    const uint32_t* m_offsets = nullptr;
+    const char16_t* m_data = nullptr;
+    std::u16string_view m_locale;
+};
+
+// Serialize a table; strings[id] is the string for `id`.
+std::vector<uint8_t> build_string_table(std::u16string_view locale, const std::vector<std::u16string>& strings);
+
+} // namespace xaml_bridge
@@ -0,0 +1,112 @@
+#pragma once
+
+// UTF-16 text helpers shared by the bridge kernels.
+//
+// Item text is stored as std::u16string so the kernels behave identically on
+// Windows (where wchar_t is UTF-16) and on the Linux benchmark hosts.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+
+namespace xaml_bridge {
+
+// Simple case fold covering ASCII, Latin-1, Greek and Cyrillic capitals.
+// Every folded character has at most one upper-case preimage, which the
+// search kernels rely on (see upper_variant).
+inline char16_t fold_case(char16_t c) noexcept {
+    if (c < 0x80) {
+        return (c >= u'A' && c <= u'Z') ? static_cast<char16_t>(c + 0x20) : c;
+    }
+    if ((c >= 0x00C0 && c <= 0x00DE && c != 0x00D7) ||
+        (c >= 0x0391 && c <= 0x03A9 && c != 0x03A2) ||
+        (c >= 0x0410 && c <= 0x042F)) {
+        return static_cast<char16_t>(c + 0x20);
+    }
+    if (c >= 0x0400 && c <= 0x040F) {
+        return static_cast<char16_t>(c + 0x50);
+    }
+    return c;
+}
+
+// The upper-case character that folds to `folded`, or `folded` itself.
+inline char16_t upper_variant(char16_t folded) noexcept {
+    if (folded >= u'a' && folded <= u'z') {
+        return static_cast<char16_t>(folded - 0x20);
+    }
+    if ((folded >= 0x00E0 && folded <= 0x00FE && folded != 0x00F7) ||
+        (folded >= 0x03B1 && folded <= 0x03C9 && folded != 0x03C2) ||
+        (folded >= 0x0430 && folded <= 0x044F)) {
+        return static_cast<char16_t>(folded - 0x20);
+    }
+    if (folded >= 0x0450 && folded <= 0x045F) {
+        return static_cast<char16_t>(folded - 0x50);
+    }
+    return folded;
+}
+
+inline std::u16string fold_case(std::u16string_view text) {
+    std::u16string folded(text);
+    for (auto& c : folded) {
+        c = fold_case(c);
+    }
+    return folded;
+}
+
+// Parse the first decimal number in `text` (optional sign, fraction and
+// exponent). Returns NaN when the text contains no digits.
+inline double parse_leading_number(std::u16string_view text) noexcept {
+    size_t i = 0;
+    const size_t n = text.size();
+    while (i < n && !(text[i] >= u'0' && text[i] <= u'9') &&
+           !((text[i] == u'-' || text[i] == u'+' || text[i] == u'.') && i + 1 < n &&
+             text[i + 1] >= u'0' && text[i + 1] <= u'9')) {
+        ++i;
+    }
+    if (i == n) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    bool negative = false;
+    if (text[i] == u'-' || text[i] == u'+') {
+        negative = text[i] == u'-';
+        ++i;
+    }
+
+    double value = 0.0;
+    while (i < n && text[i] >= u'0' && text[i] <= u'9') {
+        value = value * 10.0 + (text[i] - u'0');
+        ++i;
+    }
+    if (i < n && text[i] == u'.') {
+        ++i;
+        double scale = 0.1;
+        while (i < n && text[i] >= u'0' && text[i] <= u'9') {
+            value += (text[i] - u'0') * scale;
+            scale *= 0.1;
+            ++i;
+        }
+    }
+    if (i + 1 < n && (text[i] == u'e' || text[i] == u'E')) {
+        size_t j = i + 1;
+        bool exp_negative = false;
+        if (j < n && (text[j] == u'-' || text[j] == u'+')) {
+            exp_negative = text[j] == u'-';
+            ++j;
+        }
+        if (j < n && text[j] >= u'0' && text[j] <= u'9') {
+            int exponent = 0;
+            while (j < n && text[j] >= u'0' && text[j] <= u'9') {
+                exponent = exponent < 10000 ? exponent * 10 + (text[j] - u'0') : exponent;
+                ++j;
+            }
+            value *= std::pow(10.0, exp_negative ? -exponent : exponent);
+        }
+    }
+    return negative ? -value : value;
+}
+
+} // namespace xaml_bridge